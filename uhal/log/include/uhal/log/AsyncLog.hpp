@@ -0,0 +1,110 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+---------------------------------------------------------------------------
+*/
+
+/**
+	@file
+	Optional asynchronous backend for the logger. When enabled, each log entry is formatted on the calling thread into a
+	thread-local buffer, without taking the logging mutex, and queued in that thread's fixed-size ring buffer; a background
+	thread then writes the queued entries to their output streams. If a thread's ring buffer is full, its entries are
+	dropped (and counted) rather than blocking the thread.
+*/
+
+#ifndef _uhal_log_AsyncLog_hpp_
+#define _uhal_log_AsyncLog_hpp_
+
+
+#include <cstddef>
+#include <iosfwd>
+#include <mutex>
+#include <stdint.h>
+
+
+namespace uhal
+{
+
+  /**
+    Start writing log entries from a background thread; has no effect if asynchronous logging is already enabled
+    @param aBufferSize the number of log entries that each thread can queue before further entries are dropped
+  */
+  void enableAsyncLogging ( const std::size_t aBufferSize = 1024 );
+
+  //! Write any queued log entries, stop the background thread, and go back to writing log entries on the calling thread
+  void disableAsyncLogging();
+
+  /**
+    Function to check whether log entries are currently written from a background thread
+    @return whether asynchronous logging is enabled
+  */
+  bool asyncLoggingEnabled();
+
+  //! Block until all log entries queued by any thread before this call have been written
+  void flushLog();
+
+  /**
+    Function to retrieve the number of log entries dropped since the program started, because a thread's buffer was full
+    @return the number of log entries dropped
+  */
+  uint64_t getDroppedLogEntries();
+
+
+  class LogEntryBuffer;
+
+  /**
+    Destination for the text of a single log entry, used by the log functions.
+    Either holds the logging mutex and refers to the entry's output stream, or refers to the calling thread's buffer, which is queued for the background thread on destruction
+  */
+  class LogEntry
+  {
+    public:
+      /**
+        Constructor
+        @param aStream the stream to which the entry should eventually be written
+      */
+      explicit LogEntry ( std::ostream& aStream );
+
+      //! Destructor, which queues the entry if logging asynchronously
+      ~LogEntry();
+
+      /**
+        Return the stream to which the text of the entry should be written
+        @return the stream to which the text of the entry should be written
+      */
+      std::ostream& stream();
+
+    private:
+      LogEntry ( const LogEntry& );
+      LogEntry& operator= ( const LogEntry& );
+
+      //! The stream to which the entry should eventually be written
+      std::ostream& mTarget;
+      //! The calling thread's buffer if logging asynchronously, or NULL otherwise
+      LogEntryBuffer* mBuffer;
+      //! The logging mutex, held if logging synchronously
+      std::unique_lock<std::mutex> mLock;
+  };
+
+}
+
+#endif
@@ -67,6 +67,20 @@ namespace uhal
         return static_cast<T&> ( *this );
       }
 
+      //! Write the head of a log entry to a stream other than this level's stream (e.g. a buffer, when logging asynchronously)
+      T& head ( std::ostream& aStr )
+      {
+        mHeadFunction ( aStr );
+        return static_cast<T&> ( *this );
+      }
+
+      //! Write the tail of a log entry to a stream other than this level's stream (e.g. a buffer, when logging asynchronously)
+      T& tail ( std::ostream& aStr )
+      {
+        mTailFunction ( aStr );
+        return static_cast<T&> ( *this );
+      }
+
       std::ostream& stream()
       {
         return mStr;
@@ -0,0 +1,127 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+---------------------------------------------------------------------------
+*/
+
+/**
+	@file
+	Filters which limit how many log entries a single log statement writes, for statements that are executed for every packet.
+	A filter is passed as the first argument of the log function, e.g. log ( mLimiter , Info() , ... ); each written entry
+	ends with the number of entries from the same statement that were dropped since the previous one was written.
+*/
+
+#ifndef _uhal_log_LogRateLimiter_hpp_
+#define _uhal_log_LogRateLimiter_hpp_
+
+
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+
+
+namespace uhal
+{
+
+  /**
+    Log filter which writes at most a fixed number of entries in each period (e.g. at most 10 per second), dropping the rest.
+    Thread safe; if several threads log through the same limiter at the start of a period, slightly more entries than the limit may be written.
+  */
+  class LogRateLimiter
+  {
+    public:
+      /**
+        Constructor
+        @param aMaxEntries the maximum number of entries to write in each period
+        @param aPeriod the length of each period
+      */
+      LogRateLimiter ( const uint32_t aMaxEntries = 10 , const std::chrono::steady_clock::duration& aPeriod = std::chrono::seconds ( 1 ) );
+
+      /**
+        Decide whether the next entry should be written
+        @param aSuppressed set to the number of entries dropped since the previous entry was written, if the entry should be written
+        @return whether the entry should be written
+      */
+      bool admit ( uint64_t& aSuppressed );
+
+      /**
+        Return the number of entries dropped since the last entry was written
+        @return the number of entries dropped since the last entry was written
+      */
+      uint64_t suppressed() const;
+
+    private:
+      LogRateLimiter ( const LogRateLimiter& );
+      LogRateLimiter& operator= ( const LogRateLimiter& );
+
+      //! The maximum number of entries to write in each period
+      const uint32_t mMaxEntries;
+      //! The length of each period, in steady_clock ticks
+      const std::chrono::steady_clock::rep mPeriod;
+      //! The start of the current period, in steady_clock ticks
+      std::atomic< std::chrono::steady_clock::rep > mPeriodStart;
+      //! The number of entries submitted in the current period
+      std::atomic< uint64_t > mEntries;
+      //! The number of entries dropped since the last entry was written
+      std::atomic< uint64_t > mSuppressed;
+  };
+
+
+  /**
+    Log filter which writes one in every N entries, dropping the rest; the first entry is always written.
+    Thread safe.
+  */
+  class LogSampler
+  {
+    public:
+      /**
+        Constructor
+        @param aInterval the number of entries submitted for each one written; 1 writes every entry
+      */
+      explicit LogSampler ( const uint32_t aInterval );
+
+      /**
+        Decide whether the next entry should be written
+        @param aSuppressed set to the number of entries dropped since the previous entry was written, if the entry should be written
+        @return whether the entry should be written
+      */
+      bool admit ( uint64_t& aSuppressed );
+
+      /**
+        Return the number of entries dropped since the last entry was written
+        @return the number of entries dropped since the last entry was written
+      */
+      uint64_t suppressed() const;
+
+    private:
+      LogSampler ( const LogSampler& );
+      LogSampler& operator= ( const LogSampler& );
+
+      //! The number of entries submitted for each one written
+      const uint32_t mInterval;
+      //! The number of entries submitted so far
+      std::atomic< uint64_t > mEntries;
+  };
+
+}
+
+#endif
@@ -1,5399 +1,238 @@
+/*
+---------------------------------------------------------------------------
 
-#ifndef _uhal_log_log_hpp_
-#define _uhal_log_log_hpp_
-
-
-#include <iosfwd>  // for ostream
-#include <mutex>   // for lock_guard, mutex
-
-#include <uhal/log/log_inserters.hpp>
-#include <uhal/log/LogLevels.hpp>
-#include <uhal/log/exception.hpp>
-
+    This file is part of uHAL.
 
-namespace uhal{
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
 
-class DebugLevel;
-class InfoLevel;
-class NoticeLevel;
-class WarningLevel;
-class ErrorLevel;
-class FatalLevel;
-
-// ======================================================================================================================================================
-// WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
-// ======================================================================================================================================================
-
-/**
-	Function to specify that the logging level should be retrieved from an environment variable
-	@param aEnvVar the name of the environment variable which is used to specify the logging level
-*/
-void setLogLevelFromEnvironment ( const char* aEnvVar );
-/**
-	Function to disable all logging levels
-*/
-void disableLogging();
-/**
-	Function to retrieve the mutex lock used by the logger
-*/
-std::mutex& GetLoggingMutex();
-/**
-	Function to specify, at runtime, that only messages with a severity level above Fatal should be logged
-*/
-void setLogLevelTo ( const FatalLevel& /**< a dummy parameter to choose the specialization of the function for the Fatal level */ );
-/**
-	Function to check at runtime whether the level Fatal is to be included in the log output
-	@return whether the level Fatal is to be included in the log output
-*/
-const bool& LoggingIncludes ( const FatalLevel& /**< a dummy parameter to choose the specialization of the function for the Fatal level */ );
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
 
-/**
-	Function to specify, at runtime, that only messages with a severity level above Error should be logged
-*/
-void setLogLevelTo ( const ErrorLevel& /**< a dummy parameter to choose the specialization of the function for the Error level */ );
-/**
-	Function to check at runtime whether the level Error is to be included in the log output
-	@return whether the level Error is to be included in the log output
-*/
-const bool& LoggingIncludes ( const ErrorLevel& /**< a dummy parameter to choose the specialization of the function for the Error level */ );
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
 
-/**
-	Function to specify, at runtime, that only messages with a severity level above Warning should be logged
-*/
-void setLogLevelTo ( const WarningLevel& /**< a dummy parameter to choose the specialization of the function for the Warning level */ );
-/**
-	Function to check at runtime whether the level Warning is to be included in the log output
-	@return whether the level Warning is to be included in the log output
-*/
-const bool& LoggingIncludes ( const WarningLevel& /**< a dummy parameter to choose the specialization of the function for the Warning level */ );
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
 
-/**
-	Function to specify, at runtime, that only messages with a severity level above Notice should be logged
-*/
-void setLogLevelTo ( const NoticeLevel& /**< a dummy parameter to choose the specialization of the function for the Notice level */ );
-/**
-	Function to check at runtime whether the level Notice is to be included in the log output
-	@return whether the level Notice is to be included in the log output
+---------------------------------------------------------------------------
 */
-const bool& LoggingIncludes ( const NoticeLevel& /**< a dummy parameter to choose the specialization of the function for the Notice level */ );
 
 /**
-	Function to specify, at runtime, that only messages with a severity level above Info should be logged
+	@file
+	The log functions and the run-time log level configuration.
+	Defining LOGGING_EXCLUDE_<LEVEL> (e.g. LOGGING_EXCLUDE_DEBUG) before including this file removes the log entries at that level,
+	and at all less severe levels, at compile time: the corresponding log calls compile to nothing.
 */
-void setLogLevelTo ( const InfoLevel& /**< a dummy parameter to choose the specialization of the function for the Info level */ );
-/**
-	Function to check at runtime whether the level Info is to be included in the log output
-	@return whether the level Info is to be included in the log output
-*/
-const bool& LoggingIncludes ( const InfoLevel& /**< a dummy parameter to choose the specialization of the function for the Info level */ );
-
-/**
-	Function to specify, at runtime, that only messages with a severity level above Debug should be logged
-*/
-void setLogLevelTo ( const DebugLevel& /**< a dummy parameter to choose the specialization of the function for the Debug level */ );
-/**
-	Function to check at runtime whether the level Debug is to be included in the log output
-	@return whether the level Debug is to be included in the log output
-*/
-const bool& LoggingIncludes ( const DebugLevel& /**< a dummy parameter to choose the specialization of the function for the Debug level */ );
-
-//! Class to restrict access to the log configuration parameters
-class log_configuration
-{
-	//! Constructor
-	log_configuration();
-	//! Destructor
-	virtual ~log_configuration();
-
-	friend void disableLogging();
-
-	//! static bool storing whether the Fatal level is to be included in the log output
-	static bool mLoggingIncludesFatal;
-	//!Make setLogLevelTo function a friend so it can access our private members
-	friend void setLogLevelTo ( const FatalLevel& );
-	//!Make LoggingIncludes function a friend so it can access our private members
-	friend const bool& LoggingIncludes ( const FatalLevel& );
-
-	//! static bool storing whether the Error level is to be included in the log output
-	static bool mLoggingIncludesError;
-	//!Make setLogLevelTo function a friend so it can access our private members
-	friend void setLogLevelTo ( const ErrorLevel& );
-	//!Make LoggingIncludes function a friend so it can access our private members
-	friend const bool& LoggingIncludes ( const ErrorLevel& );
-
-	//! static bool storing whether the Warning level is to be included in the log output
-	static bool mLoggingIncludesWarning;
-	//!Make setLogLevelTo function a friend so it can access our private members
-	friend void setLogLevelTo ( const WarningLevel& );
-	//!Make LoggingIncludes function a friend so it can access our private members
-	friend const bool& LoggingIncludes ( const WarningLevel& );
-
-	//! static bool storing whether the Notice level is to be included in the log output
-	static bool mLoggingIncludesNotice;
-	//!Make setLogLevelTo function a friend so it can access our private members
-	friend void setLogLevelTo ( const NoticeLevel& );
-	//!Make LoggingIncludes function a friend so it can access our private members
-	friend const bool& LoggingIncludes ( const NoticeLevel& );
-
-	//! static bool storing whether the Info level is to be included in the log output
-	static bool mLoggingIncludesInfo;
-	//!Make setLogLevelTo function a friend so it can access our private members
-	friend void setLogLevelTo ( const InfoLevel& );
-	//!Make LoggingIncludes function a friend so it can access our private members
-	friend const bool& LoggingIncludes ( const InfoLevel& );
-
-	//! static bool storing whether the Debug level is to be included in the log output
-	static bool mLoggingIncludesDebug;
-	//!Make setLogLevelTo function a friend so it can access our private members
-	friend void setLogLevelTo ( const DebugLevel& );
-	//!Make LoggingIncludes function a friend so it can access our private members
-	friend const bool& LoggingIncludes ( const DebugLevel& );
-
-	//!Define a static const member variable to have a value of true so that we can safely return a const reference to true
-	static const bool mTrue;
-	//!Define a static const member variable to have a value of false so that we can safely return a const reference to false
-	static const bool mFalse;
-
-	//!Make GetLoggingMutex function a friend so it can access our private members
-	friend std::mutex& GetLoggingMutex();
-	//!Define a static Mutex lock for thread safe logging
-	static std::mutex mMutex;
-};
-
-// ======================================================================================================================================================
-// WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
-// ======================================================================================================================================================
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-	*/
-	template< typename T0 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-	*/
-	template< typename T0 , typename T1 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-	*/
-	template< typename T0 , typename T1 , typename T2 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-		@param aArg31 a templated argument to be added to the log 32nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 , typename T31 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 , const T31& aArg31 );
-
-// ======================================================================================================================================================
-// WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
-// ======================================================================================================================================================
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-	*/
-	template< typename T0 >
-	void log ( ErrorLevel& aError , const T0& aArg0 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-	*/
-	template< typename T0 , typename T1 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-	*/
-	template< typename T0 , typename T1 , typename T2 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-		@param aArg31 a templated argument to be added to the log 32nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 , typename T31 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 , const T31& aArg31 );
-
-// ======================================================================================================================================================
-// WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
-// ======================================================================================================================================================
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-	*/
-	template< typename T0 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-	*/
-	template< typename T0 , typename T1 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-	*/
-	template< typename T0 , typename T1 , typename T2 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 );
 
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-		@param aArg31 a templated argument to be added to the log 32nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 , typename T31 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 , const T31& aArg31 );
-
-// ======================================================================================================================================================
-// WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
-// ======================================================================================================================================================
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-	*/
-	template< typename T0 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-	*/
-	template< typename T0 , typename T1 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-	*/
-	template< typename T0 , typename T1 , typename T2 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-		@param aArg31 a templated argument to be added to the log 32nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 , typename T31 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 , const T31& aArg31 );
-
-// ======================================================================================================================================================
-// WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
-// ======================================================================================================================================================
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-	*/
-	template< typename T0 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-	*/
-	template< typename T0 , typename T1 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-	*/
-	template< typename T0 , typename T1 , typename T2 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-		@param aArg31 a templated argument to be added to the log 32nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 , typename T31 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 , const T31& aArg31 );
-
-// ======================================================================================================================================================
-// WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
-// ======================================================================================================================================================
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-	*/
-	template< typename T0 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-	*/
-	template< typename T0 , typename T1 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-	*/
-	template< typename T0 , typename T1 , typename T2 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-		@param aArg31 a templated argument to be added to the log 32nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 , typename T31 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 , const T31& aArg31 );
-
-// ======================================================================================================================================================
-// WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
-// ======================================================================================================================================================
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-	*/
-	template< typename T0 >
-	void log ( exception::exception& aExc , const T0& aArg0 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-	*/
-	template< typename T0 , typename T1 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-	*/
-	template< typename T0 , typename T1 , typename T2 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 );
+#ifndef _uhal_log_log_hpp_
+#define _uhal_log_log_hpp_
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 );
+#include <iosfwd>       // for ostream
+#include <mutex>        // for mutex
+#include <stdint.h>
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 );
+#include <uhal/log/log_inserters.hpp>
+#include <uhal/log/LogLevels.hpp>
+#include <uhal/log/LogRateLimiter.hpp>
+#include <uhal/log/exception.hpp>
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 );
+//! The number of log levels, counting from Fatal, whose log entries are compiled in
+#if defined( LOGGING_EXCLUDE_FATAL )
+  #define UHAL_LOG_COMPILED_LEVELS 0
+#elif defined( LOGGING_EXCLUDE_ERROR )
+  #define UHAL_LOG_COMPILED_LEVELS 1
+#elif defined( LOGGING_EXCLUDE_WARNING )
+  #define UHAL_LOG_COMPILED_LEVELS 2
+#elif defined( LOGGING_EXCLUDE_NOTICE )
+  #define UHAL_LOG_COMPILED_LEVELS 3
+#elif defined( LOGGING_EXCLUDE_INFO )
+  #define UHAL_LOG_COMPILED_LEVELS 4
+#elif defined( LOGGING_EXCLUDE_DEBUG )
+  #define UHAL_LOG_COMPILED_LEVELS 5
+#else
+  #define UHAL_LOG_COMPILED_LEVELS 6
+#endif
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-		@param aArg31 a templated argument to be added to the log 32nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 , typename T31 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 , const T31& aArg31 );
+namespace uhal
+{
 
-// ======================================================================================================================================================
-// WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
-// ======================================================================================================================================================
+  /**
+    Function to specify that the logging level should be retrieved from an environment variable
+    @param aEnvVar the name of the environment variable which is used to specify the logging level
+  */
+  void setLogLevelFromEnvironment ( const char* aEnvVar );
+
+  //! Function to disable all logging levels
+  void disableLogging();
+
+  //! Function to retrieve the mutex lock used by the logger
+  std::mutex& GetLoggingMutex();
+
+  //! Function to specify, at runtime, that only messages with a severity level above Fatal should be logged
+  void setLogLevelTo ( const FatalLevel& /**< a dummy parameter to choose the specialization of the function for the Fatal level */ );
+  //! Function to specify, at runtime, that only messages with a severity level above Error should be logged
+  void setLogLevelTo ( const ErrorLevel& /**< a dummy parameter to choose the specialization of the function for the Error level */ );
+  //! Function to specify, at runtime, that only messages with a severity level above Warning should be logged
+  void setLogLevelTo ( const WarningLevel& /**< a dummy parameter to choose the specialization of the function for the Warning level */ );
+  //! Function to specify, at runtime, that only messages with a severity level above Notice should be logged
+  void setLogLevelTo ( const NoticeLevel& /**< a dummy parameter to choose the specialization of the function for the Notice level */ );
+  //! Function to specify, at runtime, that only messages with a severity level above Info should be logged
+  void setLogLevelTo ( const InfoLevel& /**< a dummy parameter to choose the specialization of the function for the Info level */ );
+  //! Function to specify, at runtime, that only messages with a severity level above Debug should be logged
+  void setLogLevelTo ( const DebugLevel& /**< a dummy parameter to choose the specialization of the function for the Debug level */ );
+
+  /**
+    Function to check at runtime whether the level Fatal is to be included in the log output
+    @return whether the level Fatal is to be included in the log output
+  */
+  const bool& LoggingIncludes ( const FatalLevel& /**< a dummy parameter to choose the specialization of the function for the Fatal level */ );
+  /**
+    Function to check at runtime whether the level Error is to be included in the log output
+    @return whether the level Error is to be included in the log output
+  */
+  const bool& LoggingIncludes ( const ErrorLevel& /**< a dummy parameter to choose the specialization of the function for the Error level */ );
+  /**
+    Function to check at runtime whether the level Warning is to be included in the log output
+    @return whether the level Warning is to be included in the log output
+  */
+  const bool& LoggingIncludes ( const WarningLevel& /**< a dummy parameter to choose the specialization of the function for the Warning level */ );
+  /**
+    Function to check at runtime whether the level Notice is to be included in the log output
+    @return whether the level Notice is to be included in the log output
+  */
+  const bool& LoggingIncludes ( const NoticeLevel& /**< a dummy parameter to choose the specialization of the function for the Notice level */ );
+  /**
+    Function to check at runtime whether the level Info is to be included in the log output
+    @return whether the level Info is to be included in the log output
+  */
+  const bool& LoggingIncludes ( const InfoLevel& /**< a dummy parameter to choose the specialization of the function for the Info level */ );
+  /**
+    Function to check at runtime whether the level Debug is to be included in the log output
+    @return whether the level Debug is to be included in the log output
+  */
+  const bool& LoggingIncludes ( const DebugLevel& /**< a dummy parameter to choose the specialization of the function for the Debug level */ );
+
+
+  template< uint32_t Severity > struct LogLevelSeverity;
+
+  //! Class to restrict access to the log configuration parameters
+  class log_configuration
+  {
+      //! Constructor
+      log_configuration();
+      //! Destructor
+      virtual ~log_configuration();
+
+      /**
+        Include the levels up to and including the given severity in the log output, and exclude the rest
+        @param aSeverity the severity of the least severe level to include
+      */
+      static void setLevel ( const uint32_t aSeverity );
+
+      friend void disableLogging();
+      friend void setLogLevelTo ( const FatalLevel& );
+      friend void setLogLevelTo ( const ErrorLevel& );
+      friend void setLogLevelTo ( const WarningLevel& );
+      friend void setLogLevelTo ( const NoticeLevel& );
+      friend void setLogLevelTo ( const InfoLevel& );
+      friend void setLogLevelTo ( const DebugLevel& );
+      friend const bool& LoggingIncludes ( const FatalLevel& );
+      friend const bool& LoggingIncludes ( const ErrorLevel& );
+      friend const bool& LoggingIncludes ( const WarningLevel& );
+      friend const bool& LoggingIncludes ( const NoticeLevel& );
+      friend const bool& LoggingIncludes ( const InfoLevel& );
+      friend const bool& LoggingIncludes ( const DebugLevel& );
+      //! Allow the log functions to check the level without a function call
+      template< uint32_t Severity > friend struct LogLevelSeverity;
+
+      //! The number of log levels
+      static const uint32_t kNumberOfLevels = 6;
+      //! Whether each level, indexed by severity, is to be included in the log output
+      static bool mLoggingIncludes[kNumberOfLevels];
+
+      //!Make GetLoggingMutex function a friend so it can access our private members
+      friend std::mutex& GetLoggingMutex();
+      //!Define a static Mutex lock for thread safe logging
+      static std::mutex mMutex;
+  };
+
+
+  //! Properties shared by the log levels of a given severity
+  template< uint32_t Severity >
+  struct LogLevelSeverity
+  {
+    //! The severity of the level, from 0 for Fatal to 5 for Debug
+    static const uint32_t kSeverity = Severity;
+
+    //! Whether log entries at this level are compiled in, given the LOGGING_EXCLUDE_<LEVEL> macros
+    static const bool kCompiled = ( Severity < UHAL_LOG_COMPILED_LEVELS );
+
+    /**
+      Function to check at runtime whether this level is to be included in the log output; equivalent to LoggingIncludes, but inlined
+      @return whether this level is to be included in the log output
+    */
+    static bool included()
+    {
+      return log_configuration::mLoggingIncludes[Severity];
+    }
+  };
+
+  //! Compile-time properties of each log level, used to choose the implementation of the log functions
+  template< typename T > struct LogLevelTraits;
+
+  template<> struct LogLevelTraits< FatalLevel > : public LogLevelSeverity< 0 > {};
+  template<> struct LogLevelTraits< ErrorLevel > : public LogLevelSeverity< 1 > {};
+  template<> struct LogLevelTraits< WarningLevel > : public LogLevelSeverity< 2 > {};
+  template<> struct LogLevelTraits< NoticeLevel > : public LogLevelSeverity< 3 > {};
+  template<> struct LogLevelTraits< InfoLevel > : public LogLevelSeverity< 4 > {};
+  template<> struct LogLevelTraits< DebugLevel > : public LogLevelSeverity< 5 > {};
+
+
+  /**
+    Function to add a log entry at the given level. If the level is excluded at compile time the function is empty, and its arguments are never formatted
+    @param aLevel the log level, e.g. Debug()
+    @param aArgs the arguments to be added to the log entry, in order
+  */
+  template< typename T , typename... Args , bool Compiled = LogLevelTraits< T >::kCompiled >
+  void log ( BaseLogLevel< T >& aLevel , const Args&... aArgs );
+
+  /**
+    Function to add a log entry at the given level, if the rate limiter allows it; intended for log statements that are executed for every packet
+    @param aLimiter the rate limiter for this log statement, which is only consulted if the level is enabled
+    @param aLevel the log level, e.g. Info()
+    @param aArgs the arguments to be added to the log entry, in order
+  */
+  template< typename T , typename... Args , bool Compiled = LogLevelTraits< T >::kCompiled >
+  void log ( LogRateLimiter& aLimiter , BaseLogLevel< T >& aLevel , const Args&... aArgs );
+
+  /**
+    Function to add a log entry at the given level, if the sampler selects it; intended for log statements that are executed for every packet
+    @param aSampler the sampler for this log statement, which is only consulted if the level is enabled
+    @param aLevel the log level, e.g. Info()
+    @param aArgs the arguments to be added to the log entry, in order
+  */
+  template< typename T , typename... Args , bool Compiled = LogLevelTraits< T >::kCompiled >
+  void log ( LogSampler& aSampler , BaseLogLevel< T >& aLevel , const Args&... aArgs );
+
+  /**
+    Function to append a message to an exception, and to add it to the log at Error level
+    @param aExc the exception to which the message should be appended
+    @param aArgs the arguments to be added to the message, in order
+  */
+  template< typename... Args >
+  void log ( exception::exception& aExc , const Args&... aArgs );
 
 }
 
 #include "uhal/log/log.hxx"
-#endif
 
+#endif
@@ -0,0 +1,580 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/log/AsyncLog.hpp"
+
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "uhal/log/log.hpp"
+
+
+namespace uhal
+{
+
+  namespace
+  {
+    //! A stream buffer which appends to a string, so that the string's storage is reused from one log entry to the next
+    class StringBuffer : public std::streambuf
+    {
+      public:
+        explicit StringBuffer ( std::string& aString ) :
+          mString ( aString )
+        {}
+
+      protected:
+        int_type overflow ( int_type aChar )
+        {
+          if ( !traits_type::eq_int_type ( aChar , traits_type::eof() ) )
+          {
+            mString.push_back ( traits_type::to_char_type ( aChar ) );
+          }
+
+          return traits_type::not_eof ( aChar );
+        }
+
+        std::streamsize xsputn ( const char* aData , std::streamsize aSize )
+        {
+          mString.append ( aData , aSize );
+          return aSize;
+        }
+
+      private:
+        std::string& mString;
+    };
+
+
+    //! A formatted log entry, and the stream to which it is to be written
+    struct Record
+    {
+      std::ostream* target;
+      std::string text;
+    };
+
+
+    /**
+      A fixed-size queue of formatted log entries, which is filled by one thread and emptied by the background writer thread without locking.
+      The storage of each record is reused, so once warmed up, queueing an entry does not allocate memory
+    */
+    class RingBuffer
+    {
+      public:
+        explicit RingBuffer ( const std::size_t aSize ) :
+          mRecords ( aSize ),
+          mHead ( 0 ),
+          mTail ( 0 ),
+          mOwnerExited ( false )
+        {}
+
+        //! Called by the owning thread to queue an entry; returns false if the queue is full
+        bool push ( std::ostream& aTarget , const std::string& aText )
+        {
+          const uint64_t lHead ( mHead.load ( std::memory_order_relaxed ) );
+
+          if ( lHead - mTail.load ( std::memory_order_acquire ) >= mRecords.size() )
+          {
+            return false;
+          }
+
+          Record& lRecord ( mRecords[lHead % mRecords.size()] );
+          lRecord.target = &aTarget;
+          lRecord.text.assign ( aText );
+          mHead.store ( lHead + 1 , std::memory_order_release );
+          return true;
+        }
+
+        //! Called by the owning thread to check whether the queue is at least half full
+        bool halfFull() const
+        {
+          return 2 * ( mHead.load ( std::memory_order_relaxed ) - mTail.load ( std::memory_order_relaxed ) ) >= mRecords.size();
+        }
+
+        //! Called by the writer thread to write out all queued entries, noting the streams written to; returns the number of entries written
+        std::size_t drain ( std::vector< std::ostream* >& aStreams )
+        {
+          const uint64_t lHead ( mHead.load ( std::memory_order_acquire ) );
+          uint64_t lTail ( mTail.load ( std::memory_order_relaxed ) );
+          const std::size_t lCount ( lHead - lTail );
+
+          for ( ; lTail != lHead; lTail++ )
+          {
+            const Record& lRecord ( mRecords[lTail % mRecords.size()] );
+            lRecord.target->write ( lRecord.text.data() , lRecord.text.size() );
+
+            if ( std::find ( aStreams.begin() , aStreams.end() , lRecord.target ) == aStreams.end() )
+            {
+              aStreams.push_back ( lRecord.target );
+            }
+
+            mTail.store ( lTail + 1 , std::memory_order_release );
+          }
+
+          return lCount;
+        }
+
+        bool empty() const
+        {
+          return mHead.load ( std::memory_order_acquire ) == mTail.load ( std::memory_order_acquire );
+        }
+
+        void setOwnerExited()
+        {
+          mOwnerExited.store ( true , std::memory_order_release );
+        }
+
+        bool ownerExited() const
+        {
+          return mOwnerExited.load ( std::memory_order_acquire );
+        }
+
+      private:
+        std::vector< Record > mRecords;
+        //! The number of entries queued so far; only written by the owning thread
+        std::atomic< uint64_t > mHead;
+        //! The number of entries written out so far; only written by the writer thread
+        std::atomic< uint64_t > mTail;
+        std::atomic< bool > mOwnerExited;
+    };
+
+
+    //! Owns the background thread, and the ring buffers of all threads that have logged asynchronously
+    class AsyncLogWriter
+    {
+      public:
+        //! The writer is never destroyed, so that threads can safely log while static objects are being destroyed
+        static AsyncLogWriter& getInstance()
+        {
+          static AsyncLogWriter* lInstance = new AsyncLogWriter();
+          return *lInstance;
+        }
+
+        void enable ( const std::size_t aBufferSize )
+        {
+          std::lock_guard<std::mutex> lLock ( mControlMutex );
+
+          if ( mEnabled.load ( std::memory_order_relaxed ) )
+          {
+            return;
+          }
+
+          mBufferSize = std::max ( aBufferSize , std::size_t ( 1 ) );
+          mGeneration.fetch_add ( 1 , std::memory_order_relaxed );
+          mStop.store ( false , std::memory_order_relaxed );
+          mThread = std::thread ( &AsyncLogWriter::run , this );
+          mEnabled.store ( true , std::memory_order_release );
+        }
+
+        void disable()
+        {
+          std::lock_guard<std::mutex> lLock ( mControlMutex );
+
+          if ( !mEnabled.load ( std::memory_order_relaxed ) )
+          {
+            return;
+          }
+
+          mDisabling.store ( true , std::memory_order_relaxed );
+          mEnabled.store ( false , std::memory_order_seq_cst );
+          mStop.store ( true , std::memory_order_release );
+          wake();
+          mThread.join();
+
+          // Entries being queued as logging was disabled are waited for; any queued later are written synchronously instead
+          while ( mReleasesInProgress.load ( std::memory_order_seq_cst ) != 0 )
+          {
+            std::this_thread::yield();
+          }
+
+          // Write out anything queued by threads that started an entry just before logging became synchronous again
+          drain();
+          {
+            std::lock_guard<std::mutex> lRingsLock ( mRingsMutex );
+            mRings.clear();
+          }
+          mGeneration.fetch_add ( 1 , std::memory_order_relaxed );
+          mDisabling.store ( false , std::memory_order_release );
+        }
+
+        /**
+          Called by a thread before queueing an entry
+          @return true if the entry should be queued (followed by a call to endRelease), or false if it should be written synchronously
+        */
+        bool beginRelease()
+        {
+          mReleasesInProgress.fetch_add ( 1 , std::memory_order_seq_cst );
+
+          if ( mEnabled.load ( std::memory_order_seq_cst ) )
+          {
+            return true;
+          }
+
+          endRelease();
+          waitUntilDisabled();
+          return false;
+        }
+
+        void endRelease()
+        {
+          mReleasesInProgress.fetch_sub ( 1 , std::memory_order_release );
+        }
+
+        //! Called before writing an entry synchronously, so that it isn't written before entries that the thread queued before logging was disabled
+        void waitUntilDisabled()
+        {
+          if ( mDisabling.load ( std::memory_order_acquire ) )
+          {
+            std::lock_guard<std::mutex> lLock ( mControlMutex );
+          }
+        }
+
+        bool enabled() const
+        {
+          return mEnabled.load ( std::memory_order_acquire );
+        }
+
+        uint64_t generation() const
+        {
+          return mGeneration.load ( std::memory_order_relaxed );
+        }
+
+        void flush()
+        {
+          std::unique_lock<std::mutex> lLock ( mPassMutex );
+          // A pass may already be under way, so wait for the end of the next one
+          const uint64_t lTarget ( mPasses + 2 );
+          wake();
+          mPassCompleted.wait ( lLock , [this, lTarget] () { return ( mPasses >= lTarget ) || !enabled(); } );
+        }
+
+        std::shared_ptr< RingBuffer > registerThread()
+        {
+          std::lock_guard<std::mutex> lLock ( mRingsMutex );
+          mRings.push_back ( std::make_shared< RingBuffer > ( mBufferSize ) );
+          return mRings.back();
+        }
+
+        //! Wake the background thread if it is sleeping; a wake-up may occasionally be missed, in which case the thread wakes up anyway within kSleepPeriod
+        void wake()
+        {
+          if ( !mWakeRequested.exchange ( true , std::memory_order_acq_rel ) )
+          {
+            mWakeUp.notify_one();
+          }
+        }
+
+        void entryDropped()
+        {
+          mDropped.fetch_add ( 1 , std::memory_order_relaxed );
+        }
+
+        uint64_t dropped() const
+        {
+          return mDropped.load ( std::memory_order_relaxed );
+        }
+
+      private:
+        AsyncLogWriter() :
+          mEnabled ( false ),
+          mDisabling ( false ),
+          mReleasesInProgress ( 0 ),
+          mStop ( false ),
+          mGeneration ( 0 ),
+          mDropped ( 0 ),
+          mBufferSize ( 0 ),
+          mWakeRequested ( false ),
+          mPasses ( 0 )
+        {}
+
+        void run()
+        {
+          while ( true )
+          {
+            const bool lStop ( mStop.load ( std::memory_order_acquire ) );
+            const std::size_t lWritten ( drain() );
+
+            {
+              std::lock_guard<std::mutex> lLock ( mPassMutex );
+              mPasses++;
+            }
+            mPassCompleted.notify_all();
+
+            if ( lStop )
+            {
+              break;
+            }
+
+            if ( lWritten == 0 )
+            {
+              std::unique_lock<std::mutex> lLock ( mWakeMutex );
+              mWakeUp.wait_for ( lLock , kSleepPeriod , [this] () { return mWakeRequested.load ( std::memory_order_acquire ); } );
+            }
+
+            mWakeRequested.store ( false , std::memory_order_release );
+          }
+        }
+
+        std::size_t drain()
+        {
+          std::vector< std::shared_ptr< RingBuffer > > lRings;
+          {
+            std::lock_guard<std::mutex> lLock ( mRingsMutex );
+            lRings = mRings;
+          }
+
+          std::size_t lWritten ( 0 );
+          bool lExited ( false );
+          {
+            // Hold the logging mutex, so that entries written synchronously are not interleaved with these
+            std::lock_guard<std::mutex> lLock ( GetLoggingMutex() );
+            std::vector< std::ostream* > lStreams;
+
+            for ( std::vector< std::shared_ptr< RingBuffer > >::const_iterator lIt = lRings.begin(); lIt != lRings.end(); lIt++ )
+            {
+              lExited = ( *lIt )->ownerExited() || lExited;
+              lWritten += ( *lIt )->drain ( lStreams );
+            }
+
+            for ( std::vector< std::ostream* >::const_iterator lIt = lStreams.begin(); lIt != lStreams.end(); lIt++ )
+            {
+              ( *lIt )->flush();
+            }
+          }
+
+          if ( lExited )
+          {
+            // The owner's last entry was queued before it marked the ring as exited, so once empty the ring can be discarded
+            std::lock_guard<std::mutex> lLock ( mRingsMutex );
+            mRings.erase ( std::remove_if ( mRings.begin() , mRings.end() , [] ( const std::shared_ptr< RingBuffer >& aRing ) { return aRing->ownerExited() && aRing->empty(); } ) , mRings.end() );
+          }
+
+          return lWritten;
+        }
+
+        //! How long the background thread sleeps for when there is nothing to write, unless it is woken up
+        static const std::chrono::milliseconds kSleepPeriod;
+
+        //! Serialises enabling and disabling
+        std::mutex mControlMutex;
+        std::atomic< bool > mEnabled;
+        //! True from the start of disable() until the ring buffers have been written out
+        std::atomic< bool > mDisabling;
+        //! The number of threads that are queueing an entry
+        std::atomic< uint64_t > mReleasesInProgress;
+        std::atomic< bool > mStop;
+        //! Incremented whenever asynchronous logging is enabled or disabled, so that threads know to register a new ring buffer
+        std::atomic< uint64_t > mGeneration;
+        std::atomic< uint64_t > mDropped;
+        std::size_t mBufferSize;
+
+        std::mutex mRingsMutex;
+        std::vector< std::shared_ptr< RingBuffer > > mRings;
+
+        std::thread mThread;
+        std::mutex mWakeMutex;
+        std::condition_variable mWakeUp;
+        std::atomic< bool > mWakeRequested;
+
+        std::mutex mPassMutex;
+        std::condition_variable mPassCompleted;
+        //! The number of times that the background thread has written out all ring buffers
+        uint64_t mPasses;
+    };
+
+    const std::chrono::milliseconds AsyncLogWriter::kSleepPeriod ( 10 );
+
+
+    //! Writes out any queued entries when the program exits
+    struct AsyncLogShutdown
+    {
+      ~AsyncLogShutdown()
+      {
+        AsyncLogWriter::getInstance().disable();
+      }
+    } gAsyncLogShutdown;
+  }
+
+
+  //! A thread's buffer for formatting log entries, and the ring buffer in which they are queued
+  class LogEntryBuffer
+  {
+    public:
+      LogEntryBuffer() :
+        mStringBuffer ( mText ),
+        mStream ( &mStringBuffer ),
+        mBusy ( false ),
+        mGeneration ( 0 )
+      {}
+
+      ~LogEntryBuffer()
+      {
+        if ( mRing )
+        {
+          mRing->setOwnerExited();
+        }
+      }
+
+      //! Return the calling thread's buffer, or NULL if it is already in use (i.e. a log entry is being written while formatting another)
+      static LogEntryBuffer* acquire()
+      {
+        static thread_local LogEntryBuffer lBuffer;
+
+        if ( lBuffer.mBusy )
+        {
+          return NULL;
+        }
+
+        lBuffer.mBusy = true;
+        return &lBuffer;
+      }
+
+      std::ostream& stream()
+      {
+        return mStream;
+      }
+
+      //! Queue the formatted entry (or write it, if logging has been disabled since the entry was started), and reset the buffer for the next one
+      void release ( std::ostream& aTarget )
+      {
+        AsyncLogWriter& lWriter ( AsyncLogWriter::getInstance() );
+
+        if ( !lWriter.beginRelease() )
+        {
+          std::lock_guard<std::mutex> lLock ( GetLoggingMutex() );
+          aTarget.write ( mText.data() , mText.size() );
+          aTarget.flush();
+        }
+        else
+        {
+          if ( ( !mRing ) || ( mGeneration != lWriter.generation() ) )
+          {
+            if ( mRing )
+            {
+              mRing->setOwnerExited();
+            }
+
+            mGeneration = lWriter.generation();
+            mRing = lWriter.registerThread();
+          }
+
+          if ( !mRing->push ( aTarget , mText ) )
+          {
+            lWriter.entryDropped();
+            lWriter.wake();
+          }
+          else if ( mRing->halfFull() )
+          {
+            lWriter.wake();
+          }
+
+          lWriter.endRelease();
+        }
+
+        mText.clear();
+        mStream.clear();
+        mStream.flags ( std::ios_base::dec | std::ios_base::skipws );
+        mStream.fill ( ' ' );
+        mStream.precision ( 6 );
+        mBusy = false;
+      }
+
+    private:
+      std::string mText;
+      StringBuffer mStringBuffer;
+      std::ostream mStream;
+      bool mBusy;
+      std::shared_ptr< RingBuffer > mRing;
+      uint64_t mGeneration;
+  };
+
+
+  void enableAsyncLogging ( const std::size_t aBufferSize )
+  {
+    AsyncLogWriter::getInstance().enable ( aBufferSize );
+  }
+
+
+  void disableAsyncLogging()
+  {
+    AsyncLogWriter::getInstance().disable();
+  }
+
+
+  bool asyncLoggingEnabled()
+  {
+    return AsyncLogWriter::getInstance().enabled();
+  }
+
+
+  void flushLog()
+  {
+    if ( asyncLoggingEnabled() )
+    {
+      AsyncLogWriter::getInstance().flush();
+    }
+  }
+
+
+  uint64_t getDroppedLogEntries()
+  {
+    return AsyncLogWriter::getInstance().dropped();
+  }
+
+
+  LogEntry::LogEntry ( std::ostream& aStream ) :
+    mTarget ( aStream ),
+    mBuffer ( asyncLoggingEnabled() ? LogEntryBuffer::acquire() : NULL )
+  {
+    if ( !mBuffer )
+    {
+      AsyncLogWriter::getInstance().waitUntilDisabled();
+      mLock = std::unique_lock<std::mutex> ( GetLoggingMutex() );
+    }
+  }
+
+
+  LogEntry::~LogEntry()
+  {
+    if ( mBuffer )
+    {
+      mBuffer->release ( mTarget );
+    }
+  }
+
+
+  std::ostream& LogEntry::stream()
+  {
+    return mBuffer ? mBuffer->stream() : mTarget;
+  }
+
+}
@@ -0,0 +1,98 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/log/LogRateLimiter.hpp"
+
+
+namespace uhal
+{
+
+  LogRateLimiter::LogRateLimiter ( const uint32_t aMaxEntries , const std::chrono::steady_clock::duration& aPeriod ) :
+    mMaxEntries ( aMaxEntries ),
+    mPeriod ( aPeriod.count() ),
+    mPeriodStart ( std::chrono::steady_clock::now().time_since_epoch().count() ),
+    mEntries ( 0 ),
+    mSuppressed ( 0 )
+  {
+  }
+
+
+  bool LogRateLimiter::admit ( uint64_t& aSuppressed )
+  {
+    const std::chrono::steady_clock::rep lNow ( std::chrono::steady_clock::now().time_since_epoch().count() );
+    std::chrono::steady_clock::rep lPeriodStart ( mPeriodStart.load ( std::memory_order_relaxed ) );
+
+    // Only the thread which moves the start of the period on resets the count
+    if ( ( lNow - lPeriodStart >= mPeriod ) && mPeriodStart.compare_exchange_strong ( lPeriodStart , lNow , std::memory_order_relaxed ) )
+    {
+      mEntries.store ( 0 , std::memory_order_relaxed );
+    }
+
+    if ( mEntries.fetch_add ( 1 , std::memory_order_relaxed ) < mMaxEntries )
+    {
+      aSuppressed = mSuppressed.exchange ( 0 , std::memory_order_relaxed );
+      return true;
+    }
+
+    mSuppressed.fetch_add ( 1 , std::memory_order_relaxed );
+    return false;
+  }
+
+
+  uint64_t LogRateLimiter::suppressed() const
+  {
+    return mSuppressed.load ( std::memory_order_relaxed );
+  }
+
+
+  LogSampler::LogSampler ( const uint32_t aInterval ) :
+    mInterval ( ( aInterval == 0 ) ? 1 : aInterval ),
+    mEntries ( 0 )
+  {
+  }
+
+
+  bool LogSampler::admit ( uint64_t& aSuppressed )
+  {
+    const uint64_t lIndex ( mEntries.fetch_add ( 1 , std::memory_order_relaxed ) );
+
+    if ( lIndex % mInterval != 0 )
+    {
+      return false;
+    }
+
+    // Every entry written, other than the first, follows a full interval of dropped entries
+    aSuppressed = ( lIndex == 0 ) ? 0 : mInterval - 1;
+    return true;
+  }
+
+
+  uint64_t LogSampler::suppressed() const
+  {
+    const uint64_t lEntries ( mEntries.load ( std::memory_order_relaxed ) );
+    return ( lEntries == 0 ) ? 0 : ( lEntries - 1 ) % mInterval;
+  }
+
+}
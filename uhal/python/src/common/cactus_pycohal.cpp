@@ -126,6 +126,10 @@ namespace pycohal
   /// N.B: This return value policy is a safe option, but not necessarily the most optimal.
   const auto norm_ref_return_policy = py::return_value_policy::reference_internal;
 
+  /// Call guard which releases the GIL while the wrapped function runs, so that other python threads can run while it waits on the network or copies large blocks.
+  /// N.B: Must only be used on functions that do not touch python objects; arguments are converted before, and return values after, the GIL is released.
+  const auto release_gil = py::call_guard<py::gil_scoped_release>();
+
   /// Constructs a ClientInterface using the ClientFactory
   std::shared_ptr<uhal::ClientInterface> buildClient(const std::string& aId, const std::string& aURI)
   {
@@ -173,6 +177,85 @@ namespace pycohal
     }
   };
 
+  /// Read-only view of the data in a validated ValVector, which exposes that data through python's buffer protocol without copying it
+  /// N.B: pybind11 cannot report errors from within a buffer request, so the ValVector is checked to be valid when the view is created; it cannot change once valid
+  template <class T>
+  struct ValVectorBuffer
+  {
+    explicit ValVectorBuffer ( const uhal::ValVector<T>& aValVector ) :
+      valVector ( aValVector ),
+      data ( getData ( aValVector ) )
+    {
+    }
+
+    /// Returns a pointer to the ValVector's data, throwing if it is not valid (as begin() does)
+    static const T* getData ( const uhal::ValVector<T>& aValVector )
+    {
+      typename uhal::ValVector<T>::const_iterator lBegin ( aValVector.begin() );
+      return aValVector.size() ? &*lBegin : NULL;
+    }
+
+    static py::buffer_info getBuffer ( const ValVectorBuffer<T>& aBuffer )
+    {
+      return py::buffer_info ( const_cast<T*> ( aBuffer.data ), sizeof ( T ), py::format_descriptor<T>::format(), 1, { py::ssize_t ( aBuffer.valVector.size() ) }, { py::ssize_t ( sizeof ( T ) ) }, true );
+    }
+
+    /// Copy of the ValVector, which shares its data and keeps it alive
+    const uhal::ValVector<T> valVector;
+    const T* const data;
+  };
+
+  /// Returns a read-only numpy array which shares the data of a ValVector<uint32_t> (numpy is only imported when this is first called)
+  py::object to_numpy ( const uhal::ValVector<uint32_t>& valVec )
+  {
+    py::object lBuffer = py::cast ( ValVectorBuffer<uint32_t> ( valVec ) );
+    return py::module_::import ( "numpy" ).attr ( "frombuffer" ) ( lBuffer, py::format_descriptor<uint32_t>::format() );
+  }
+
+  /// Returns whether a python buffer contains contiguous native-endian uint32 values, whatever its shape
+  bool is_contiguous_uint32 ( const py::buffer_info& aInfo )
+  {
+    std::string lFormat ( aInfo.format );
+
+    if ( ( lFormat.size() > 1 ) && ( ( lFormat[0] == '@' ) || ( lFormat[0] == '=' ) ) )
+    {
+      lFormat.erase ( 0, 1 );
+    }
+
+    if ( ( aInfo.itemsize != sizeof ( uint32_t ) ) || ( lFormat != py::format_descriptor<uint32_t>::format() ) )
+    {
+      return false;
+    }
+
+    py::ssize_t lStride = aInfo.itemsize;
+
+    for ( py::ssize_t i = aInfo.ndim - 1; i >= 0; i-- )
+    {
+      if ( ( aInfo.shape.at ( i ) != 1 ) && ( aInfo.strides.at ( i ) != lStride ) )
+      {
+        return false;
+      }
+
+      lStride *= aInfo.shape.at ( i );
+    }
+
+    return true;
+  }
+
+  /// Copies the contents of a python buffer (e.g. numpy array, array.array) into a vector; contiguous uint32 buffers are copied in one go, others are converted value by value as for lists
+  std::vector<uint32_t> buffer_to_vector ( const py::buffer& aBuffer )
+  {
+    const py::buffer_info lInfo ( aBuffer.request() );
+
+    if ( is_contiguous_uint32 ( lInfo ) )
+    {
+      const uint32_t* lData = static_cast<const uint32_t*> ( lInfo.ptr );
+      return std::vector<uint32_t> ( lData, lData + lInfo.size );
+    }
+
+    return aBuffer.cast< std::vector<uint32_t> >();
+  }
+
   std::string convert_to_string( const uhal::ValWord<uint32_t>& valWord )
   {
     return boost::lexical_cast<std::string>(valWord.value());
@@ -272,6 +355,14 @@ PYBIND11_MODULE(_core, m)
     .def ( "__getitem__", &pycohal::ValVectorIndexingSuite<uint32_t>::getItem , pycohal::const_ref_return_policy )
     .def ( "__getitem__", &pycohal::ValVectorIndexingSuite<uint32_t>::getSlice )
     .def ( "__iter__", [](const uhal::ValVector<uint32_t>& v) { return py::make_iterator ( v.begin() , v.end() ); })
+    .def ( "buffer", [](const uhal::ValVector<uint32_t>& v) { return pycohal::ValVectorBuffer<uint32_t> ( v ); } )
+    .def ( "numpy", pycohal::to_numpy )
+    ;
+
+  // Wrap pycohal::ValVectorBuffer<uint32_t>
+  py::class_<pycohal::ValVectorBuffer<uint32_t>>(m, "ValVectorBuffer_uint32", py::buffer_protocol())
+    .def_buffer ( &pycohal::ValVectorBuffer<uint32_t>::getBuffer )
+    .def ( "__len__", [](const pycohal::ValVectorBuffer<uint32_t>& b) { return b.valVector.size(); } )
     ;
 
   // Wrap uhal::Node
@@ -292,11 +383,13 @@ PYBIND11_MODULE(_core, m)
     .def ( "getDescription",  &uhal::Node::getDescription, pycohal::const_ref_return_policy )
     .def ( "getModule",       &uhal::Node::getModule,     pycohal::const_ref_return_policy )
     .def ( "write",           &uhal::Node::write )
-    .def ( "writeBlock",      &uhal::Node::writeBlock )
-    .def ( "writeBlockOffset",&uhal::Node::writeBlockOffset )
+    .def ( "writeBlock",      [](const uhal::Node& n, const py::buffer& b) { std::vector<uint32_t> v ( pycohal::buffer_to_vector ( b ) ); py::gil_scoped_release r; return n.writeBlock ( std::move ( v ) ); } )
+    .def ( "writeBlock",      static_cast<uhal::ValHeader ( uhal::Node::* ) ( const std::vector< uint32_t >& ) const>( &uhal::Node::writeBlock ), pycohal::release_gil )
+    .def ( "writeBlockOffset",[](const uhal::Node& n, const py::buffer& b, const uint32_t& o) { std::vector<uint32_t> v ( pycohal::buffer_to_vector ( b ) ); py::gil_scoped_release r; return n.writeBlockOffset ( v, o ); } )
+    .def ( "writeBlockOffset",&uhal::Node::writeBlockOffset, pycohal::release_gil )
     .def ( "read",            &uhal::Node::read )
-    .def ( "readBlock",       &uhal::Node::readBlock )
-    .def ( "readBlockOffset", &uhal::Node::readBlockOffset )
+    .def ( "readBlock",       static_cast<uhal::ValVector< uint32_t > ( uhal::Node::* ) ( const uint32_t& ) const>( &uhal::Node::readBlock ), pycohal::release_gil )
+    .def ( "readBlockOffset", &uhal::Node::readBlockOffset, pycohal::release_gil )
     .def ( "getClient",       &uhal::Node::getClient,     pycohal::norm_ref_return_policy )
     .def ( "__iter__", [](uhal::Node& n) { return py::make_iterator(n.begin(), n.end()); }, py::keep_alive<0, 1>())
     .def ( "__str__", &uhal::Node::getId, pycohal::const_ref_return_policy )
@@ -315,13 +408,15 @@ PYBIND11_MODULE(_core, m)
     .def ( "write", static_cast<uhal::ValHeader ( uhal::ClientInterface::* ) ( const uint32_t&, const uint32_t&, const uint32_t& )> ( &uhal::ClientInterface::write ) )
     .def ( "read", static_cast<uhal::ValWord<uint32_t> ( uhal::ClientInterface::* ) ( const uint32_t& )> ( &uhal::ClientInterface::read) )
     .def ( "read", static_cast<uhal::ValWord<uint32_t> ( uhal::ClientInterface::* ) ( const uint32_t&, const uint32_t& )> ( &uhal::ClientInterface::read ) )
-    .def ( "writeBlock", [](uhal::ClientInterface& c, const uint32_t& a, const std::vector< uint32_t >& v) { return c.writeBlock(a, v); } )
-    .def ( "writeBlock", static_cast<uhal::ValHeader ( uhal::ClientInterface::* ) ( const uint32_t&, const std::vector< uint32_t >& , const uhal::defs::BlockReadWriteMode&)>( &uhal::ClientInterface::writeBlock ) )
-    .def ( "readBlock", [](uhal::ClientInterface& c, const uint32_t& a, const uint32_t x) { return c.readBlock(a, x); } )
-    .def ( "readBlock", static_cast<uhal::ValVector<uint32_t> ( uhal::ClientInterface::* ) ( const uint32_t&, const uint32_t&, const uhal::defs::BlockReadWriteMode& )>( &uhal::ClientInterface::readBlock ) )
+    .def ( "writeBlock", [](uhal::ClientInterface& c, const uint32_t& a, const py::buffer& b) { std::vector<uint32_t> v ( pycohal::buffer_to_vector ( b ) ); py::gil_scoped_release r; return c.writeBlock(a, std::move(v)); } )
+    .def ( "writeBlock", [](uhal::ClientInterface& c, const uint32_t& a, const py::buffer& b, const uhal::defs::BlockReadWriteMode& m) { std::vector<uint32_t> v ( pycohal::buffer_to_vector ( b ) ); py::gil_scoped_release r; return c.writeBlock(a, std::move(v), m); } )
+    .def ( "writeBlock", [](uhal::ClientInterface& c, const uint32_t& a, const std::vector< uint32_t >& v) { return c.writeBlock(a, v); }, pycohal::release_gil )
+    .def ( "writeBlock", static_cast<uhal::ValHeader ( uhal::ClientInterface::* ) ( const uint32_t&, const std::vector< uint32_t >& , const uhal::defs::BlockReadWriteMode&)>( &uhal::ClientInterface::writeBlock ), pycohal::release_gil )
+    .def ( "readBlock", [](uhal::ClientInterface& c, const uint32_t& a, const uint32_t x) { return c.readBlock(a, x); }, pycohal::release_gil )
+    .def ( "readBlock", static_cast<uhal::ValVector<uint32_t> ( uhal::ClientInterface::* ) ( const uint32_t&, const uint32_t&, const uhal::defs::BlockReadWriteMode& )>( &uhal::ClientInterface::readBlock ), pycohal::release_gil )
     .def ( "rmw_bits", &uhal::ClientInterface::rmw_bits )
     .def ( "rmw_sum", &uhal::ClientInterface::rmw_sum )
-    .def ( "dispatch", &uhal::ClientInterface::dispatch )
+    .def ( "dispatch", &uhal::ClientInterface::dispatch, pycohal::release_gil )
     .def ( "setTimeoutPeriod", &uhal::ClientInterface::setTimeoutPeriod )
     .def ( "getTimeoutPeriod", &uhal::ClientInterface::getTimeoutPeriod )
     .def ( "__str__", &uhal::ClientInterface::id, pycohal::const_ref_return_policy )
@@ -349,7 +444,7 @@ PYBIND11_MODULE(_core, m)
     .def ( "getClient", &uhal::HwInterface::getClient, pycohal::norm_ref_return_policy )
     .def ( "uri", &uhal::HwInterface::uri, pycohal::const_ref_return_policy )
     .def ( "id",  &uhal::HwInterface::id, pycohal::const_ref_return_policy )
-    .def ( "dispatch", &uhal::HwInterface::dispatch )
+    .def ( "dispatch", &uhal::HwInterface::dispatch, pycohal::release_gil )
     .def ( "setTimeoutPeriod", &uhal::HwInterface::setTimeoutPeriod )
     .def ( "getTimeoutPeriod", &uhal::HwInterface::getTimeoutPeriod )
     .def ( "getNode", static_cast< const uhal::Node& ( uhal::HwInterface::* ) () const > ( &uhal::HwInterface::getNode ), pycohal::norm_ref_return_policy )
@@ -361,15 +456,15 @@ PYBIND11_MODULE(_core, m)
 
   // Wrap uhal::ConnectionManager
   py::class_< uhal::ConnectionManager > (m, "ConnectionManager")
-    .def ( py::init<const std::string&>() )
-    .def ( py::init<const std::string&, const std::vector<std::string>&>() )
-    .def ( "getDevice", static_cast< uhal::HwInterface ( uhal::ConnectionManager::* ) ( const std::string& ) > ( &uhal::ConnectionManager::getDevice ) )
+    .def ( py::init<const std::string&>(), pycohal::release_gil )
+    .def ( py::init<const std::string&, const std::vector<std::string>&>(), pycohal::release_gil )
+    .def ( "getDevice", static_cast< uhal::HwInterface ( uhal::ConnectionManager::* ) ( const std::string& ) > ( &uhal::ConnectionManager::getDevice ), pycohal::release_gil )
     .def ( "getDevices", static_cast< std::vector<std::string> ( uhal::ConnectionManager::* ) ()                   const > ( &uhal::ConnectionManager::getDevices ) )
     .def ( "getDevices", static_cast< std::vector<std::string> ( uhal::ConnectionManager::* ) ( const std::string& ) const > ( &uhal::ConnectionManager::getDevices ) )
     .def_static ( "clearAddressFileCache", &uhal::ConnectionManager::clearAddressFileCache )
     ;
 
-  m.def ( "getDevice", static_cast<uhal::HwInterface (* ) ( const std::string&, const std::string&, const std::string& ) > ( &uhal::ConnectionManager::getDevice ) );
-  m.def ( "getDevice", static_cast<uhal::HwInterface (* ) ( const std::string&, const std::string&, const std::string&, const std::vector<std::string>& ) > ( &uhal::ConnectionManager::getDevice ) );
+  m.def ( "getDevice", static_cast<uhal::HwInterface (* ) ( const std::string&, const std::string&, const std::string& ) > ( &uhal::ConnectionManager::getDevice ), pycohal::release_gil );
+  m.def ( "getDevice", static_cast<uhal::HwInterface (* ) ( const std::string&, const std::string&, const std::string&, const std::vector<std::string>& ) > ( &uhal::ConnectionManager::getDevice ), pycohal::release_gil );
 }
 
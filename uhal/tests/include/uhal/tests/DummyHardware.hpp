@@ -40,6 +40,7 @@
 #define _uhal_tests_DummyHardware_hpp_
 
 
+#include <atomic>
 #include <chrono>
 #include <deque>
 #include <vector>
@@ -55,7 +56,7 @@ namespace uhal
     //! The mask for the address space (size of the address space in one larger than this) 
     static const uint32_t ADDRESSMASK = 0x00FFFFFF;
     //! The size of the reply history for IPbus 2.0
-    static const uint32_t REPLY_HISTORY_DEPTH = 5;
+    static const uint32_t REPLY_HISTORY_DEPTH = 16;
     //! Size of the receive and reply buffers
     static const uint32_t BUFFER_SIZE = 100000;
   
@@ -64,7 +65,10 @@ namespace uhal
     class DummyHardwareInterface {
     public:
       DummyHardwareInterface(const std::chrono::microseconds& aReplyDelay) :
-        mReplyDelay(aReplyDelay)
+        mReplyDelay(aReplyDelay),
+        mRequestsToDrop(0),
+        mRepliesToDrop(0),
+        mReplyWordsToTruncate(0)
       {
       }
 
@@ -82,9 +86,36 @@ namespace uhal
           mReplyDelay = aDelay;
         }
 
+        //! Silently discard the next aCount IPbus 2.0 control packets, as if lost on the network before reaching the hardware
+        void dropRequests(uint32_t aCount)
+        {
+          mRequestsToDrop = aCount;
+        }
+
+        //! Handle the next aCount IPbus 2.0 control packets as normal, but discard their replies, as if lost on the network
+        void dropReplies(uint32_t aCount)
+        {
+          mRepliesToDrop = aCount;
+        }
+
+        //! Remove the last aNrWords words from the reply to the next IPbus 2.0 control packet, as if the hardware sent a short reply
+        void truncateNextReply(uint32_t aNrWords)
+        {
+          mReplyWordsToTruncate = aNrWords;
+        }
+
       protected:
         //! The delay in seconds between the request and reply of the first transaction
         std::chrono::microseconds mReplyDelay;
+
+        //! The number of upcoming control packets that will be discarded
+        std::atomic<uint32_t> mRequestsToDrop;
+
+        //! The number of upcoming control packets whose replies will be discarded
+        std::atomic<uint32_t> mRepliesToDrop;
+
+        //! The number of words that will be removed from the end of the next control packet's reply
+        std::atomic<uint32_t> mReplyWordsToTruncate;
     };
 
 
@@ -44,6 +44,7 @@
 // C++ headers
 #include <vector>
 #include <string>
+#include <utility>
 
 // Linux C++ headers
 #include <sys/time.h>
@@ -103,6 +104,15 @@ namespace uhal
         /// Typedef for a vector of raw client interfaces
         typedef std::vector< ClientPtr > ClientVec;
 
+        /// The types of transaction that can be used in the latency test workload
+        enum TransactionType { READ, WRITE, BLOCK_READ, BLOCK_WRITE, RMW_BITS, RMW_SUM };
+
+        /// A workload for the latency test, as a list of transaction types and their relative weights
+        typedef std::vector< std::pair< TransactionType, uint32_t > > Workload;
+
+        /// Latencies in nanoseconds, for each transaction type
+        typedef std::map< TransactionType, std::vector< uint64_t > > LatencyMap;
+
 
         // PRIVATE MEMBER VARIABLES
 
@@ -118,6 +128,10 @@ namespace uhal
         bool m_verbose;  ///< Verbosity true/false flag.
         bool m_perIterationDispatch; ///< Perform a network dispatch every iteration flag.
         bool m_includeConnect; ///< Include (e.g. TCP) connect time in reported bandwidth/latency
+        boost::uint32_t m_threads;  ///< Number of concurrent threads per device in the latency test, sharing the device's client
+        std::string m_workloadStr;  ///< Mix of transactions used in the latency test, as specified by the user
+        Workload m_workload;  ///< The m_workloadStr as parsed into transaction types and weights
+        std::string m_jsonFile;  ///< File to which the results are written as JSON ('-' for standard output); empty if JSON is not requested
 
 
         // PRIVATE MEMBER FUNCTIONS - Test infrastructure
@@ -140,6 +154,18 @@ namespace uhal
         /// Outputs a standard result set to screen - provide it with the number of seconds the test took.
         void outputStandardResults ( double totalSeconds ) const;
 
+        /// Writes the test settings and the given JSON-formatted results object to the JSON output file, if one was requested.
+        void outputJsonResults ( const std::string& results ) const;
+
+        /// Parses a workload specification (e.g. "read:4,blockwrite:1,rmwbits:1") into transaction types and weights; returns false if it is not valid.
+        static bool parseWorkload ( const std::string& workloadStr, Workload& workload );
+
+        /// Returns the name of a transaction type, as used in the workload specification
+        static const char* transactionName ( const TransactionType type );
+
+        /// Outputs a table of latency percentiles to screen, and returns them as a JSON-formatted object
+        static std::string summariseLatencies ( LatencyMap& latencies );
+
         /// Returns a random uint32_t in the range [0,maxSize], with 1/x probability distribution -- so that p(x=0) = p(2<=x<4) = p(2^n <= x < 2^n+1)
         static uint32_t getRandomBlockSize ( const uint32_t maxSize );
 
@@ -166,6 +192,7 @@ namespace uhal
         void bandwidthRxTest();  ///< Read bandwidth test
         void bandwidthTxTest();  ///< Write bandwidth test
         void validationTest();   ///< Historic basic firmware/software validation test
+        void latencyTest();      ///< Multi-threaded transaction latency test, with a mixed workload
 
     public:
 
@@ -63,6 +63,12 @@ public:
 
   void setReplyDelay (const std::chrono::microseconds& aDelay);
 
+  void dropRequests (uint32_t aCount);
+
+  void dropReplies (uint32_t aCount);
+
+  void truncateNextReply (uint32_t aNrWords);
+
 private:
   std::unique_ptr<DummyHardwareInterface> mHw;
   std::thread mHwThread;
@@ -0,0 +1,566 @@
+// Automatically generated by gen_uhal_register_header from dummy_address.xml
+
+#ifndef _uhal_registers_dummy_address_hpp_
+#define _uhal_registers_dummy_address_hpp_
+
+#include <stdint.h>
+
+#include "uhal/definitions.hpp"
+#include "uhal/RegisterAccessors.hpp"
+
+
+namespace dummy_address
+{
+  struct REG
+  {
+    static constexpr const char* path = "REG";
+    static constexpr uint32_t address = 0x00000001;
+    static constexpr uint32_t mask = 0xffffffff;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+    static constexpr uint32_t size = 0x1;
+  };
+
+  struct REG_READ_ONLY
+  {
+    static constexpr const char* path = "REG_READ_ONLY";
+    static constexpr uint32_t address = 0x00000002;
+    static constexpr uint32_t mask = 0xffffffff;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::READ;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+    static constexpr uint32_t size = 0x1;
+  };
+
+  struct REG_WRITE_ONLY
+  {
+    static constexpr const char* path = "REG_WRITE_ONLY";
+    static constexpr uint32_t address = 0x00000003;
+    static constexpr uint32_t mask = 0xffffffff;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::WRITE;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+    static constexpr uint32_t size = 0x1;
+  };
+
+  struct REG_UPPER_MASK
+  {
+    static constexpr const char* path = "REG_UPPER_MASK";
+    static constexpr uint32_t address = 0x00000004;
+    static constexpr uint32_t mask = 0xffff0000;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+    static constexpr uint32_t size = 0x1;
+  };
+
+  struct REG_LOWER_MASK
+  {
+    static constexpr const char* path = "REG_LOWER_MASK";
+    static constexpr uint32_t address = 0x00000004;
+    static constexpr uint32_t mask = 0x0000ffff;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+    static constexpr uint32_t size = 0x1;
+  };
+
+  struct REG_MASKED_READ_ONLY
+  {
+    static constexpr const char* path = "REG_MASKED_READ_ONLY";
+    static constexpr uint32_t address = 0x00000005;
+    static constexpr uint32_t mask = 0xffff0000;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::READ;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+    static constexpr uint32_t size = 0x1;
+  };
+
+  struct REG_MASKED_WRITE_ONLY
+  {
+    static constexpr const char* path = "REG_MASKED_WRITE_ONLY";
+    static constexpr uint32_t address = 0x00000005;
+    static constexpr uint32_t mask = 0x0000ffff;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::WRITE;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+    static constexpr uint32_t size = 0x1;
+  };
+
+  struct REG_PARS
+  {
+    static constexpr const char* path = "REG_PARS";
+    static constexpr uint32_t address = 0x00000006;
+    static constexpr uint32_t mask = 0xffffffff;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+    static constexpr uint32_t size = 0x1;
+  };
+
+  struct REG_OUT_OF_ORDER
+  {
+    static constexpr const char* path = "REG_OUT_OF_ORDER";
+    static constexpr uint32_t address = 0x00000006;
+    static constexpr uint32_t mask = 0xffffffff;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+    static constexpr uint32_t size = 0x1;
+  };
+
+  struct FIFO
+  {
+    static constexpr const char* path = "FIFO";
+    static constexpr uint32_t address = 0x00000100;
+    static constexpr uint32_t mask = 0xffffffff;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::NON_INCREMENTAL;
+    static constexpr uint32_t size = 0x10000000;
+  };
+
+  //! A block memory in an example XML file
+  struct MEM
+  {
+    static constexpr const char* path = "MEM";
+    static constexpr uint32_t address = 0x00100000;
+    static constexpr uint32_t mask = 0xffffffff;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::INCREMENTAL;
+    static constexpr uint32_t size = 0x40000;
+  };
+
+  struct SUBSYSTEM1
+  {
+    static constexpr const char* path = "SUBSYSTEM1";
+    static constexpr uint32_t address = 0x00210001;
+    static constexpr uint32_t mask = 0xffffffff;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::HIERARCHICAL;
+    static constexpr uint32_t size = 0x1;
+
+    struct REG
+    {
+      static constexpr const char* path = "SUBSYSTEM1.REG";
+      static constexpr uint32_t address = 0x00210002;
+      static constexpr uint32_t mask = 0xffffffff;
+      static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+      static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+      static constexpr uint32_t size = 0x1;
+    };
+
+    struct MEM
+    {
+      static constexpr const char* path = "SUBSYSTEM1.MEM";
+      static constexpr uint32_t address = 0x00210003;
+      static constexpr uint32_t mask = 0xffffffff;
+      static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+      static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::INCREMENTAL;
+      static constexpr uint32_t size = 0x40000;
+    };
+
+    struct SUBMODULE
+    {
+      static constexpr const char* path = "SUBSYSTEM1.SUBMODULE";
+      static constexpr uint32_t address = 0x00270001;
+      static constexpr uint32_t mask = 0xffffffff;
+      static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+      static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::HIERARCHICAL;
+      static constexpr uint32_t size = 0x1;
+
+      struct REG
+      {
+        static constexpr const char* path = "SUBSYSTEM1.SUBMODULE.REG";
+        static constexpr uint32_t address = 0x00270002;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct MEM
+      {
+        static constexpr const char* path = "SUBSYSTEM1.SUBMODULE.MEM";
+        static constexpr uint32_t address = 0x00270003;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::INCREMENTAL;
+        static constexpr uint32_t size = 0x100;
+      };
+    };
+  };
+
+  struct SUBSYSTEM2
+  {
+    static constexpr const char* path = "SUBSYSTEM2";
+    static constexpr uint32_t address = 0x00310001;
+    static constexpr uint32_t mask = 0xffffffff;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::HIERARCHICAL;
+    static constexpr uint32_t size = 0x1;
+
+    struct REG
+    {
+      static constexpr const char* path = "SUBSYSTEM2.REG";
+      static constexpr uint32_t address = 0x00310002;
+      static constexpr uint32_t mask = 0xffffffff;
+      static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+      static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+      static constexpr uint32_t size = 0x1;
+    };
+
+    struct MEM
+    {
+      static constexpr const char* path = "SUBSYSTEM2.MEM";
+      static constexpr uint32_t address = 0x00310003;
+      static constexpr uint32_t mask = 0xffffffff;
+      static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+      static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::INCREMENTAL;
+      static constexpr uint32_t size = 0x40000;
+    };
+
+    struct SUBMODULE
+    {
+      static constexpr const char* path = "SUBSYSTEM2.SUBMODULE";
+      static constexpr uint32_t address = 0x00370001;
+      static constexpr uint32_t mask = 0xffffffff;
+      static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+      static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::HIERARCHICAL;
+      static constexpr uint32_t size = 0x1;
+
+      struct REG
+      {
+        static constexpr const char* path = "SUBSYSTEM2.SUBMODULE.REG";
+        static constexpr uint32_t address = 0x00370002;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct MEM
+      {
+        static constexpr const char* path = "SUBSYSTEM2.SUBMODULE.MEM";
+        static constexpr uint32_t address = 0x00370003;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::INCREMENTAL;
+        static constexpr uint32_t size = 0x100;
+      };
+    };
+  };
+
+  struct SMALL_MEM
+  {
+    static constexpr const char* path = "SMALL_MEM";
+    static constexpr uint32_t address = 0x00400000;
+    static constexpr uint32_t mask = 0xffffffff;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::INCREMENTAL;
+    static constexpr uint32_t size = 0x100;
+  };
+
+  struct SUBSYSTEM3
+  {
+    static constexpr const char* path = "SUBSYSTEM3";
+    static constexpr uint32_t address = 0x00600000;
+    static constexpr uint32_t mask = 0xffffffff;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::HIERARCHICAL;
+    static constexpr uint32_t size = 0x1;
+
+    struct DERIVEDNODE
+    {
+      static constexpr const char* path = "SUBSYSTEM3.DERIVEDNODE";
+      static constexpr uint32_t address = 0x00600000;
+      static constexpr uint32_t mask = 0xffffffff;
+      static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+      static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::HIERARCHICAL;
+      static constexpr uint32_t size = 0x1;
+
+      struct REG
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDNODE.REG";
+        static constexpr uint32_t address = 0x00600001;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct REG_WRITE_ONLY
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDNODE.REG_WRITE_ONLY";
+        static constexpr uint32_t address = 0x00600003;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::WRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct REG_UPPER_MASK
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDNODE.REG_UPPER_MASK";
+        static constexpr uint32_t address = 0x00600004;
+        static constexpr uint32_t mask = 0xffff0000;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct REG_LOWER_MASK
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDNODE.REG_LOWER_MASK";
+        static constexpr uint32_t address = 0x00600004;
+        static constexpr uint32_t mask = 0x0000ffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+    };
+
+    struct BADNODE
+    {
+      static constexpr const char* path = "SUBSYSTEM3.BADNODE";
+      static constexpr uint32_t address = 0x00600100;
+      static constexpr uint32_t mask = 0xffffffff;
+      static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+      static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::HIERARCHICAL;
+      static constexpr uint32_t size = 0x1;
+
+      struct REG
+      {
+        static constexpr const char* path = "SUBSYSTEM3.BADNODE.REG";
+        static constexpr uint32_t address = 0x00600101;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct REG_WRITE_ONLY
+      {
+        static constexpr const char* path = "SUBSYSTEM3.BADNODE.REG_WRITE_ONLY";
+        static constexpr uint32_t address = 0x00600103;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::WRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct REG_UPPER_MASK
+      {
+        static constexpr const char* path = "SUBSYSTEM3.BADNODE.REG_UPPER_MASK";
+        static constexpr uint32_t address = 0x00600104;
+        static constexpr uint32_t mask = 0xffff0000;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct REG_LOWER_MASK
+      {
+        static constexpr const char* path = "SUBSYSTEM3.BADNODE.REG_LOWER_MASK";
+        static constexpr uint32_t address = 0x00600104;
+        static constexpr uint32_t mask = 0x0000ffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+    };
+
+    struct DERIVEDMODULE1
+    {
+      static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE1";
+      static constexpr uint32_t address = 0x00610010;
+      static constexpr uint32_t mask = 0xffffffff;
+      static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+      static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::HIERARCHICAL;
+      static constexpr uint32_t size = 0x1;
+
+      struct REG
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE1.REG";
+        static constexpr uint32_t address = 0x00610011;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct MEM
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE1.MEM";
+        static constexpr uint32_t address = 0x00610012;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::INCREMENTAL;
+        static constexpr uint32_t size = 0x40000;
+      };
+    };
+
+    struct DERIVEDMODULE2
+    {
+      static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE2";
+      static constexpr uint32_t address = 0x00610030;
+      static constexpr uint32_t mask = 0xffffffff;
+      static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+      static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::HIERARCHICAL;
+      static constexpr uint32_t size = 0x1;
+
+      struct REG
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE2.REG";
+        static constexpr uint32_t address = 0x00610031;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct REG_WRITE_ONLY
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE2.REG_WRITE_ONLY";
+        static constexpr uint32_t address = 0x00610033;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::WRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct REG_UPPER_MASK
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE2.REG_UPPER_MASK";
+        static constexpr uint32_t address = 0x00610034;
+        static constexpr uint32_t mask = 0xffff0000;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct REG_LOWER_MASK
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE2.REG_LOWER_MASK";
+        static constexpr uint32_t address = 0x00610034;
+        static constexpr uint32_t mask = 0x0000ffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+    };
+
+    struct DERIVEDMODULE3
+    {
+      static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE3";
+      static constexpr uint32_t address = 0x00610050;
+      static constexpr uint32_t mask = 0xffffffff;
+      static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+      static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::HIERARCHICAL;
+      static constexpr uint32_t size = 0x1;
+
+      struct REG
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE3.REG";
+        static constexpr uint32_t address = 0x00610051;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct REG_WRITE_ONLY
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE3.REG_WRITE_ONLY";
+        static constexpr uint32_t address = 0x00610053;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::WRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct REG_UPPER_MASK
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE3.REG_UPPER_MASK";
+        static constexpr uint32_t address = 0x00610054;
+        static constexpr uint32_t mask = 0xffff0000;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct REG_LOWER_MASK
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE3.REG_LOWER_MASK";
+        static constexpr uint32_t address = 0x00610054;
+        static constexpr uint32_t mask = 0x0000ffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+    };
+
+    struct DERIVEDMODULE4
+    {
+      static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE4";
+      static constexpr uint32_t address = 0x00610070;
+      static constexpr uint32_t mask = 0xffffffff;
+      static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+      static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::HIERARCHICAL;
+      static constexpr uint32_t size = 0x1;
+
+      struct REG
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE4.REG";
+        static constexpr uint32_t address = 0x00610071;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct REG_WRITE_ONLY
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE4.REG_WRITE_ONLY";
+        static constexpr uint32_t address = 0x00610073;
+        static constexpr uint32_t mask = 0xffffffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::WRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct REG_UPPER_MASK
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE4.REG_UPPER_MASK";
+        static constexpr uint32_t address = 0x00610074;
+        static constexpr uint32_t mask = 0xffff0000;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+
+      struct REG_LOWER_MASK
+      {
+        static constexpr const char* path = "SUBSYSTEM3.DERIVEDMODULE4.REG_LOWER_MASK";
+        static constexpr uint32_t address = 0x00610074;
+        static constexpr uint32_t mask = 0x0000ffff;
+        static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+        static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+        static constexpr uint32_t size = 0x1;
+      };
+    };
+  };
+
+  struct IPBUS_ENDPOINT
+  {
+    static constexpr const char* path = "IPBUS_ENDPOINT";
+    static constexpr uint32_t address = 0x00700000;
+    static constexpr uint32_t mask = 0xffffffff;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+    static constexpr uint32_t size = 0x1;
+  };
+
+  struct LARGE_MEM
+  {
+    static constexpr const char* path = "LARGE_MEM";
+    static constexpr uint32_t address = 0x01000000;
+    static constexpr uint32_t mask = 0xffffffff;
+    static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+    static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::INCREMENTAL;
+    static constexpr uint32_t size = 0x1900000;
+  };
+}
+
+#endif
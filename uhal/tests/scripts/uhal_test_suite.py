@@ -48,6 +48,11 @@ def get_commands(conn_file, controlhub_scripts_dir, uhal_tools_template_vhdl):
     if not conn_file.startswith("file://"):
         conn_file = "file://" + conn_file
 
+    # Register header generated from dummy_address.xml, against which the register accessor tests are compiled
+    tests_etc_dir = os.path.dirname(conn_file[len("file://"):])
+    dummy_address_file = join(tests_etc_dir, 'dummy_address.xml')
+    dummy_address_header = os.path.normpath(join(tests_etc_dir, '..', '..', '..', 'include', 'uhal', 'tests', 'uhal_registers_dummy_address.hpp'))
+
     if controlhub_scripts_dir is None:
         if "centos-7" in platform.platform():
             controlhub_start  = "sudo systemctl start controlhub"
@@ -74,6 +79,10 @@ def get_commands(conn_file, controlhub_scripts_dir, uhal_tools_template_vhdl):
               ]
             ]]
 
+    cmds += [["TEST LOGGING",
+              ["run_uhal_tests.exe -c %s --run_test=logging --log_level=test_suite" % (conn_file)]
+            ]]
+
     cmds += [["TEST IPBUS 1.3 UDP",
               ["run_uhal_tests.exe -c %s --run_test=ipbusudp_1_3 --log_level=test_suite" % (conn_file)]
             ]]
@@ -144,6 +153,10 @@ def get_commands(conn_file, controlhub_scripts_dir, uhal_tools_template_vhdl):
               ["run_uhal_tests.exe -c %s --run_test=ipbuspcie_2_0 --log_level=test_suite" % (conn_file)]
             ]]
 
+    cmds += [["TEST IPBUS 2.0 MMAP",
+              ["run_uhal_tests.exe -c %s --run_test=ipbusmmap_2_0 --log_level=test_suite" % (conn_file)]
+            ]]
+
     cmds += [["TEST PYCOHAL",
               ["DummyHardwareUdp.exe --version 1 --port 50001",
                sys.executable + " $(which test_pycohal) -c %s -v" % (conn_file),
@@ -157,6 +170,9 @@ def get_commands(conn_file, controlhub_scripts_dir, uhal_tools_template_vhdl):
     cmds += [["TEST uHAL TOOLS",
               [#uhal.tools.ipbus_addr_map
                sys.executable + " $(which gen_ipbus_addr_decode) -t %s %s" % (uhal_tools_template_vhdl, join(os.path.split(uhal_tools_template_vhdl)[0],'addr_table.xml')),
+               #uhal.tools.register_header
+               sys.executable + " $(which gen_uhal_register_header) --no-timestamp %s" % (dummy_address_file),
+               "diff uhal_registers_dummy_address.hpp %s" % (dummy_address_header),
               ]
             ]]
 
@@ -33,6 +33,7 @@
 #include "uhal/tests/DummyHardware.hpp"
 
 
+#include <algorithm>
 #include <chrono>
 #include <deque>
 #include <thread>
@@ -92,6 +93,13 @@ namespace uhal
             *lIt = ntohl ( *lIt );
           }
         }
+
+        if ( ( mRequestsToDrop > 0 ) && ( ( *mReceive.begin() & 0xF00000FF ) == 0x200000F0 ) )
+        {
+          mRequestsToDrop--;
+          log ( Notice() , "Dummy hardware dropping control packet with header " , Integer ( *mReceive.begin() , IntFmt<hex,fixed>() ) );
+          return;
+        }
       }
 
       std::vector<uint32_t>::const_iterator lBegin, lEnd;
@@ -122,6 +130,19 @@ namespace uhal
       {
         mReplyHistory.push_back ( std::make_pair ( base_type::mPacketCounter , mReply ) );
         mReplyHistory.pop_front();
+
+        if ( mRepliesToDrop > 0 )
+        {
+          mRepliesToDrop--;
+          log ( Notice() , "Dummy hardware dropping reply to control packet with ID " , Integer ( base_type::mPacketCounter ) );
+          mReply.clear();
+        }
+        else if ( mReplyWordsToTruncate > 0 )
+        {
+          const size_t lNrWords ( std::min< size_t > ( mReplyWordsToTruncate.exchange ( 0 ) , mReply.size() - 1 ) );
+          log ( Notice() , "Dummy hardware removing last " , Integer ( lNrWords ) , " words from reply to control packet with ID " , Integer ( base_type::mPacketCounter ) );
+          mReply.resize ( mReply.size() - lNrWords );
+        }
       }
 
       if ( mReplyDelay > std::chrono::microseconds(0) )
@@ -35,9 +35,17 @@
 #include "uhal/tests/PerfTester.hxx"
 
 // C++ headers
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <future>
 #include <iostream>
 #include <iomanip>
+#include <random>
 #include <sstream>
+#include <stdexcept>
+#include <thread>
 #include <cstdlib>
 #include <unistd.h>
 
@@ -54,6 +62,49 @@ namespace po = boost::program_options;
 using namespace std;
 
 
+namespace
+{
+  /// Returns a string as a quoted JSON string
+  string jsonString ( const string& value )
+  {
+    ostringstream oss;
+    oss << '"';
+
+    for ( const char c: value )
+    {
+      if ( c == '"' || c == '\\' )
+      {
+        oss << '\\' << c;
+      }
+      else if ( static_cast<unsigned char> ( c ) < 0x20 )
+      {
+        oss << "\\u" << std::hex << setw ( 4 ) << setfill ( '0' ) << int ( c ) << std::dec << setfill ( ' ' );
+      }
+      else
+      {
+        oss << c;
+      }
+    }
+
+    oss << '"';
+    return oss.str();
+  }
+
+  /// Returns a number as a JSON value (null if it is not finite)
+  string jsonNumber ( double value )
+  {
+    if ( ! std::isfinite ( value ) )
+    {
+      return "null";
+    }
+
+    ostringstream oss;
+    oss << setprecision ( 12 ) << value;
+    return oss.str();
+  }
+}
+
+
 // PUBLIC METHODS
 
 uhal::tests::PerfTester::PerfTester() :
@@ -68,7 +119,11 @@ uhal::tests::PerfTester::PerfTester() :
   m_bandwidthTestDepth ( 0 ),
   m_verbose ( false ),
   m_perIterationDispatch ( false ),
-  m_includeConnect ( false )
+  m_includeConnect ( false ),
+  m_threads ( 1 ),
+  m_workloadStr ( "read" ),
+  m_workload(),
+  m_jsonFile()
 {
   // ***** DECLARE TESTS HERE - descriptions should not be longer than a shortish line. *****:
   // Receive bandwidth test
@@ -80,6 +135,9 @@ uhal::tests::PerfTester::PerfTester() :
   // Validation test
   m_testFuncMap["Validation"] = &PerfTester::validationTest;
   m_testDescMap["Validation"] = "For validating downstream subsystems, such as the Control Hub or the IPbus firmware.";
+  // Latency test
+  m_testFuncMap["Latency"] = &PerfTester::latencyTest;
+  m_testDescMap["Latency"] = "Concurrent threads dispatching a mix of transactions (-n, -m) to find latency percentiles.";
   // Sandbox test
   m_testFuncMap["Sandbox"] = &PerfTester::sandbox;
   m_testDescMap["Sandbox"] = "A user-definable test - modify the sandbox() function to whatever you wish.";
@@ -105,7 +163,10 @@ int uhal::tests::PerfTester::run ( int argc, char* argv[] )
     ( "baseAddr,b", po::value<string> ( &m_baseAddrStr )->default_value ( "0x0" ), "Base address (in hex) of the test location on the target device(s)." )
     ( "bandwidthTestDepth,w", po::value<boost::uint32_t> ( &m_bandwidthTestDepth )->default_value ( 340 ), "Depth of read/write used in bandwidth tests." )
     ( "perIterationDispatch,p", "Force a network dispatch every test iteration instead of the default single dispatch call at the end." )
-    ( "includeConnect,c", "Include connect time in reported bandwidths and latencies" );
+    ( "includeConnect,c", "Include connect time in reported bandwidths and latencies" )
+    ( "threads,n", po::value<boost::uint32_t> ( &m_threads )->default_value ( 1 ), "Number of threads per device in the latency test; threads for the same device share its client, and use it concurrently." )
+    ( "workload,m", po::value<string> ( &m_workloadStr )->default_value ( "read" ), "Mix of transactions in the latency test, as comma-separated types with optional weights, e.g. 'read:4,blockwrite:1,rmwbits:1'. Types: read, write, blockread, blockwrite, rmwbits, rmwsum." )
+    ( "json,j", po::value<string> ( &m_jsonFile ), "Also write the settings and results as JSON to this file ('-' for standard output)." );
     po::variables_map argMap;
     po::store ( po::parse_command_line ( argc, argv, argDescriptions ), argMap );
     po::notify ( argMap );
@@ -150,6 +211,12 @@ int uhal::tests::PerfTester::run ( int argc, char* argv[] )
       m_includeConnect = true;
     }
 
+    if ( ! parseWorkload ( m_workloadStr, m_workload ) )
+    {
+      cerr << "The workload '" << m_workloadStr << "' is not valid!" << endl;
+      return 40;
+    }
+
     if ( badInput() )
     {
       return 40;    // Report bad user input and exit if necessary.
@@ -185,7 +252,8 @@ void uhal::tests::PerfTester::outputHelpText ( const string& argDescriptions ) c
        <<  argDescriptions
        <<  "Usage examples:\n\n"
        "  PerfTester.exe -t BandwidthTx -b 0xf0 -d ipbusudp-1.3://localhost:50001 ipbusudp-1.3://localhost:50002\n"
-       "  PerfTester.exe -t BandwidthTx -w 5 -i 100 chtcp-1.3://localhost:10203?target=127.0.0.1:50001" << endl;
+       "  PerfTester.exe -t BandwidthTx -w 5 -i 100 chtcp-1.3://localhost:10203?target=127.0.0.1:50001\n"
+       "  PerfTester.exe -t Latency -n 4 -m read:4,blockread:1,rmwbits:1 -j results.json -d ipbusudp-2.0://localhost:50001" << endl;
   outputTestDescriptionsList();
 }
 
@@ -221,6 +289,12 @@ bool uhal::tests::PerfTester::badInput() const
     return true;
   }
 
+  if ( m_threads == 0 )
+  {
+    cerr << "The number of threads per device must be at least 1!" << endl;
+    return true;
+  }
+
   return false;
 }
 
@@ -231,8 +305,15 @@ void uhal::tests::PerfTester::outputUserChoices() const
        << "  Test Name  -------------->  " << m_testName << endl
        << "  Test register addr  ----->  " << std::hex << showbase << m_baseAddr << noshowbase << std::dec << endl
        << "  Test iterations  -------->  " << m_iterations << endl
-       << "  Per-iteration dispatch -->  " << ( m_perIterationDispatch?"Yes":"No" ) << endl
-       << "  Device URIs:" << endl;
+       << "  Per-iteration dispatch -->  " << ( m_perIterationDispatch?"Yes":"No" ) << endl;
+
+  if ( m_testName == "Latency" )
+  {
+    cout << "  Threads per device  ----->  " << m_threads << endl
+         << "  Workload  --------------->  " << m_workloadStr << endl;
+  }
+
+  cout << "  Device URIs:" << endl;
   StringVec::const_iterator iDevice = m_deviceURIs.begin(), iDeviceEnd = m_deviceURIs.end();
 
   for ( ; iDevice != iDeviceEnd ; ++iDevice )
@@ -283,6 +364,177 @@ void uhal::tests::PerfTester::outputStandardResults ( double totalSeconds ) cons
 }
 
 
+void uhal::tests::PerfTester::outputJsonResults ( const string& results ) const
+{
+  if ( m_jsonFile.empty() )
+  {
+    return;
+  }
+
+  ostringstream oss;
+  oss << "{\n"
+      << "  \"test\": " << jsonString ( m_testName ) << ",\n"
+      << "  \"settings\": {\n"
+      << "    \"devices\": [";
+
+  for ( size_t iURI = 0; iURI < m_deviceURIs.size(); ++iURI )
+  {
+    oss << ( iURI ? ", " : "" ) << jsonString ( m_deviceURIs.at ( iURI ) );
+  }
+
+  oss << "],\n"
+      << "    \"iterations\": " << m_iterations << ",\n"
+      << "    \"baseAddr\": " << m_baseAddr << ",\n"
+      << "    \"depth\": " << m_bandwidthTestDepth << ",\n"
+      << "    \"perIterationDispatch\": " << ( m_perIterationDispatch ? "true" : "false" ) << ",\n"
+      << "    \"includeConnect\": " << ( m_includeConnect ? "true" : "false" ) << ",\n"
+      << "    \"threads\": " << m_threads << ",\n"
+      << "    \"workload\": " << jsonString ( m_workloadStr ) << "\n"
+      << "  },\n"
+      << "  \"results\": " << results << "\n"
+      << "}\n";
+
+  if ( m_jsonFile == "-" )
+  {
+    cout << oss.str() << flush;
+  }
+  else
+  {
+    ofstream file ( m_jsonFile.c_str() );
+    file << oss.str();
+
+    if ( ! file )
+    {
+      cerr << "Failed to write JSON results to '" << m_jsonFile << "'" << endl;
+    }
+  }
+}
+
+
+bool uhal::tests::PerfTester::parseWorkload ( const string& workloadStr, Workload& workload )
+{
+  static const TransactionType types[] = { READ, WRITE, BLOCK_READ, BLOCK_WRITE, RMW_BITS, RMW_SUM };
+  workload.clear();
+  istringstream iss ( workloadStr );
+  string item;
+
+  while ( getline ( iss, item, ',' ) )
+  {
+    const size_t colon = item.find ( ':' );
+    const string name = item.substr ( 0, colon );
+    uint32_t weight = 1;
+
+    if ( colon != string::npos )
+    {
+      istringstream convert ( item.substr ( colon + 1 ) );
+
+      if ( ! ( convert >> weight ) || ! convert.eof() )
+      {
+        return false;
+      }
+    }
+
+    const TransactionType* type = std::find_if ( types, types + 6, [&name] ( const TransactionType t ) { return name == transactionName ( t ); } );
+
+    if ( type == types + 6 )
+    {
+      return false;
+    }
+
+    if ( weight > 0 )
+    {
+      workload.push_back ( std::make_pair ( *type, weight ) );
+    }
+  }
+
+  return ! workload.empty();
+}
+
+
+const char* uhal::tests::PerfTester::transactionName ( const TransactionType type )
+{
+  switch ( type )
+  {
+    case READ: return "read";
+    case WRITE: return "write";
+    case BLOCK_READ: return "blockread";
+    case BLOCK_WRITE: return "blockwrite";
+    case RMW_BITS: return "rmwbits";
+    case RMW_SUM: return "rmwsum";
+  }
+
+  return "unknown";
+}
+
+
+string uhal::tests::PerfTester::summariseLatencies ( LatencyMap& latencies )
+{
+  // Summarise each transaction type, and then all of them together
+  std::vector< std::pair< string, std::vector<uint64_t>* > > rows;
+  std::vector<uint64_t> all;
+
+  for ( LatencyMap::iterator it = latencies.begin(); it != latencies.end(); ++it )
+  {
+    rows.push_back ( std::make_pair ( string ( transactionName ( it->first ) ), &it->second ) );
+    all.insert ( all.end(), it->second.begin(), it->second.end() );
+  }
+
+  rows.push_back ( std::make_pair ( string ( "all" ), &all ) );
+
+  cout << "  " << setw ( 12 ) << left << "Transaction" << right
+       << setw ( 10 ) << "Count" << setw ( 12 ) << "Mean/us" << setw ( 12 ) << "p50/us"
+       << setw ( 12 ) << "p99/us" << setw ( 12 ) << "p999/us" << setw ( 12 ) << "Max/us" << endl;
+
+  const streamsize coutPrecision = cout.precision();
+  ostringstream json;
+  json << "{";
+
+  for ( size_t iRow = 0; iRow < rows.size(); ++iRow )
+  {
+    std::vector<uint64_t>& samples = *rows.at ( iRow ).second;
+    std::sort ( samples.begin(), samples.end() );
+    double sum = 0;
+
+    for ( const uint64_t sample: samples )
+    {
+      sum += sample;
+    }
+
+    // Nearest-rank percentiles, in microseconds
+    auto percentile = [&samples] ( double fraction ) {
+      if ( samples.empty() )
+      {
+        return 0.0;
+      }
+
+      const size_t rank = std::max ( size_t ( std::ceil ( fraction * samples.size() ) ), size_t ( 1 ) );
+      return samples.at ( rank - 1 ) / 1000.;
+    };
+
+    const double mean = samples.empty() ? 0 : sum / samples.size() / 1000.;
+
+    cout << "  " << setw ( 12 ) << left << rows.at ( iRow ).first << right << std::fixed << setprecision ( 1 )
+         << setw ( 10 ) << samples.size() << setw ( 12 ) << mean << setw ( 12 ) << percentile ( 0.5 )
+         << setw ( 12 ) << percentile ( 0.99 ) << setw ( 12 ) << percentile ( 0.999 ) << setw ( 12 ) << percentile ( 1 ) << endl;
+    cout.unsetf ( ios_base::floatfield );
+    cout.precision ( coutPrecision );
+
+    json << ( iRow ? ", " : "" ) << jsonString ( rows.at ( iRow ).first ) << ": {"
+         << "\"count\": " << samples.size() << ", "
+         << "\"meanUs\": " << jsonNumber ( mean ) << ", "
+         << "\"minUs\": " << jsonNumber ( samples.empty() ? 0 : samples.front() / 1000. ) << ", "
+         << "\"p50Us\": " << jsonNumber ( percentile ( 0.5 ) ) << ", "
+         << "\"p90Us\": " << jsonNumber ( percentile ( 0.9 ) ) << ", "
+         << "\"p99Us\": " << jsonNumber ( percentile ( 0.99 ) ) << ", "
+         << "\"p999Us\": " << jsonNumber ( percentile ( 0.999 ) ) << ", "
+         << "\"maxUs\": " << jsonNumber ( percentile ( 1 ) ) << "}";
+  }
+
+  json << "}";
+  return json.str();
+}
+
+
 bool uhal::tests::PerfTester::buffersEqual ( const U32Vec& writeBuffer, const U32ValVec& readBuffer ) const
 {
   return std::equal ( readBuffer.begin(), readBuffer.end(), writeBuffer.begin() );
@@ -315,6 +567,8 @@ void uhal::tests::PerfTester::bandwidthRxTest()
   cout << "Read depth used each iteration  = " << m_bandwidthTestDepth << " 32-bit words\n"
        << "Total IPbus payload received    = " << totalPayloadKB << " KB\n"
        << "Average read bandwidth          = " << dataRateKB_s << " KB/s" << endl;
+  outputJsonResults ( "{\"totalSeconds\": " + jsonNumber ( totalSeconds ) + ", \"iterationFrequencyHz\": " + jsonNumber ( m_iterations / totalSeconds ) +
+                      ", \"payloadKB\": " + jsonNumber ( totalPayloadKB ) + ", \"bandwidthKBps\": " + jsonNumber ( dataRateKB_s ) + "}" );
 }
 
 
@@ -342,6 +596,8 @@ void uhal::tests::PerfTester::bandwidthTxTest()
   cout << "Write depth used each iteration = " << m_bandwidthTestDepth << " 32-bit words\n"
        << "Total IPbus payload sent        = " << totalPayloadKB << " KB\n"
        << "Average write bandwidth         = " << dataRateKB_s << " KB/s" << endl;
+  outputJsonResults ( "{\"totalSeconds\": " + jsonNumber ( totalSeconds ) + ", \"iterationFrequencyHz\": " + jsonNumber ( m_iterations / totalSeconds ) +
+                      ", \"payloadKB\": " + jsonNumber ( totalPayloadKB ) + ", \"bandwidthKBps\": " + jsonNumber ( dataRateKB_s ) + "}" );
 }
 
 
@@ -351,11 +607,197 @@ void uhal::tests::PerfTester::validationTest()
   for (const auto& c: m_clients)
     lClients.push_back(&*c);
 
-  if (not runValidationTest(lClients, m_baseAddr, m_bandwidthTestDepth, m_iterations, m_perIterationDispatch, m_verbose) )
+  const bool passed = runValidationTest(lClients, m_baseAddr, m_bandwidthTestDepth, m_iterations, m_perIterationDispatch, m_verbose);
+  outputJsonResults ( string ( "{\"passed\": " ) + ( passed ? "true" : "false" ) + "}" );
+
+  if (not passed)
     std::exit( 1 );
 }
 
 
+void uhal::tests::PerfTester::latencyTest()
+{
+  if ( ! m_includeConnect )
+  {
+    for ( ClientPtr& iClient: m_clients )
+    {
+      iClient->read ( m_baseAddr );
+      iClient->dispatch();
+    }
+  }
+
+  // Each thread records its own latencies, which are merged once all threads have finished
+  const size_t nThreads = m_clients.size() * m_threads;
+  // Threads for the same device queue and dispatch their transactions through its client concurrently, so a transaction
+  // may be sent in the same packet as those of other threads, and by another thread's dispatch. Each transaction is
+  // therefore timed until its reply becomes valid, rather than until the thread's own dispatch completes.
+  // (Separate clients for the same device cannot be used instead, since e.g. IPbus 2.0 targets have a single packet ID
+  // sequence, and PCIe/mmap clients assume that they are the only client using the device's pages.)
+  std::vector< LatencyMap > threadLatencies ( nThreads );
+  std::vector< uint64_t > threadErrors ( nThreads, 0 );
+  std::vector< string > threadErrorMessages ( nThreads );
+  const U32Vec writeBuffer = getRandomBuffer ( m_bandwidthTestDepth );
+  std::promise<void> startSignal;
+  std::shared_future<void> start = startSignal.get_future().share();
+  std::vector< std::thread > threads;
+
+  for ( size_t iThread = 0; iThread < nThreads; ++iThread )
+  {
+    threads.push_back ( std::thread ( [&, iThread, start] () {
+      ClientInterface& client = *m_clients.at ( iThread / m_threads );
+      LatencyMap& latencies = threadLatencies.at ( iThread );
+      // Seed each thread differently, but reproducibly, so that runs can be compared
+      std::mt19937 generator ( iThread + 1 );
+      std::vector<double> weights;
+
+      for ( const auto& item: m_workload )
+      {
+        weights.push_back ( item.second );
+      }
+
+      std::discrete_distribution<size_t> chooser ( weights.begin(), weights.end() );
+      start.wait();
+
+      for ( uint64_t i = 0; i < m_iterations; ++i )
+      {
+        const TransactionType type = m_workload.at ( chooser ( generator ) ).first;
+
+        try
+        {
+          const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+          ValHeader reply;
+
+          switch ( type )
+          {
+            case READ: reply = client.read ( m_baseAddr ); break;
+            case WRITE: reply = client.write ( m_baseAddr, static_cast<uint32_t> ( i ) ); break;
+            case BLOCK_READ: reply = client.readBlock ( m_baseAddr, m_bandwidthTestDepth, defs::NON_INCREMENTAL ); break;
+            case BLOCK_WRITE: reply = client.writeBlock ( m_baseAddr, writeBuffer, defs::NON_INCREMENTAL ); break;
+            case RMW_BITS: reply = client.rmw_bits ( m_baseAddr, 0xFFFFFFFF, 0x0 ); break;
+            case RMW_SUM: reply = client.rmw_sum ( m_baseAddr, 0 ); break;
+          }
+
+          client.dispatchAsync().get();
+
+          // If another thread's dispatch sent the transaction, this thread's dispatch may complete before the reply arrives;
+          // the reply is given up on once the client's timeout has passed, e.g. if that dispatch failed
+          const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds ( client.getTimeoutPeriod() );
+
+          while ( ! reply.valid() )
+          {
+            if ( std::chrono::steady_clock::now() > deadline )
+            {
+              throw std::runtime_error ( "Reply to transaction was not valid within the timeout period after dispatch" );
+            }
+
+            std::this_thread::yield();
+          }
+
+          latencies[type].push_back ( std::chrono::duration_cast<std::chrono::nanoseconds> ( std::chrono::steady_clock::now() - begin ).count() );
+        }
+        catch ( const std::exception& e )
+        {
+          if ( threadErrors.at ( iThread )++ == 0 )
+          {
+            threadErrorMessages.at ( iThread ) = e.what();
+          }
+        }
+      }
+    } ) );
+  }
+
+  Timer myTimer;
+  startSignal.set_value();
+
+  for ( std::thread& thread: threads )
+  {
+    thread.join();
+  }
+
+  const double totalSeconds = myTimer.elapsedSeconds();
+  uint64_t nTransactions = 0, nErrors = 0;
+
+  for ( size_t iThread = 0; iThread < nThreads; ++iThread )
+  {
+    nErrors += threadErrors.at ( iThread );
+
+    if ( threadErrors.at ( iThread ) )
+    {
+      cerr << "Thread " << iThread << " (device " << m_deviceURIs.at ( iThread / m_threads ) << ") caught " << threadErrors.at ( iThread )
+           << " exceptions, the first being:" << endl << threadErrorMessages.at ( iThread ) << endl;
+    }
+
+    for ( const auto& item: threadLatencies.at ( iThread ) )
+    {
+      nTransactions += item.second.size();
+    }
+  }
+
+  outputStandardResults ( totalSeconds );
+  cout << "Threads per device              = " << m_threads << "\n"
+       << "Successful transactions         = " << nTransactions << "\n"
+       << "Failed transactions             = " << nErrors << "\n"
+       << "Transaction frequency           = " << nTransactions / totalSeconds << " Hz\n" << endl;
+
+  // Latency percentiles for each device (if there is more than one), then for all devices together
+  LatencyMap allLatencies;
+  std::vector< string > deviceSummaries;
+
+  for ( size_t iDevice = 0; iDevice < m_clients.size(); ++iDevice )
+  {
+    LatencyMap deviceLatencies;
+
+    for ( size_t iThread = iDevice * m_threads; iThread < ( iDevice + 1 ) * m_threads; ++iThread )
+    {
+      for ( const auto& item: threadLatencies.at ( iThread ) )
+      {
+        deviceLatencies[item.first].insert ( deviceLatencies[item.first].end(), item.second.begin(), item.second.end() );
+        allLatencies[item.first].insert ( allLatencies[item.first].end(), item.second.begin(), item.second.end() );
+      }
+    }
+
+    if ( m_clients.size() > 1 )
+    {
+      cout << "Latencies for " << m_deviceURIs.at ( iDevice ) << ":" << endl;
+      deviceSummaries.push_back ( summariseLatencies ( deviceLatencies ) );
+      cout << endl;
+    }
+  }
+
+  if ( m_clients.size() > 1 )
+  {
+    cout << "Latencies for all devices:" << endl;
+  }
+
+  const string allSummary = summariseLatencies ( allLatencies );
+
+  if ( deviceSummaries.empty() )
+  {
+    deviceSummaries.push_back ( allSummary );
+  }
+
+  ostringstream json;
+  json << "{\"totalSeconds\": " << jsonNumber ( totalSeconds ) << ", "
+       << "\"transactions\": " << nTransactions << ", "
+       << "\"errors\": " << nErrors << ", "
+       << "\"transactionFrequencyHz\": " << jsonNumber ( nTransactions / totalSeconds ) << ", "
+       << "\"devices\": [";
+
+  for ( size_t iDevice = 0; iDevice < deviceSummaries.size(); ++iDevice )
+  {
+    json << ( iDevice ? ", " : "" ) << "{\"uri\": " << jsonString ( m_deviceURIs.at ( iDevice ) ) << ", \"latency\": " << deviceSummaries.at ( iDevice ) << "}";
+  }
+
+  json << "], \"latency\": " << allSummary << "}";
+  outputJsonResults ( json.str() );
+
+  if ( nErrors )
+  {
+    std::exit ( 1 );
+  }
+}
+
+
 void uhal::tests::PerfTester::sandbox()
 {
   try
@@ -83,7 +83,17 @@ void uhal::tests::TCPDummyHardware< IPbus_major , IPbus_minor >::handle_read_chu
   if ( lSize > 4 )
   {
     base_type::mReply.front() = htonl ( lSize - 4 );
-    boost::asio::write ( mSocket , boost::asio::buffer ( & ( base_type::mReply[0] ) , lSize ) );
+    boost::system::error_code lError;
+    boost::asio::write ( mSocket , boost::asio::buffer ( & ( base_type::mReply[0] ) , lSize ) , lError );
+
+    if ( lError )
+    {
+      // The client closes the connection after a timeout, so it may have gone by the time a delayed reply is sent
+      log ( Notice(), "Error while writing to socket: ", lError.message(), "; waiting for a new connection" );
+      mSocket.close();
+      mAcceptor.async_accept ( mSocket, [&] (const boost::system::error_code& e) {this->handle_accept(e);} );
+      return;
+    }
   }
 
   boost::asio::async_read ( mSocket , 
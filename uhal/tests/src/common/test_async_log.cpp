@@ -0,0 +1,214 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+#include "uhal/log/log.hpp"
+#include "uhal/log/AsyncLog.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace uhal {
+namespace tests {
+
+
+namespace {
+
+//! Returns the number of entries written by each thread, checking that each thread's entries are in order
+std::vector<size_t> countEntries ( const std::string& aLog , const size_t aNrThreads )
+{
+  std::vector<size_t> lCounts ( aNrThreads , 0 );
+  std::istringstream lLog ( aLog );
+  std::string lLine;
+
+  while ( std::getline ( lLog , lLine ) )
+  {
+    const size_t lPos ( lLine.find ( "entry " ) );
+    BOOST_REQUIRE ( lPos != std::string::npos );
+    std::istringstream lEntry ( lLine.substr ( lPos + 6 ) );
+    size_t lThread , lIndex;
+    BOOST_REQUIRE ( lEntry >> lThread >> lIndex );
+    BOOST_REQUIRE ( lThread < aNrThreads );
+    BOOST_CHECK_GE ( lIndex , lCounts.at ( lThread ) );
+    lCounts.at ( lThread ) = lIndex + 1;
+  }
+
+  return lCounts;
+}
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(logging)
+
+BOOST_AUTO_TEST_CASE(async_entries)
+{
+  const size_t lNrThreads = 4, lNrEntries = 1000;
+  // The Fatal level is always included, whatever level the tests are run at
+  std::ostringstream lStream;
+  FatalLevel lLevel ( lStream );
+
+  enableAsyncLogging ( 4 * lNrEntries );
+  BOOST_REQUIRE ( asyncLoggingEnabled() );
+  const uint64_t lDropped ( getDroppedLogEntries() );
+
+  std::vector<std::thread> lThreads;
+  for ( size_t i = 0; i < lNrThreads; i++ )
+  {
+    lThreads.push_back ( std::thread ( [&lLevel, i, lNrEntries] () {
+      for ( size_t j = 0; j < lNrEntries; j++ )
+      {
+        log ( lLevel , "entry " , Integer ( i ) , " " , Integer ( j ) );
+      }
+    } ) );
+  }
+
+  for ( std::thread& lThread : lThreads )
+  {
+    lThread.join();
+  }
+
+  flushLog();
+  disableAsyncLogging();
+  BOOST_CHECK ( ! asyncLoggingEnabled() );
+  BOOST_CHECK_EQUAL ( getDroppedLogEntries() , lDropped );
+
+  const std::vector<size_t> lCounts ( countEntries ( lStream.str() , lNrThreads ) );
+  for ( size_t i = 0; i < lNrThreads; i++ )
+  {
+    BOOST_CHECK_EQUAL ( lCounts.at ( i ) , lNrEntries );
+  }
+
+  // Once disabled, entries are written immediately
+  lStream.str ( "" );
+  log ( lLevel , "entry " , Integer ( 0 ) , " " , Integer ( 0 ) );
+  BOOST_CHECK_EQUAL ( countEntries ( lStream.str() , 1 ).at ( 0 ) , 1u );
+}
+
+
+BOOST_AUTO_TEST_CASE(async_entries_dropped)
+{
+  const size_t lNrEntries = 10000;
+  std::ostringstream lStream;
+  FatalLevel lLevel ( lStream );
+
+  // With a tiny buffer, some entries will be dropped, but each entry is either written or counted as dropped
+  enableAsyncLogging ( 2 );
+  const uint64_t lDropped ( getDroppedLogEntries() );
+
+  for ( size_t j = 0; j < lNrEntries; j++ )
+  {
+    log ( lLevel , "entry " , Integer ( 0 ) , " " , Integer ( j ) );
+  }
+
+  flushLog();
+  disableAsyncLogging();
+
+  std::istringstream lLog ( lStream.str() );
+  std::string lLine;
+  size_t lNrWritten ( 0 );
+  while ( std::getline ( lLog , lLine ) )
+  {
+    lNrWritten++;
+  }
+
+  countEntries ( lStream.str() , 1 );
+  BOOST_CHECK_GT ( lNrWritten , 0u );
+  BOOST_CHECK_EQUAL ( lNrWritten + ( getDroppedLogEntries() - lDropped ) , lNrEntries );
+}
+
+BOOST_AUTO_TEST_CASE(async_entries_during_disable)
+{
+  const size_t lNrThreads = 4, lNrCycles = 50;
+  std::ostringstream lStream;
+  FatalLevel lLevel ( lStream );
+  const uint64_t lDropped ( getDroppedLogEntries() );
+
+  std::atomic<bool> lStop ( false );
+  std::vector<size_t> lNrEntries ( lNrThreads , 0 );
+  std::vector<std::thread> lThreads;
+  enableAsyncLogging ( 1 << 16 );
+
+  for ( size_t i = 0; i < lNrThreads; i++ )
+  {
+    lThreads.push_back ( std::thread ( [&lLevel, &lStop, &lNrEntries, i] () {
+      size_t& j ( lNrEntries.at ( i ) );
+      for ( ; !lStop.load(); j++ )
+      {
+        log ( lLevel , "entry " , Integer ( i ) , " " , Integer ( j ) );
+      }
+    } ) );
+  }
+
+  // Entries that are started before, but queued after, logging is disabled must still be written, and in order
+  for ( size_t i = 0; i < lNrCycles; i++ )
+  {
+    std::this_thread::sleep_for ( std::chrono::milliseconds ( 1 ) );
+    disableAsyncLogging();
+    std::this_thread::sleep_for ( std::chrono::milliseconds ( 1 ) );
+    enableAsyncLogging ( 1 << 16 );
+  }
+
+  lStop = true;
+  for ( std::thread& lThread : lThreads )
+  {
+    lThread.join();
+  }
+
+  disableAsyncLogging();
+  BOOST_CHECK_EQUAL ( getDroppedLogEntries() , lDropped );
+
+  const std::vector<size_t> lCounts ( countEntries ( lStream.str() , lNrThreads ) );
+  const std::string lLog ( lStream.str() );
+  BOOST_CHECK_EQUAL ( size_t ( std::count ( lLog.begin() , lLog.end() , '\n' ) ) , std::accumulate ( lNrEntries.begin() , lNrEntries.end() , size_t ( 0 ) ) );
+  for ( size_t i = 0; i < lNrThreads; i++ )
+  {
+    BOOST_CHECK_EQUAL ( lCounts.at ( i ) , lNrEntries.at ( i ) );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+} // end ns tests
+} // end ns uhal
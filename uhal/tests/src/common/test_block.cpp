@@ -38,12 +38,29 @@
 #include "uhal/tests/fixtures.hpp"
 #include "uhal/tests/tools.hpp"
 
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include "uhal/Buffers.hpp"
+#include "uhal/NodeTreeBuilder.hpp"
+#include "uhal/ProtocolIPbus.hpp"
+#include "uhal/ProtocolPCIe.hpp"
+#include "uhal/ProtocolUDP.hpp"
+
+#include <algorithm>
 #include <vector>
 #include <iostream>
 #include <cstdlib>
 #include <typeinfo>
+#include <string>
+#include <chrono>
+#include <functional>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <sys/uio.h>
+#include <unistd.h>
 
 
 using namespace uhal;
@@ -80,6 +97,58 @@ std::vector<size_t> getBlockUnitTestDepths(const size_t aMaxSize)
 }
 
 
+// Write and read back a block of each depth through a single client for the given device, checking the data and the client's
+// metrics after each dispatch; aCheck is then called with the depth, for checks specific to the device's configuration
+void checkBlockWriteRead(const std::string& aDeviceId, const std::vector<size_t>& aDepths, const bool aAsync, const std::function<void (HwInterface&, const size_t)>& aCheck)
+{
+  ConnectionManager manager(AbstractFixture::connectionFileURI);
+  HwInterface hw(manager.getDevice(aDeviceId));
+  hw.setTimeoutPeriod(AbstractFixture::timeout);
+  const ClientMetrics& lMetrics = hw.getClient().getMetrics();
+
+  for(size_t i=0; i<aDepths.size(); i++) {
+    const size_t N = aDepths.at(i);
+    BOOST_TEST_MESSAGE("  N = " << N);
+
+    std::vector<uint32_t> xx;
+    xx.reserve ( N );
+    for ( size_t j=0; j!= N; ++j )
+    {
+      xx.push_back ( static_cast<uint32_t> ( rand() ) );
+    }
+
+    const uint64_t lPacketsSent = lMetrics.getPacketsSent();
+    const uint64_t lPacketsReceived = lMetrics.getPacketsReceived();
+    const uint64_t lBytesSent = lMetrics.getBytesSent();
+    const uint64_t lBytesReceived = lMetrics.getBytesReceived();
+    const uint64_t lDispatches = lMetrics.getDispatches();
+
+    hw.getNode ( "LARGE_MEM" ).writeBlock ( xx );
+    ValVector< uint32_t > mem = hw.getNode ( "LARGE_MEM" ).readBlock ( N );
+    if ( aAsync )
+    {
+      BOOST_CHECK_NO_THROW ( hw.dispatchAsync().get() );
+    }
+    else
+    {
+      BOOST_CHECK_NO_THROW ( hw.dispatch() );
+    }
+    BOOST_CHECK ( mem.valid() );
+    BOOST_CHECK_EQUAL ( mem.size(), N );
+    BOOST_CHECK ( std::equal ( mem.begin() , mem.end() , xx.begin() ) );
+
+    // Every packet sent has been answered, and the packets carried at least the block's data in each direction
+    BOOST_CHECK_EQUAL ( lMetrics.getPacketsInFlight() , 0u );
+    BOOST_CHECK_EQUAL ( lMetrics.getPacketsReceived() - lPacketsReceived , lMetrics.getPacketsSent() - lPacketsSent );
+    BOOST_CHECK ( lMetrics.getBytesSent() - lBytesSent >= 4 * N );
+    BOOST_CHECK ( lMetrics.getBytesReceived() - lBytesReceived >= 4 * N );
+    BOOST_CHECK_EQUAL ( lMetrics.getDispatches() - lDispatches , ( lMetrics.getPacketsSent() > lPacketsSent ) ? 1u : 0u );
+
+    aCheck ( hw , N );
+  }
+}
+
+
 UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(BlockReadWriteTestSuite, block_write_read, DummyHardwareFixture,
 {
   std::vector<size_t> lDepths = getBlockUnitTestDepths(quickTest ? N_1MB : N_10MB);
@@ -128,6 +197,92 @@ UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(BlockReadWriteTestSuite, block_write_read, D
 )
 
 
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(BlockReadWriteTestSuite, block_write_read_by_reference, DummyHardwareFixture,
+{
+  std::vector<size_t> lDepths = getBlockUnitTestDepths(quickTest ? N_1MB : N_10MB);
+
+  for(size_t i=0; i<lDepths.size(); i++) {
+    const size_t N = lDepths.at(i);
+    BOOST_TEST_MESSAGE("  N = " << N);
+
+    HwInterface hw = getHwInterface();
+
+    std::vector<uint32_t> xx;
+    xx.reserve ( N );
+    for ( size_t i=0; i!= N; ++i )
+    {
+      xx.push_back ( static_cast<uint32_t> ( rand() ) );
+    }
+
+    // Values are moved into the client, and sent directly from that vector rather than being copied into the send buffers
+    std::vector<uint32_t> lSource ( xx );
+    hw.getNode ( "LARGE_MEM" ).writeBlock ( std::move ( lSource ) );
+    ValVector< uint32_t > mem = hw.getNode ( "LARGE_MEM" ).readBlock ( N );
+    BOOST_CHECK_NO_THROW ( hw.dispatch() );
+    BOOST_CHECK ( mem.valid() );
+    BOOST_CHECK_EQUAL ( mem.size(), N );
+
+    //This check will fail when DummyHardware::ADDRESS_MASK < N
+    if ( N < N_10MB )
+    {
+      BOOST_CHECK ( std::equal ( mem.begin() , mem.end() , xx.begin() ) );
+    }
+
+    // Temporaries also bind to the rvalue overload; write the first half by reference, and the second half by copying into the send buffers
+    std::reverse ( xx.begin() , xx.end() );
+    hw.getNode ( "LARGE_MEM" ).writeBlock ( std::vector<uint32_t> ( xx.begin() , xx.begin() + N / 2 ) );
+    hw.getNode ( "LARGE_MEM" ).writeBlockOffset ( std::vector<uint32_t> ( xx.begin() + N / 2 , xx.end() ) , N / 2 );
+    ValVector< uint32_t > mem2 = hw.getNode ( "LARGE_MEM" ).readBlock ( N );
+    BOOST_CHECK_NO_THROW ( hw.dispatch() );
+    BOOST_CHECK ( mem2.valid() );
+    BOOST_CHECK_EQUAL ( mem2.size(), N );
+
+    if ( N < N_10MB )
+    {
+      BOOST_CHECK ( std::equal ( mem2.begin() , mem2.end() , xx.begin() ) );
+    }
+  }
+}
+)
+
+
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(BlockReadWriteTestSuite, block_read_into_buffer, DummyHardwareFixture,
+{
+  std::vector<size_t> lDepths = getBlockUnitTestDepths(quickTest ? N_1MB : N_10MB);
+
+  for(size_t i=0; i<lDepths.size(); i++) {
+    const size_t N = lDepths.at(i);
+    BOOST_TEST_MESSAGE("  N = " << N);
+
+    HwInterface hw = getHwInterface();
+
+    std::vector<uint32_t> xx;
+    xx.reserve ( N );
+    for ( size_t i=0; i!= N; ++i )
+    {
+      xx.push_back ( static_cast<uint32_t> ( rand() ) );
+    }
+
+    // Extra word at the end of the buffer, to check that the read doesn't overrun
+    std::vector<uint32_t> lBuffer ( N + 1 , 0xDEADBEEF );
+
+    hw.getNode ( "LARGE_MEM" ).writeBlock ( xx );
+    ValHeader lReply = hw.getNode ( "LARGE_MEM" ).readBlock ( lBuffer.data() , N );
+    BOOST_CHECK ( !lReply.valid() );
+    BOOST_CHECK_NO_THROW ( hw.dispatch() );
+    BOOST_CHECK ( lReply.valid() );
+    BOOST_CHECK_EQUAL ( lBuffer.back() , uint32_t ( 0xDEADBEEF ) );
+
+    //This check will fail when DummyHardware::ADDRESS_MASK < N
+    if ( N < N_10MB )
+    {
+      BOOST_CHECK ( std::equal ( xx.begin() , xx.end() , lBuffer.begin() ) );
+    }
+  }
+}
+)
+
+
 UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(BlockReadWriteTestSuite, fifo_write_read, DummyHardwareFixture,
 {
   std::vector<size_t> lDepths = getBlockUnitTestDepths(quickTest ? N_1MB : N_200MB);
@@ -295,6 +450,308 @@ UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(BlockReadWriteTestSuite, block_offset_bigger
 )
 
 
+// UDP client which records the memory blocks that make up each packet, as the packet is handed to the transport layer
+class SegmentRecordingUDP : public UDP< IPbus< 2 , 0 > >
+{
+public:
+  SegmentRecordingUDP ( const std::string& aId , const URI& aUri ) :
+    UDP< IPbus< 2 , 0 > > ( aId , aUri )
+  {
+  }
+
+  // Returns the number of bytes sent directly from the given words (rather than from a copy in the send buffers), and clears the record
+  size_t takeBytesSentFrom ( const uint32_t* aWords , const size_t aSize )
+  {
+    const uint8_t* lBegin = reinterpret_cast< const uint8_t* > ( aWords );
+    const uint8_t* lEnd = lBegin + 4 * aSize;
+    size_t lBytes ( 0 );
+
+    for (const auto& lSegment : mSegments)
+    {
+      if ( ( lSegment.first >= lBegin ) && ( lSegment.first < lEnd ) )
+      {
+        BOOST_CHECK ( lSegment.first + lSegment.second <= lEnd );
+        lBytes += lSegment.second;
+      }
+    }
+
+    mSegments.clear();
+    return lBytes;
+  }
+
+private:
+  void predispatch ( std::shared_ptr< Buffers > aBuffers )
+  {
+    UDP< IPbus< 2 , 0 > >::predispatch ( aBuffers );
+    const std::vector< std::pair< const uint8_t* , size_t > >& lSegments = aBuffers->getSendSegments();
+    mSegments.insert ( mSegments.end() , lSegments.begin() , lSegments.end() );
+  }
+
+  std::vector< std::pair< const uint8_t* , size_t > > mSegments;
+};
+
+
+BOOST_AUTO_TEST_SUITE( ipbusudp_2_0 )
+BOOST_AUTO_TEST_SUITE( BlockReadWriteTestSuite )
+
+BOOST_FIXTURE_TEST_CASE( block_write_read_batched , DummyHardwareFixture<IPBUS_2_0_UDP> )
+{
+  // Same device as dummy.udp2, but with up to 16 packets sent/received per sendmmsg/recvmmsg call
+  checkBlockWriteRead("dummy.udp2.batched", getBlockUnitTestDepths(quickTest ? N_1MB : N_10MB), false, [] (HwInterface& hw, const size_t N) {
+    const uint32_t lLargestBatch = dynamic_cast< UDP< IPbus< 2 , 0 > >& > ( hw.getClient() ).getLargestBatch();
+    BOOST_CHECK ( lLargestBatch > 0 );
+    BOOST_CHECK ( lLargestBatch <= 16 );
+    // Once the replies start to arrive, the packets queued behind the window are sent together
+    if ( N >= N_1MB )
+    {
+      BOOST_CHECK ( lLargestBatch > 1 );
+    }
+  });
+}
+
+
+BOOST_FIXTURE_TEST_CASE( block_write_read_congestion_control , DummyHardwareFixture<IPBUS_2_0_UDP> )
+{
+  // Same device as dummy.udp2, but with the number of packets in flight adapting to packet loss
+  checkBlockWriteRead("dummy.udp2.adaptive", getBlockUnitTestDepths(quickTest ? N_1MB : N_10MB), false, [] (HwInterface& hw, const size_t N) {
+    const uint32_t lWindow = dynamic_cast< UDP< IPbus< 2 , 0 > >& > ( hw.getClient() ).getCongestionWindow();
+    // The window starts at one packet, and without loss opens up to the number of buffers in the target (16 for IPbus 2.0)
+    if ( N <= N_4B )
+    {
+      BOOST_CHECK ( lWindow < 16 );
+    }
+    else if ( N >= N_1MB )
+    {
+      BOOST_CHECK_EQUAL ( lWindow , 16u );
+    }
+  });
+}
+
+
+BOOST_FIXTURE_TEST_CASE( block_write_by_reference_send_segments , DummyHardwareFixture<IPBUS_2_0_UDP> )
+{
+  URI lUri;
+  lUri.mProtocol = "ipbusudp-2.0";
+  lUri.mHostname = "localhost";
+  lUri.mPort = std::to_string ( devicePort );
+  std::shared_ptr< SegmentRecordingUDP > lClient ( new SegmentRecordingUDP ( deviceId , lUri ) );
+  std::shared_ptr< Node > lNode ( NodeTreeBuilder::getInstance().getNodeTree ( getAddressFileURI() , boost::filesystem::current_path() / "." ) );
+  HwInterface hw ( lClient , lNode );
+  hw.setTimeoutPeriod ( timeout );
+
+  // Blocks of 256 bytes or more are sent from the caller's vector, and smaller blocks are copied into the send buffers. A block
+  // spanning several packets is sent as one reference per packet, of which only the last can be small enough to be copied
+  const std::vector<size_t> lDepths = { 63 , 64 , N_1kB , N_1MB };
+
+  for (const size_t N : lDepths) {
+    BOOST_TEST_MESSAGE("  N = " << N);
+
+    std::vector<uint32_t> xx;
+    xx.reserve ( N );
+    for ( size_t i=0; i!= N; ++i )
+    {
+      xx.push_back ( static_cast<uint32_t> ( rand() ) );
+    }
+
+    // Moving the vector into the client keeps its memory, which is then sent from directly
+    std::vector<uint32_t> lSource ( xx );
+    const uint32_t* lSourceData = lSource.data();
+    hw.getNode ( "LARGE_MEM" ).writeBlock ( std::move ( lSource ) );
+    ValVector< uint32_t > mem = hw.getNode ( "LARGE_MEM" ).readBlock ( N );
+    BOOST_CHECK_NO_THROW ( hw.dispatch() );
+    BOOST_CHECK ( mem.valid() );
+    BOOST_CHECK ( std::equal ( mem.begin() , mem.end() , xx.begin() ) );
+
+    const size_t lBytesByReference = lClient->takeBytesSentFrom ( lSourceData , N );
+    if ( 4 * N < 256 )
+    {
+      BOOST_CHECK_EQUAL ( lBytesByReference , 0u );
+    }
+    else if ( N == 64 )
+    {
+      // The whole block fits in the first packet
+      BOOST_CHECK_EQUAL ( lBytesByReference , 4 * N );
+    }
+    else
+    {
+      BOOST_CHECK ( lBytesByReference + 256 > 4 * N );
+    }
+  }
+}
+
+
+BOOST_AUTO_TEST_CASE( send_by_reference_fallbacks )
+{
+  // Each block is preceded by a small header that is always copied into the send buffer. Blocks of 256 bytes or more are sent
+  // by reference, up to 8 per packet; the first block is too small, and the last block is the 9th large one, so both are copied
+  std::vector< std::vector<uint8_t> > lBlocks;
+  lBlocks.push_back ( std::vector<uint8_t> ( 255 , 0xFF ) );
+  for ( uint8_t i = 0; i != 9; ++i )
+  {
+    lBlocks.push_back ( std::vector<uint8_t> ( 256 , i ) );
+  }
+
+  Buffers lBuffers;
+  std::vector<uint8_t> lExpected;
+  for ( size_t i = 0; i != lBlocks.size(); ++i )
+  {
+    const uint32_t lHeader ( 0xCAFE0000 + i );
+    lBuffers.send ( lHeader );
+    lBuffers.sendByReference ( lBlocks.at ( i ).data() , lBlocks.at ( i ).size() );
+    const uint8_t* lHeaderBytes = reinterpret_cast< const uint8_t* > ( &lHeader );
+    lExpected.insert ( lExpected.end() , lHeaderBytes , lHeaderBytes + 4 );
+    lExpected.insert ( lExpected.end() , lBlocks.at ( i ).begin() , lBlocks.at ( i ).end() );
+  }
+  BOOST_CHECK_EQUAL ( lBuffers.sendCounter() , lExpected.size() );
+
+  // Only the 8 referenced blocks appear as segments of their own, and the segments gather into the full packet
+  const std::vector< std::pair< const uint8_t* , size_t > >& lSegments = lBuffers.getSendSegments();
+  std::vector<uint8_t> lGathered;
+  for (const auto& lSegment : lSegments)
+  {
+    lGathered.insert ( lGathered.end() , lSegment.first , lSegment.first + lSegment.second );
+  }
+  BOOST_CHECK ( lGathered == lExpected );
+
+  for ( size_t i = 0; i != lBlocks.size(); ++i )
+  {
+    const bool lReferenced = ( i != 0 ) && ( i != 9 );
+    const size_t lCount = std::count ( lSegments.begin() , lSegments.end() , std::make_pair ( static_cast< const uint8_t* > ( lBlocks.at ( i ).data() ) , lBlocks.at ( i ).size() ) );
+    BOOST_CHECK_EQUAL ( lCount , lReferenced ? 1u : 0u );
+  }
+
+  // A contiguous copy of the packet includes the referenced blocks
+  const uint8_t* lSendBuffer = lBuffers.getSendBuffer();
+  BOOST_CHECK ( std::equal ( lExpected.begin() , lExpected.end() , lSendBuffer ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE( ipbuspcie_2_0 )
+BOOST_AUTO_TEST_SUITE( BlockReadWriteTestSuite )
+
+BOOST_FIXTURE_TEST_CASE( block_write_read_completion_thread , DummyHardwareFixture<IPBUS_2_0_PCIE> )
+{
+  // Same device as dummy.pcie2, but with replies read by a dedicated completion thread
+  checkBlockWriteRead("dummy.pcie2.pipelined", getBlockUnitTestDepths(quickTest ? N_1MB : N_10MB), false, [] (HwInterface& hw, const size_t) {
+    // Every reply was read by the completion thread, rather than by the thread calling dispatch
+    const PCIe& lClient = dynamic_cast< const PCIe& > ( hw.getClient() );
+    BOOST_CHECK_EQUAL ( lClient.getCompletionThreadReplyCount() , hw.getClient().getMetrics().getPacketsReceived() );
+  });
+}
+
+
+BOOST_FIXTURE_TEST_CASE( block_write_read_spin_then_poll , DummyHardwareFixture<IPBUS_2_0_PCIE> )
+{
+  // Same device as dummy.pcie2, but (respectively) with the default spin period followed by polling, spinning for a minute
+  // (i.e. never polling), and polling straight away; the first reply is delayed, so that the client waits for it
+  const std::vector<std::string> lDeviceIds = { "dummy.pcie2" , "dummy.pcie2.spin" , "dummy.pcie2.nospin" };
+
+  for (const std::string& lDeviceId : lDeviceIds) {
+    BOOST_TEST_MESSAGE("  Device = " << lDeviceId);
+    hwRunner.setReplyDelay ( std::chrono::milliseconds ( 20 ) );
+    checkBlockWriteRead(lDeviceId, { N_1MB }, false, [&lDeviceId] (HwInterface& hw, const size_t) {
+      // The delay is longer than the default spin period, so only the spinning client never blocks or sleeps
+      const PCIe& lClient = dynamic_cast< const PCIe& > ( hw.getClient() );
+      if ( lDeviceId == "dummy.pcie2.spin" )
+      {
+        BOOST_CHECK_EQUAL ( lClient.getReplyWaitCount() , 0u );
+      }
+      else
+      {
+        BOOST_CHECK ( lClient.getReplyWaitCount() > 0 );
+      }
+    });
+  }
+}
+
+
+BOOST_FIXTURE_TEST_CASE( block_write_read_completion_thread_async_dispatch , DummyHardwareFixture<IPBUS_2_0_PCIE> )
+{
+  // The future is completed once the completion thread has read the last reply
+  checkBlockWriteRead("dummy.pcie2.pipelined", getBlockUnitTestDepths(quickTest ? N_1MB : N_10MB), true, [] (HwInterface& hw, const size_t) {
+    // Every reply was read by the completion thread, rather than by the thread calling dispatch
+    const PCIe& lClient = dynamic_cast< const PCIe& > ( hw.getClient() );
+    BOOST_CHECK_EQUAL ( lClient.getCompletionThreadReplyCount() , hw.getClient().getMetrics().getPacketsReceived() );
+  });
+}
+
+
+BOOST_FIXTURE_TEST_CASE( block_read_short_reply , DummyHardwareFixture<IPBUS_2_0_PCIE> )
+{
+  HwInterface hw = getHwInterface();
+  const size_t N = 64;
+
+  std::vector<uint32_t> xx;
+  xx.reserve ( N );
+  for ( size_t i=0; i!= N; ++i )
+  {
+    xx.push_back ( static_cast<uint32_t> ( rand() ) | 1 );
+  }
+  hw.getNode ( "LARGE_MEM" ).writeBlock ( xx );
+  BOOST_CHECK_NO_THROW ( hw.dispatch() );
+
+  // Read the block enough times to leave its values in every page of the reply file ...
+  for ( size_t i=0; i!= 4; ++i )
+  {
+    ValVector< uint32_t > mem = hw.getNode ( "LARGE_MEM" ).readBlock ( N );
+    BOOST_CHECK_NO_THROW ( hw.dispatch() );
+    BOOST_CHECK ( std::equal ( mem.begin() , mem.end() , xx.begin() ) );
+  }
+
+  // ... so that the words missing from a short reply would otherwise be filled with stale data, rather than zeroed
+  hwRunner.truncateNextReply ( 2 );
+  ValVector< uint32_t > mem = hw.getNode ( "LARGE_MEM" ).readBlock ( N );
+  BOOST_CHECK_NO_THROW ( hw.dispatch() );
+  BOOST_CHECK ( mem.valid() );
+  BOOST_CHECK_EQUAL ( mem.size(), N );
+  BOOST_CHECK ( std::equal ( mem.begin() , mem.end() - 2 , xx.begin() ) );
+  BOOST_CHECK_EQUAL ( mem.at ( N - 2 ) , 0u );
+  BOOST_CHECK_EQUAL ( mem.at ( N - 1 ) , 0u );
+}
+
+
+BOOST_AUTO_TEST_CASE( file_write_read_more_than_iov_max_regions )
+{
+  char lPath[] = "/tmp/uhal_pcie_file_XXXXXX";
+  const int lFd = mkstemp ( lPath );
+  BOOST_REQUIRE ( lFd != -1 );
+  close ( lFd );
+
+  // One region per word, so that each transfer has more regions than a single preadv/pwritev call accepts
+  const size_t N = 2 * IOV_MAX + 1;
+  std::vector<uint32_t> xx ( N ) , yy ( N , 0 );
+  std::vector<struct iovec> lWriteRegions , lReadRegions;
+  for ( size_t i=0; i!= N; ++i )
+  {
+    xx.at ( i ) = static_cast<uint32_t> ( rand() );
+    lWriteRegions.push_back ( iovec { &xx.at ( i ) , 4 } );
+    lReadRegions.push_back ( iovec { &yy.at ( i ) , 4 } );
+  }
+
+  {
+    PCIe::File lFile ( lPath , O_RDWR );
+    BOOST_CHECK_NO_THROW ( lFile.write ( 8 , lWriteRegions ) );
+    BOOST_CHECK_NO_THROW ( lFile.read ( 8 , lReadRegions ) );
+    BOOST_CHECK ( xx == yy );
+
+    // The regions are written contiguously from the given address, so can be read back as a single region
+    std::vector<uint32_t> lValues;
+    BOOST_CHECK_NO_THROW ( lFile.read ( 2 , N , lValues ) );
+    BOOST_CHECK ( lValues == xx );
+
+    // Reading past the end of the file is reported, rather than leaving the regions partially filled
+    BOOST_CHECK_THROW ( lFile.read ( 12 , lReadRegions ) , uhal::exception::PCIeCommunicationError );
+  }
+
+  unlink ( lPath );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
 } // end ns tests
 } // end ns uhal
 
@@ -27,6 +27,7 @@
 */
 
 #include "uhal/ClientFactory.hpp"
+#include "uhal/IOServicePool.hpp"
 #include "uhal/ProtocolUDP.hpp"
 #include "uhal/ProtocolTCP.hpp"
 #include "uhal/ProtocolIPbus.hpp"
@@ -37,6 +38,9 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <chrono>
+#include <future>
+
 
 namespace uhal {
 namespace tests {
@@ -99,6 +103,80 @@ BOOST_AUTO_TEST_CASE (user_clients)
 }
 
 
+BOOST_AUTO_TEST_CASE (shared_io_threads)
+{
+  IOServicePool& lPool = IOServicePool::getInstance();
+  const size_t lOriginalNrThreads = lPool.getNumberOfThreads();
+
+  lPool.setNumberOfThreads(0);
+  std::shared_ptr<boost::asio::io_service> lDedicated1(lPool.getIOService()), lDedicated2(lPool.getIOService());
+  BOOST_CHECK(lDedicated1 != lDedicated2);
+
+  lPool.setNumberOfThreads(2);
+  BOOST_CHECK_EQUAL(lPool.getNumberOfThreads(), size_t(2));
+  std::vector<std::shared_ptr<boost::asio::io_service> > lShared;
+  for (size_t i = 0; i < 4; i++)
+    lShared.push_back(lPool.getIOService());
+  // Clients are spread evenly over the shared threads
+  BOOST_CHECK(lShared.at(0) != lShared.at(1));
+  BOOST_CHECK(lShared.at(2) == lShared.at(0) || lShared.at(2) == lShared.at(1));
+  BOOST_CHECK(lShared.at(3) != lShared.at(2));
+
+  checkClientFactory<UDP<IPbus<2,0> > >("bob", "ipbusudp-2.0://localhost:50001");
+  checkClientFactory<TCP<IPbus<2,0>, 1 > >("dave", "ipbustcp-2.0://localhost:50001");
+
+  lPool.setNumberOfThreads(lOriginalNrThreads);
+}
+
+
+BOOST_AUTO_TEST_CASE (destroy_client_in_io_thread)
+{
+  IOServicePool& lPool = IOServicePool::getInstance();
+  const size_t lOriginalNrThreads = lPool.getNumberOfThreads();
+
+  // With a single shared thread, the client's handlers run in the same thread as the task below
+  lPool.setNumberOfThreads(1);
+  std::shared_ptr<boost::asio::io_service> lIOService(lPool.getIOService());
+  std::shared_ptr<ClientInterface> lClient(ClientFactory::getInstance().getClient("bob", "ipbusudp-2.0://localhost:50001"));
+
+  // Destroying the client from within its own io_service thread must not deadlock
+  std::promise<void> lPromise;
+  lIOService->post([&lClient, &lPromise] () {
+    lClient.reset();
+    lPromise.set_value();
+  });
+  BOOST_CHECK(lPromise.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+
+  lPool.setNumberOfThreads(lOriginalNrThreads);
+}
+
+
+BOOST_AUTO_TEST_CASE (destroy_last_client_of_io_thread_in_io_thread)
+{
+  IOServicePool& lPool = IOServicePool::getInstance();
+  const size_t lOriginalNrThreads = lPool.getNumberOfThreads();
+
+  lPool.setNumberOfThreads(1);
+  std::shared_ptr<boost::asio::io_service> lIOService(lPool.getIOService());
+  std::shared_ptr<ClientInterface> lClient(ClientFactory::getInstance().getClient("bob", "ipbusudp-2.0://localhost:50001"));
+
+  // Once the pool has dropped the thread, the client holds the last reference to it, and releases it from within the thread itself
+  std::promise<void> lGate, lPromise;
+  std::shared_future<void> lGateOpened(lGate.get_future());
+  lIOService->post([lGateOpened, &lClient, &lPromise] () {
+    lGateOpened.wait();
+    lClient.reset();
+    lPromise.set_value();
+  });
+  lIOService.reset();
+  lPool.setNumberOfThreads(0);
+  lGate.set_value();
+  BOOST_CHECK(lPromise.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+
+  lPool.setNumberOfThreads(lOriginalNrThreads);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end ns tests
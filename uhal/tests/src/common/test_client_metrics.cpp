@@ -0,0 +1,133 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+#include "uhal/uhal.hpp"
+#include "uhal/ClientMetrics.hpp"
+
+#include "uhal/tests/definitions.hpp"
+#include "uhal/tests/fixtures.hpp"
+#include "uhal/tests/tools.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace uhal {
+namespace tests {
+
+
+BOOST_AUTO_TEST_SUITE(metrics)
+
+BOOST_AUTO_TEST_CASE(histogram_quantiles)
+{
+  Histogram lHistogram;
+  BOOST_CHECK_EQUAL ( lHistogram.quantile ( 0.5 ) , 0u );
+
+  for ( uint64_t i = 1; i <= 1000; i++ )
+  {
+    lHistogram.record ( i );
+  }
+
+  BOOST_CHECK_EQUAL ( lHistogram.count() , 1000u );
+  BOOST_CHECK_EQUAL ( lHistogram.sum() , 500500u );
+  BOOST_CHECK_EQUAL ( lHistogram.max() , 1000u );
+  BOOST_CHECK_EQUAL ( lHistogram.quantile ( 1 ) , 1000u );
+
+  // Buckets are 1/8 of a power of two wide, so quantiles are accurate to 12.5%
+  const double lQuantiles[] = { 0.01 , 0.5 , 0.9 , 0.99 };
+  for ( const double lQuantile : lQuantiles )
+  {
+    const double lExpected ( lQuantile * 1000 );
+    BOOST_CHECK ( lHistogram.quantile ( lQuantile ) >= lExpected );
+    BOOST_CHECK ( lHistogram.quantile ( lQuantile ) <= lExpected * 1.125 + 1 );
+  }
+
+  lHistogram.record ( uint64_t ( -1 ) );
+  BOOST_CHECK_EQUAL ( lHistogram.max() , uint64_t ( -1 ) );
+  BOOST_CHECK_EQUAL ( lHistogram.quantile ( 1 ) , uint64_t ( -1 ) );
+
+  lHistogram.reset();
+  BOOST_CHECK_EQUAL ( lHistogram.count() , 0u );
+  BOOST_CHECK_EQUAL ( lHistogram.quantile ( 0.5 ) , 0u );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(ClientMetricsTestSuite, count_traffic, DummyHardwareFixture,
+{
+  HwInterface hw = getHwInterface();
+  const ClientMetrics& lMetrics = hw.getClient().getMetrics();
+  hw.getClient().resetMetrics();
+
+  std::vector<uint32_t> lValues ( 1000 , static_cast<uint32_t> ( rand() ) );
+  hw.getNode ( "REG" ).write ( lValues.front() );
+  hw.getNode ( "MEM" ).writeBlock ( lValues );
+  ValVector<uint32_t> lMem = hw.getNode ( "MEM" ).readBlock ( lValues.size() );
+  hw.dispatch();
+  BOOST_CHECK ( lMem.valid() );
+
+  BOOST_CHECK_EQUAL ( lMetrics.getDispatches() , 1u );
+  BOOST_CHECK ( lMetrics.getPacketsSent() > 0 );
+  BOOST_CHECK_EQUAL ( lMetrics.getPacketsReceived() , lMetrics.getPacketsSent() );
+  BOOST_CHECK ( lMetrics.getBytesSent() >= 4 * lValues.size() );
+  BOOST_CHECK ( lMetrics.getBytesReceived() >= 4 * lValues.size() );
+  BOOST_CHECK_EQUAL ( lMetrics.getPacketsInFlight() , 0u );
+  BOOST_CHECK_EQUAL ( lMetrics.getTimeouts() , 0u );
+  BOOST_CHECK_EQUAL ( lMetrics.getErrors() , 0u );
+  BOOST_CHECK_EQUAL ( lMetrics.getDispatchLatency().count() , 1u );
+  BOOST_CHECK_EQUAL ( lMetrics.getPacketLatency().count() , lMetrics.getPacketsSent() );
+  BOOST_CHECK_EQUAL ( lMetrics.getQueueDepth().count() , lMetrics.getPacketsSent() );
+
+  std::ostringstream lStream;
+  hw.getClient().streamMetrics ( lStream );
+  const std::string lLabels ( "{id=\"" + hw.id() + "\",uri=\"" + hw.uri() + "\"" );
+  BOOST_CHECK ( lStream.str().find ( "uhal_client_dispatches_total" + lLabels + "} 1\n" ) != std::string::npos );
+  BOOST_CHECK ( lStream.str().find ( "uhal_client_packet_latency_us" + lLabels + ",quantile=\"0.99\"} " ) != std::string::npos );
+  BOOST_CHECK ( lStream.str().find ( "uhal_client_timeouts_total" + lLabels + "} 0\n" ) != std::string::npos );
+
+  hw.getClient().resetMetrics();
+  BOOST_CHECK_EQUAL ( lMetrics.getPacketsSent() , 0u );
+  BOOST_CHECK_EQUAL ( lMetrics.getDispatchLatency().count() , 0u );
+}
+)
+
+
+} // end ns tests
+} // end ns uhal
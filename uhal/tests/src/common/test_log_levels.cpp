@@ -0,0 +1,215 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+// Debug entries are removed at compile time in this file only
+#define LOGGING_EXCLUDE_DEBUG
+
+#include "uhal/log/log.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+
+namespace uhal {
+namespace tests {
+
+
+namespace {
+
+//! A type without a stream operator, which can only be logged at levels that are excluded at compile time
+struct NotStreamable {};
+
+//! An exception to which log messages can be appended
+UHAL_DEFINE_EXCEPTION_CLASS ( TestException , "Exception thrown in the logging tests" )
+
+//! Restores the runtime log level on destruction
+class LogLevelGuard
+{
+public:
+  LogLevelGuard() :
+    mFatal ( LoggingIncludes ( Fatal() ) ),
+    mError ( LoggingIncludes ( Error() ) ),
+    mWarning ( LoggingIncludes ( Warning() ) ),
+    mNotice ( LoggingIncludes ( Notice() ) ),
+    mInfo ( LoggingIncludes ( Info() ) ),
+    mDebug ( LoggingIncludes ( Debug() ) )
+  {
+  }
+
+  ~LogLevelGuard()
+  {
+    if ( mDebug )
+      setLogLevelTo ( Debug() );
+    else if ( mInfo )
+      setLogLevelTo ( Info() );
+    else if ( mNotice )
+      setLogLevelTo ( Notice() );
+    else if ( mWarning )
+      setLogLevelTo ( Warning() );
+    else if ( mError )
+      setLogLevelTo ( Error() );
+    else if ( mFatal )
+      setLogLevelTo ( Fatal() );
+    else
+      disableLogging();
+  }
+
+private:
+  const bool mFatal, mError, mWarning, mNotice, mInfo, mDebug;
+};
+
+//! Returns the number of lines in the log
+size_t countLines ( const std::string& aLog )
+{
+  size_t lCount ( 0 );
+  std::istringstream lLog ( aLog );
+  std::string lLine;
+
+  while ( std::getline ( lLog , lLine ) )
+    lCount++;
+
+  return lCount;
+}
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(logging)
+
+BOOST_AUTO_TEST_CASE(compile_time_exclusion)
+{
+  BOOST_CHECK ( LogLevelTraits< InfoLevel >::kCompiled );
+  BOOST_CHECK ( ! LogLevelTraits< DebugLevel >::kCompiled );
+
+  LogLevelGuard lGuard;
+  setLogLevelTo ( Debug() );
+
+  std::ostringstream lStream;
+  DebugLevel lDebug ( lStream );
+  InfoLevel lInfo ( lStream );
+
+  // Compiles only because the Debug entry's arguments are never formatted
+  log ( lDebug , "excluded " , NotStreamable() );
+  BOOST_CHECK_EQUAL ( lStream.str() , "" );
+
+  log ( lInfo , "included" );
+  BOOST_CHECK ( lStream.str().find ( "included" ) != std::string::npos );
+
+  // Levels are still switched off at runtime
+  lStream.str ( "" );
+  setLogLevelTo ( Notice() );
+  log ( lInfo , "included" );
+  BOOST_CHECK_EQUAL ( lStream.str() , "" );
+}
+
+
+BOOST_AUTO_TEST_CASE(many_arguments)
+{
+  std::ostringstream lStream;
+  FatalLevel lLevel ( lStream );
+
+  // There is no longer a limit on the number of arguments
+  log ( lLevel , '0' , '1' , '2' , '3' , '4' , '5' , '6' , '7' , '8' , '9' ,
+        '0' , '1' , '2' , '3' , '4' , '5' , '6' , '7' , '8' , '9' ,
+        '0' , '1' , '2' , '3' , '4' , '5' , '6' , '7' , '8' , '9' ,
+        '0' , '1' , '2' , '3' , '4' , '5' , '6' , '7' , '8' , '9' );
+  BOOST_CHECK ( lStream.str().find ( "0123456789012345678901234567890123456789" ) != std::string::npos );
+
+  TestException lExc;
+  log ( lExc , "exception " , Integer ( 42 ) );
+  BOOST_CHECK ( std::string ( lExc.what() ).find ( "exception 42" ) != std::string::npos );
+}
+
+
+BOOST_AUTO_TEST_CASE(rate_limited_entries)
+{
+  std::ostringstream lStream;
+  FatalLevel lLevel ( lStream );
+
+  LogRateLimiter lLimiter ( 3 , std::chrono::hours ( 1 ) );
+  for ( size_t i = 0; i < 10; i++ )
+    log ( lLimiter , lLevel , "entry" );
+
+  BOOST_CHECK_EQUAL ( countLines ( lStream.str() ) , 3u );
+  BOOST_CHECK ( lStream.str().find ( "suppressed" ) == std::string::npos );
+  BOOST_CHECK_EQUAL ( lLimiter.suppressed() , 7u );
+
+  // The first entry written in the next period reports how many were dropped in the previous one
+  lStream.str ( "" );
+  LogRateLimiter lShortLimiter ( 3 , std::chrono::milliseconds ( 20 ) );
+  for ( size_t i = 0; i < 5; i++ )
+    log ( lShortLimiter , lLevel , "entry" );
+  std::this_thread::sleep_for ( std::chrono::milliseconds ( 30 ) );
+  log ( lShortLimiter , lLevel , "entry" );
+
+  BOOST_CHECK_EQUAL ( countLines ( lStream.str() ) , 4u );
+  BOOST_CHECK ( lStream.str().find ( "entry [2 similar entries suppressed]" ) != std::string::npos );
+  BOOST_CHECK_EQUAL ( lShortLimiter.suppressed() , 0u );
+
+  // Entries at levels that are excluded, at compile time or at runtime, are not counted
+  DebugLevel lDebug ( lStream );
+  InfoLevel lInfo ( lStream );
+  LogLevelGuard lGuard;
+  setLogLevelTo ( Notice() );
+  log ( lLimiter , lDebug , "excluded" );
+  log ( lLimiter , lInfo , "excluded" );
+  BOOST_CHECK_EQUAL ( lLimiter.suppressed() , 7u );
+}
+
+
+BOOST_AUTO_TEST_CASE(sampled_entries)
+{
+  std::ostringstream lStream;
+  FatalLevel lLevel ( lStream );
+
+  LogSampler lSampler ( 4 );
+  for ( size_t i = 0; i < 10; i++ )
+    log ( lSampler , lLevel , "entry " , Integer ( i ) );
+
+  // Entries 0, 4 and 8 are written
+  BOOST_CHECK_EQUAL ( countLines ( lStream.str() ) , 3u );
+  BOOST_CHECK ( lStream.str().find ( "entry 0" ) != std::string::npos );
+  BOOST_CHECK ( lStream.str().find ( "entry 1" ) == std::string::npos );
+  BOOST_CHECK ( lStream.str().find ( "entry 4 [3 similar entries suppressed]" ) != std::string::npos );
+  BOOST_CHECK ( lStream.str().find ( "entry 8 [3 similar entries suppressed]" ) != std::string::npos );
+  BOOST_CHECK_EQUAL ( lSampler.suppressed() , 1u );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // end ns tests
+} // end ns uhal
@@ -0,0 +1,169 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/ProtocolMmap.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+
+namespace uhal {
+namespace tests {
+
+
+namespace {
+
+//! Size of the region mapped by Mmap::File; the backing file must be at least this long
+const size_t kMappedSize = 32 * 1024;
+
+//! Value of each byte in the backing file before the test writes to it
+const uint8_t kFillByte = 0xA5;
+
+//! Temporary file standing in for the device file; filled with kFillByte on creation, and removed on destruction
+class TemporaryDeviceFile {
+public:
+  TemporaryDeviceFile() :
+    mPath("/tmp/uhal_mmap_XXXXXX")
+  {
+    const int lFd = mkstemp(&mPath[0]);
+    BOOST_REQUIRE(lFd != -1);
+    const std::vector<uint8_t> lContents(kMappedSize, kFillByte);
+    BOOST_REQUIRE_EQUAL(::write(lFd, lContents.data(), lContents.size()), ssize_t(kMappedSize));
+    ::close(lFd);
+  }
+
+  ~TemporaryDeviceFile()
+  {
+    unlink(mPath.c_str());
+  }
+
+  const std::string& getPath() const
+  {
+    return mPath;
+  }
+
+  //! Returns the current contents of the file, read without going through the mapping
+  std::vector<uint8_t> getContents() const
+  {
+    std::ifstream lFile(mPath.c_str(), std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(lFile), std::istreambuf_iterator<char>());
+  }
+
+private:
+  std::string mPath;
+};
+
+
+/**
+  Writes aNrWords random words to the file at byte address aAddr, split into fragments of (at most) aFragmentSize words, then
+  checks that the same words are read back both through the mapping and from the file itself, and that the rest of the file is untouched
+*/
+void checkWriteRead(const uint32_t aAddr, const size_t aNrWords, const size_t aFragmentSize)
+{
+  BOOST_TEST_MESSAGE("  " << aNrWords << " words at byte address 0x" << std::hex << aAddr << std::dec << ", in fragments of up to " << aFragmentSize << " words");
+
+  TemporaryDeviceFile lDeviceFile;
+  std::vector<uint32_t> lWords(aNrWords);
+  for (size_t i = 0; i < aNrWords; i++)
+    lWords.at(i) = static_cast<uint32_t>(rand());
+
+  std::vector<std::pair<const uint8_t*, size_t> > lFragments;
+  for (size_t i = 0; i < aNrWords; i += aFragmentSize)
+    lFragments.push_back(std::make_pair(reinterpret_cast<const uint8_t*>(lWords.data() + i), 4 * std::min(aFragmentSize, aNrWords - i)));
+
+  {
+    Mmap::File lFile(lDeviceFile.getPath(), O_RDWR | O_SYNC);
+    lFile.write(aAddr, lFragments);
+
+    std::vector<uint32_t> lValues;
+    lFile.read(aAddr / 4, aNrWords, lValues);
+    BOOST_CHECK_EQUAL_COLLECTIONS(lValues.begin(), lValues.end(), lWords.begin(), lWords.end());
+  }
+
+  // Last 64-bit store is zero-extended if the packet has an odd number of words
+  const size_t lEnd = aAddr + 4 * aNrWords + 4 * (aNrWords % 2);
+  const std::vector<uint8_t> lContents(lDeviceFile.getContents());
+  BOOST_REQUIRE_EQUAL(lContents.size(), kMappedSize);
+  BOOST_CHECK(std::equal(lContents.begin() + aAddr, lContents.begin() + aAddr + 4 * aNrWords, reinterpret_cast<const uint8_t*>(lWords.data())));
+  BOOST_CHECK(std::count(lContents.begin(), lContents.begin() + aAddr, kFillByte) == std::ptrdiff_t(aAddr));
+  BOOST_CHECK(std::count(lContents.begin() + aAddr + 4 * aNrWords, lContents.begin() + lEnd, 0) == std::ptrdiff_t(lEnd - aAddr - 4 * aNrWords));
+  BOOST_CHECK(std::count(lContents.begin() + lEnd, lContents.end(), kFillByte) == std::ptrdiff_t(kMappedSize - lEnd));
+}
+
+
+//! Packet lengths (in words) that exercise whole 64-byte store blocks, partial blocks, and odd numbers of words
+const std::vector<size_t> kNrWords = { 1, 2, 3, 15, 16, 17, 31, 32, 33, 100, 257, 1023 };
+
+//! Fragment sizes (in words) that exercise fragments straddling block boundaries, as well as a single fragment per packet
+const std::vector<size_t> kFragmentSizes = { 1, 3, 16, 21, 4096 };
+
+}
+
+
+BOOST_AUTO_TEST_SUITE( ipbusmmap_2_0 )
+
+BOOST_AUTO_TEST_SUITE( MmapFileTestSuite )
+
+
+BOOST_AUTO_TEST_CASE( streaming_store_write_read )
+{
+  // Mapping is page-aligned, so destination is aligned for the 16-byte non-temporal stores
+  for (const size_t lNrWords : kNrWords) {
+    for (const size_t lFragmentSize : kFragmentSizes)
+      checkWriteRead(0x1000, lNrWords, lFragmentSize);
+  }
+}
+
+
+BOOST_AUTO_TEST_CASE( unaligned_write_read )
+{
+  // Destination is only 4-byte aligned, so the 64-bit store fallback is used instead
+  for (const size_t lNrWords : kNrWords) {
+    for (const size_t lFragmentSize : kFragmentSizes)
+      checkWriteRead(0x1004, lNrWords, lFragmentSize);
+  }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+} // end ns tests
+} // end ns uhal
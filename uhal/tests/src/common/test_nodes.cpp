@@ -26,10 +26,13 @@
 ---------------------------------------------------------------------------
 */
 
+#include <fstream>
 #include <iomanip>
+#include <iterator>
 #include <typeinfo>
 
 #include "uhal/NodeTreeBuilder.hpp"
+#include "uhal/utilities/files.hpp"
 #include "uhal/utilities/xml.hpp"
 #include "uhal/uhal.hpp"
 
@@ -748,6 +751,210 @@ BOOST_FIXTURE_TEST_CASE (address_description, DummyAddressFileFixture) {
 }
 
 
+BOOST_FIXTURE_TEST_CASE (shared_node_trees, DummyAddressFileFixture) {
+  HwInterface lHw1 = ConnectionManager::getDevice("board1", "ipbusudp-2.0://localhost:50001", addrFileURI);
+  HwInterface lHw2 = ConnectionManager::getDevice("board2", "ipbusudp-2.0://localhost:50002", addrFileURI);
+  HwInterface lHw1Copy(lHw1);
+
+  // Copies of a HwInterface share the node tree
+  BOOST_CHECK_EQUAL(&lHw1Copy.getNode(), &lHw1.getNode());
+  BOOST_CHECK_EQUAL(&lHw1Copy.getNode("SUBSYSTEM1.REG"), &lHw1.getNode("SUBSYSTEM1.REG"));
+
+  // Devices have their own nodes, bound to their own client, but share the device-independent attributes
+  const Node& lNode1 = lHw1.getNode("SUBSYSTEM3.DERIVEDNODE.REG");
+  const Node& lNode2 = lHw2.getNode("SUBSYSTEM3.DERIVEDNODE.REG");
+  BOOST_CHECK(&lNode1 != &lNode2);
+  BOOST_CHECK_EQUAL(&lNode1.getClient(), &lHw1.getClient());
+  BOOST_CHECK_EQUAL(&lNode2.getClient(), &lHw2.getClient());
+  BOOST_CHECK(lNode1 == lNode2);
+  BOOST_CHECK_EQUAL(&lNode1.getId(), &lNode2.getId());
+  BOOST_CHECK_EQUAL(&lNode1.getParameters(), &lNode2.getParameters());
+  BOOST_CHECK_EQUAL(typeid(lHw1.getNode("SUBSYSTEM3.DERIVEDNODE")).name(), typeid(lHw2.getNode("SUBSYSTEM3.DERIVEDNODE")).name());
+}
+
+
+BOOST_FIXTURE_TEST_CASE (indexed_node_lookup, DummyAddressFileFixture) {
+  HwInterface lHw1 = ConnectionManager::getDevice("board1", "ipbusudp-2.0://localhost:50001", addrFileURI);
+  HwInterface lHw2 = ConnectionManager::getDevice("board2", "ipbusudp-2.0://localhost:50002", addrFileURI);
+
+  for (const std::string& lId : lHw1.getNodes()) {
+    // Full-path lookups from the top node must match lookups level-by-level, and stay within the device's own tree
+    const Node& lNode = lHw1.getNode(lId);
+    BOOST_CHECK_EQUAL(lNode.getPath(), lId);
+    BOOST_CHECK_EQUAL(&lNode.getClient(), &lHw1.getClient());
+    BOOST_CHECK(&lHw2.getNode(lId) != &lNode);
+
+    // Lookups from every ancestor, including those inside modules, must find the same node
+    for (size_t lDotIdx = lId.find('.'); lDotIdx != std::string::npos; lDotIdx = lId.find('.', lDotIdx + 1)) {
+      BOOST_CHECK_EQUAL(&lHw1.getNode(lId.substr(0, lDotIdx)).getNode(lId.substr(lDotIdx + 1)), &lNode);
+    }
+  }
+
+  BOOST_CHECK_THROW(lHw1.getNode("SUBSYSTEM1.NONEXISTENT"), uhal::exception::NoBranchFoundWithGivenUID);
+  BOOST_CHECK_THROW(lHw1.getNode("SUBSYSTEM1..REG"), uhal::exception::NoBranchFoundWithGivenUID);
+  BOOST_CHECK_THROW(lHw1.getNode("SUBSYSTEM1").getNode("SUBSYSTEM1.REG"), uhal::exception::NoBranchFoundWithGivenUID);
+}
+
+
+BOOST_FIXTURE_TEST_CASE (parallel_module_loading, DummyAddressFileFixture) {
+  NodeTreeBuilder& lBuilder = NodeTreeBuilder::getInstance();
+  const size_t lOriginalNrThreads(lBuilder.getNumberOfThreads());
+
+  lBuilder.setNumberOfThreads(0);
+  lBuilder.clearAddressFileCache();
+  const std::shared_ptr<uhal::Node> lSerialNode(lBuilder.getNodeTree(addrFileURI, boost::filesystem::current_path() / "."));
+
+  lBuilder.setNumberOfThreads(4);
+  lBuilder.clearAddressFileCache();
+  const std::shared_ptr<uhal::Node> lParallelNode(lBuilder.getNodeTree(addrFileURI, boost::filesystem::current_path() / "."));
+
+  const std::vector<std::string> lIds(lSerialNode->getNodes());
+  BOOST_CHECK(lParallelNode->getNodes() == lIds);
+  for (const std::string& lId : lIds) {
+    BOOST_CHECK(lParallelNode->getNode(lId) == lSerialNode->getNode(lId));
+    BOOST_CHECK_EQUAL(lParallelNode->getNode(lId).getModule(), lSerialNode->getNode(lId).getModule());
+    BOOST_CHECK_EQUAL(typeid(lParallelNode->getNode(lId)).name(), typeid(lSerialNode->getNode(lId)).name());
+  }
+
+  lBuilder.setNumberOfThreads(lOriginalNrThreads);
+  lBuilder.clearAddressFileCache();
+}
+
+
+BOOST_AUTO_TEST_CASE (parallel_module_loading_missing_file) {
+  const boost::filesystem::path lDir(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("uhal-modules-%%%%%%%%"));
+  boost::filesystem::create_directories(lDir);
+  NodeTreeBuilder& lBuilder = NodeTreeBuilder::getInstance();
+  const size_t lOriginalNrThreads(lBuilder.getNumberOfThreads());
+  lBuilder.setNumberOfThreads(4);
+
+  // Errors from reading module files in other threads are reported when the module node is built
+  std::ofstream((lDir / "top.xml").c_str()) << "<node><node id=\"A\" module=\"file://a.xml\"/><node id=\"B\" address=\"0x10\" module=\"file://missing.xml\"/></node>";
+  std::ofstream((lDir / "a.xml").c_str()) << "<node><node id=\"REG\" address=\"0x1\"/></node>";
+  BOOST_CHECK_THROW(lBuilder.getNodeTree("file://" + (lDir / "top.xml").string(), lDir / "."), exception::FileNotFound);
+
+  std::ofstream((lDir / "missing.xml").c_str()) << "<node><node id=\"REG\" address=\"0x2\"/></node>";
+  const std::shared_ptr<uhal::Node> lNode(lBuilder.getNodeTree("file://" + (lDir / "top.xml").string(), lDir / "."));
+  BOOST_CHECK_EQUAL(lNode->getNode("B.REG").getAddress(), uint32_t(0x12));
+
+  lBuilder.setNumberOfThreads(lOriginalNrThreads);
+  lBuilder.clearAddressFileCache();
+  boost::filesystem::remove_all(lDir);
+}
+
+
+BOOST_AUTO_TEST_CASE (module_attributes_shared_when_address_unchanged) {
+  const boost::filesystem::path lDir(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("uhal-modules-%%%%%%%%"));
+  boost::filesystem::create_directories(lDir);
+  NodeTreeBuilder& lBuilder = NodeTreeBuilder::getInstance();
+
+  std::ofstream((lDir / "top.xml").c_str()) << "<node><node id=\"A\" module=\"file://a.xml\"/><node id=\"B\" address=\"0x10\" module=\"file://a.xml\"/></node>";
+  std::ofstream((lDir / "a.xml").c_str()) << "<node><node id=\"REG\" address=\"0x1\"/></node>";
+  const std::shared_ptr<uhal::Node> lModule(lBuilder.getNodeTree("file://" + (lDir / "a.xml").string(), lDir / "."));
+  const std::shared_ptr<uhal::Node> lTop(lBuilder.getNodeTree("file://" + (lDir / "top.xml").string(), lDir / "."));
+
+  // The attributes of module nodes are only copied where the module's placement changes their address
+  BOOST_CHECK_EQUAL(lTop->getNode("A.REG").getAddress(), uint32_t(0x1));
+  BOOST_CHECK_EQUAL(lTop->getNode("B.REG").getAddress(), uint32_t(0x11));
+  BOOST_CHECK_EQUAL(&lTop->getNode("A.REG").getId(), &lModule->getNode("REG").getId());
+  BOOST_CHECK(&lTop->getNode("B.REG").getId() != &lModule->getNode("REG").getId());
+
+  lBuilder.clearAddressFileCache();
+  boost::filesystem::remove_all(lDir);
+}
+
+
+BOOST_FIXTURE_TEST_CASE (compiled_address_files, DummyAddressFileFixture) {
+  const boost::filesystem::path lCacheDir(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("uhal-cache-%%%%%%%%"));
+  NodeTreeBuilder& lBuilder = NodeTreeBuilder::getInstance();
+  const boost::filesystem::path lOriginalCacheDir(lBuilder.getCacheDirectory());
+  lBuilder.setCacheDirectory(lCacheDir);
+  lBuilder.clearAddressFileCache();
+
+  // First call parses the XML files and writes the compiled address table
+  std::shared_ptr<uhal::Node> lTopNode(lBuilder.getNodeTree(addrFileURI, boost::filesystem::current_path() / "."));
+  BOOST_REQUIRE(boost::filesystem::is_directory(lCacheDir));
+  BOOST_CHECK(not boost::filesystem::is_empty(lCacheDir));
+
+  // Second call (e.g. from a new process) loads the compiled address table
+  lBuilder.clearAddressFileCache();
+  lTopNode.reset(lBuilder.getNodeTree(addrFileURI, boost::filesystem::current_path() / "."));
+  checkNodeTree(*lTopNode, nodeProperties);
+
+  lBuilder.setCacheDirectory(lOriginalCacheDir);
+  lBuilder.clearAddressFileCache();
+  boost::filesystem::remove_all(lCacheDir);
+}
+
+
+BOOST_AUTO_TEST_CASE (compiled_address_file_out_of_date) {
+  const boost::filesystem::path lDir(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("uhal-cache-%%%%%%%%"));
+  boost::filesystem::create_directories(lDir);
+  NodeTreeBuilder& lBuilder = NodeTreeBuilder::getInstance();
+  const boost::filesystem::path lOriginalCacheDir(lBuilder.getCacheDirectory());
+  lBuilder.setCacheDirectory(lDir / "cache");
+  lBuilder.clearAddressFileCache();
+
+  std::ofstream((lDir / "top.xml").c_str()) << "<node><node id=\"MODULE\" address=\"0x100\" module=\"file://module.xml\"/></node>";
+  std::ofstream((lDir / "module.xml").c_str()) << "<node><node id=\"REG\" address=\"0x1\" description=\"first\"/></node>";
+  std::shared_ptr<uhal::Node> lTopNode(lBuilder.getNodeTree("file://" + (lDir / "top.xml").string(), lDir / "."));
+  BOOST_CHECK_EQUAL(lTopNode->getNode("MODULE.REG").getAddress(), uint32_t(0x101));
+  BOOST_CHECK_EQUAL(lTopNode->getNode("MODULE.REG").getDescription(), "first");
+
+  // Changing a module file must invalidate the compiled version of the top-level file
+  std::ofstream((lDir / "module.xml").c_str()) << "<node><node id=\"REG\" address=\"0x2\" description=\"second\"/></node>";
+  lBuilder.clearAddressFileCache();
+  lTopNode.reset(lBuilder.getNodeTree("file://" + (lDir / "top.xml").string(), lDir / "."));
+  BOOST_CHECK_EQUAL(lTopNode->getNode("MODULE.REG").getAddress(), uint32_t(0x102));
+  BOOST_CHECK_EQUAL(lTopNode->getNode("MODULE.REG").getDescription(), "second");
+
+  lBuilder.setCacheDirectory(lOriginalCacheDir);
+  lBuilder.clearAddressFileCache();
+  boost::filesystem::remove_all(lDir);
+}
+
+
+BOOST_AUTO_TEST_CASE (compiled_address_file_corrupt) {
+  const boost::filesystem::path lDir(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("uhal-cache-%%%%%%%%"));
+  boost::filesystem::create_directories(lDir);
+  NodeTreeBuilder& lBuilder = NodeTreeBuilder::getInstance();
+  const boost::filesystem::path lOriginalCacheDir(lBuilder.getCacheDirectory());
+  lBuilder.setCacheDirectory(lDir / "cache");
+  lBuilder.clearAddressFileCache();
+
+  const std::string lAddrFileURI("file://" + (lDir / "top.xml").string());
+  std::ofstream((lDir / "top.xml").c_str()) << "<node><node id=\"REG\" address=\"0x1\" parameters=\"a=1;b=2\" fwinfo=\"endpoint;width=2\"/></node>";
+  std::shared_ptr<uhal::Node> lTopNode(lBuilder.getNodeTree(lAddrFileURI, lDir / "."));
+
+  BOOST_REQUIRE(boost::filesystem::is_directory(lDir / "cache"));
+  const boost::filesystem::path lCacheFile(boost::filesystem::directory_iterator(lDir / "cache")->path());
+  std::string lContents;
+  {
+    std::ifstream lFile(lCacheFile.c_str(), std::ios::binary);
+    lContents.assign(std::istreambuf_iterator<char>(lFile), std::istreambuf_iterator<char>());
+  }
+  BOOST_REQUIRE(lContents.size() > 4);
+
+  // Whichever field is corrupted (e.g. a size being 0xFFFFFFFF) or truncated, the address table must still be loaded
+  for (size_t i = 0; i < lContents.size(); i++) {
+    std::string lCorrupted(lContents);
+    if (i + 4 <= lContents.size())
+      lCorrupted.replace(i, 4, 4, '\xFF');
+    else
+      lCorrupted.resize(i);
+    std::ofstream(lCacheFile.c_str(), std::ios::binary | std::ios::trunc) << lCorrupted;
+
+    lBuilder.clearAddressFileCache();
+    BOOST_CHECK_NO_THROW(lTopNode.reset(lBuilder.getNodeTree(lAddrFileURI, lDir / ".")));
+    BOOST_CHECK(lTopNode);
+  }
+
+  lBuilder.setCacheDirectory(lOriginalCacheDir);
+  lBuilder.clearAddressFileCache();
+  boost::filesystem::remove_all(lDir);
+}
+
+
 BOOST_AUTO_TEST_SUITE( simple )
 
 BOOST_FIXTURE_TEST_CASE (valid_default, SimpleAddressTableFixture)
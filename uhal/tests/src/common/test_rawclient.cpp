@@ -205,6 +205,46 @@ UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(RawClientTestSuite, mem_rmw_sum, DummyHardwa
 )
 
 
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(RawClientTestSuite, values_outlive_client, DummyHardwareFixture,
+{
+  const size_t N = 1000;
+  std::vector< ValWord<uint32_t> > regs;
+  ValVector<uint32_t> mem;
+  uint32_t x = static_cast<uint32_t> ( rand() );
+
+  {
+    HwInterface hw = getHwInterface();
+    ClientInterface* c = &hw.getClient();
+    uint32_t addr = hw.getNode ( "REG" ).getAddress();
+    c->write ( addr,x );
+
+    // Enough returned objects that the client's memory pool has to reuse and grow its free lists
+    for ( size_t i=0; i!= N; ++i )
+    {
+      regs.push_back ( c->read ( addr ) );
+      if ( i % 2 )
+      {
+        regs.pop_back();
+      }
+    }
+
+    mem = c->readBlock ( hw.getNode ( "MEM" ).getAddress(), 16 );
+    c->dispatch();
+  }
+
+  // The values must remain accessible after the HwInterface and client have been destroyed
+  for ( std::vector< ValWord<uint32_t> >::iterator lIt = regs.begin(); lIt != regs.end(); lIt++ )
+  {
+    BOOST_CHECK ( lIt->valid() );
+    BOOST_CHECK_EQUAL ( lIt->value(), x );
+  }
+
+  BOOST_CHECK ( mem.valid() );
+  BOOST_CHECK_EQUAL ( mem.size(), size_t ( 16 ) );
+}
+)
+
+
 } // end ns tests
 } // end ns uhal
 
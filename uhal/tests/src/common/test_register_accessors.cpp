@@ -0,0 +1,130 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+#include "uhal/uhal.hpp"
+#include "uhal/RegisterAccessors.hpp"
+
+#include "uhal/tests/definitions.hpp"
+#include "uhal/tests/fixtures.hpp"
+#include "uhal/tests/tools.hpp"
+#include "uhal/tests/uhal_registers_dummy_address.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+#include <vector>
+
+
+namespace uhal {
+namespace tests {
+
+
+// Same path as dummy_address::REG, but wrong address
+struct STALE_REG
+{
+  static constexpr const char* path = "REG";
+  static constexpr uint32_t address = 0x00000002;
+  static constexpr uint32_t mask = 0xffffffff;
+  static constexpr uhal::defs::NodePermission permission = uhal::defs::READWRITE;
+  static constexpr uhal::defs::BlockReadWriteMode mode = uhal::defs::SINGLE;
+  static constexpr uint32_t size = 0x1;
+};
+
+
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(RegisterAccessorTestSuite, matches_address_table, DummyHardwareFixture,
+{
+  HwInterface hw = getHwInterface();
+
+  BOOST_CHECK ( registers::matches<dummy_address::REG> ( hw.getNode() ) );
+  BOOST_CHECK ( registers::matches<dummy_address::REG_UPPER_MASK> ( hw.getNode() ) );
+  BOOST_CHECK ( registers::matches<dummy_address::SMALL_MEM> ( hw.getNode() ) );
+  BOOST_CHECK ( registers::matches<dummy_address::SUBSYSTEM1> ( hw.getNode() ) );
+  BOOST_CHECK ( registers::matches<dummy_address::SUBSYSTEM1::REG> ( hw.getNode() ) );
+  BOOST_CHECK ( registers::matches<dummy_address::SUBSYSTEM2::SUBMODULE::MEM> ( hw.getNode() ) );
+  BOOST_CHECK ( registers::matches<dummy_address::REG_READ_ONLY> ( hw.getNode() ) );
+  BOOST_CHECK ( registers::matches<dummy_address::FIFO> ( hw.getNode() ) );
+  BOOST_CHECK ( registers::matches<dummy_address::LARGE_MEM> ( hw.getNode() ) );
+  BOOST_CHECK ( !registers::matches<STALE_REG> ( hw.getNode() ) );
+}
+)
+
+
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(RegisterAccessorTestSuite, write_read, DummyHardwareFixture,
+{
+  HwInterface hw = getHwInterface();
+  ClientInterface& lClient = hw.getClient();
+
+  uint32_t x = static_cast<uint32_t> ( rand() );
+  uint32_t y = static_cast<uint32_t> ( rand() ) & 0xFFFF;
+  registers::write<dummy_address::REG> ( lClient , x );
+  registers::write<dummy_address::REG_UPPER_MASK> ( lClient , y );
+  registers::write<dummy_address::SUBSYSTEM1::REG> ( lClient , ~x );
+  BOOST_CHECK_THROW ( registers::write<dummy_address::REG_UPPER_MASK> ( lClient , 0x1FFFF ) , uhal::exception::exception );
+  ValWord<uint32_t> lReg = registers::read<dummy_address::REG> ( lClient );
+  ValWord<uint32_t> lMasked = hw.getNode ( "REG_UPPER_MASK" ).read();
+  ValWord<uint32_t> lSubReg = hw.getNode ( "SUBSYSTEM1.REG" ).read();
+  hw.dispatch();
+
+  BOOST_CHECK_EQUAL ( lReg.value(), x );
+  BOOST_CHECK_EQUAL ( lMasked.value(), y );
+  BOOST_CHECK_EQUAL ( lSubReg.value(), ~x );
+}
+)
+
+
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(RegisterAccessorTestSuite, block_write_read, DummyHardwareFixture,
+{
+  HwInterface hw = getHwInterface();
+  ClientInterface& lClient = hw.getClient();
+
+  std::vector<uint32_t> lValues;
+  for ( size_t i = 0; i != dummy_address::SMALL_MEM::size; i++ )
+  {
+    lValues.push_back ( static_cast<uint32_t> ( rand() ) );
+  }
+
+  registers::writeBlock<dummy_address::SMALL_MEM> ( lClient , lValues );
+  ValVector<uint32_t> lMem = registers::readBlock<dummy_address::SMALL_MEM> ( lClient , lValues.size() );
+  BOOST_CHECK_THROW ( registers::readBlock<dummy_address::SMALL_MEM> ( lClient , lValues.size() + 1 ) , uhal::exception::BulkTransferRequestedTooLarge );
+  BOOST_CHECK_THROW ( registers::readBlock<dummy_address::REG> ( lClient , 2 ) , uhal::exception::BulkTransferOnSingleRegister );
+  hw.dispatch();
+
+  BOOST_CHECK ( std::equal ( lValues.begin() , lValues.end() , lMem.begin() ) );
+}
+)
+
+
+} // end ns tests
+} // end ns uhal
@@ -37,6 +37,7 @@
 #include "uhal/tests/definitions.hpp"
 #include "uhal/tests/fixtures.hpp"
 #include "uhal/tests/tools.hpp"
+#include "uhal/tests/UDPDummyHardware.hpp"
 
 #include <boost/test/unit_test.hpp>
 #include <boost/filesystem.hpp>
@@ -45,7 +46,9 @@
 #include <algorithm>
 #include <string>
 #include <iostream>
+#include <chrono>
 #include <cstdlib>
+#include <future>
 #include <typeinfo>
 
 
@@ -76,6 +79,117 @@ UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(SingleReadWriteTestSuite, connect_write_read
 )
 
 
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(SingleReadWriteTestSuite, write_read_async_dispatch, DummyHardwareFixture,
+{
+  HwInterface hw = getHwInterface();
+
+  uint32_t x1 = static_cast<uint32_t> ( rand() );
+  uint32_t x2 = static_cast<uint32_t> ( rand() );
+  hw.getNode ( "SUBSYSTEM1.REG" ).write ( x1 );
+  hw.getNode ( "SUBSYSTEM2.REG" ).write ( x2 );
+  ValWord< uint32_t > mem1 = hw.getNode ( "SUBSYSTEM1.REG" ).read();
+  ValWord< uint32_t > mem2 = hw.getNode ( "SUBSYSTEM2.REG" ).read();
+  std::future<void> lFuture = hw.dispatchAsync();
+  BOOST_CHECK_NO_THROW ( lFuture.get() );
+  BOOST_CHECK ( mem1.valid() );
+  BOOST_CHECK ( mem2.valid() );
+  BOOST_CHECK_EQUAL ( mem1.value(), x1 );
+  BOOST_CHECK_EQUAL ( mem2.value(), x2 );
+
+  // Transactions queued after an asynchronous dispatch are sent in the next dispatch
+  lFuture = hw.dispatchAsync();
+  ValWord< uint32_t > mem3 = hw.getNode ( "SUBSYSTEM1.REG" ).read();
+  BOOST_CHECK_NO_THROW ( lFuture.get() );
+  BOOST_CHECK_NO_THROW ( hw.dispatchAsync().get() );
+  BOOST_CHECK ( mem3.valid() );
+  BOOST_CHECK_EQUAL ( mem3.value(), x1 );
+
+  // With nothing queued, the future is ready immediately
+  lFuture = hw.dispatchAsync();
+  BOOST_CHECK ( lFuture.wait_for ( std::chrono::seconds ( 0 ) ) == std::future_status::ready );
+}
+)
+
+
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(SingleReadWriteTestSuite, destroy_client_during_async_dispatch, DummyHardwareFixture,
+{
+  // Destroy the client while the replies may still be arriving, or while the completion thread may be using the client
+  for ( size_t i = 0; i < 100; i++ )
+  {
+    std::future<void> lFuture;
+    {
+      HwInterface hw = getHwInterface();
+      hw.getNode ( "REG" ).write ( static_cast<uint32_t> ( rand() ) );
+      hw.getNode ( "LARGE_MEM" ).readBlock ( 1024 );
+      lFuture = hw.dispatchAsync();
+    }
+
+    // The future has either been completed, or failed since the client was destroyed first
+    BOOST_REQUIRE ( lFuture.wait_for ( std::chrono::seconds ( 0 ) ) == std::future_status::ready );
+    try
+    {
+      lFuture.get();
+    }
+    catch ( const std::future_error& aExc )
+    {
+      BOOST_CHECK ( aExc.code() == std::future_errc::broken_promise );
+    }
+  }
+}
+)
+
+
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(SingleReadWriteTestSuite, write_read_dispatch_group, DummyHardwareFixture,
+{
+  HwInterface hw1 = getHwInterface();
+
+  // A device that nothing is listening to, whose failure must not affect the other devices
+  std::string address_file;
+  {
+    boost::filesystem::path conn_fn ( connectionFileURI );
+    boost::filesystem::path fn ( "dummy_address.xml" );
+    address_file = ( conn_fn.parent_path() /fn ).string();
+  }
+  HwInterface hw2 = ConnectionManager::getDevice ( "unreachable", "ipbusudp-2.0://localhost:60099", address_file );
+  hw2.setTimeoutPeriod(timeout);
+  // A second failing device with the same ID, whose failure must be reported separately
+  HwInterface hw3 = ConnectionManager::getDevice ( "unreachable", "ipbusudp-2.0://localhost:60098", address_file );
+  hw3.setTimeoutPeriod(timeout);
+
+  DispatchGroup lGroup;
+  lGroup.add ( hw2 );
+  lGroup.add ( hw1 );
+  lGroup.add ( hw3 );
+  BOOST_CHECK_EQUAL ( lGroup.size(), size_t ( 3 ) );
+
+  uint32_t x1 = static_cast<uint32_t> ( rand() );
+  uint32_t x2 = static_cast<uint32_t> ( rand() );
+  hw1.getNode ( "SUBSYSTEM1.REG" ).write ( x1 );
+  hw1.getNode ( "SUBSYSTEM2.REG" ).write ( x2 );
+  ValWord< uint32_t > mem1 = hw1.getNode ( "SUBSYSTEM1.REG" ).read();
+  ValWord< uint32_t > mem2 = hw1.getNode ( "SUBSYSTEM2.REG" ).read();
+  ValWord< uint32_t > mem3 = hw2.getNode ( "REG" ).read();
+  ValWord< uint32_t > mem5 = hw3.getNode ( "REG" ).read();
+
+  const auto lErrors = lGroup.dispatch();
+  BOOST_CHECK_EQUAL ( lErrors.size(), size_t ( 2 ) );
+  BOOST_CHECK ( lErrors.count ( 0 ) );
+  BOOST_CHECK ( lErrors.count ( 2 ) );
+  BOOST_CHECK ( mem1.valid() );
+  BOOST_CHECK ( mem2.valid() );
+  BOOST_CHECK ( !mem3.valid() );
+  BOOST_CHECK ( !mem5.valid() );
+  BOOST_CHECK_EQUAL ( mem1.value(), x1 );
+  BOOST_CHECK_EQUAL ( mem2.value(), x2 );
+
+  // The group can be dispatched again once the failed device's transactions have been discarded
+  ValWord< uint32_t > mem4 = hw1.getNode ( "SUBSYSTEM1.REG" ).read();
+  BOOST_CHECK_EQUAL ( lGroup.dispatch().size(), size_t ( 0 ) );
+  BOOST_CHECK_EQUAL ( mem4.value(), x1 );
+}
+)
+
+
 UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(SingleReadWriteTestSuite, on_the_fly_connect_write_read, DummyHardwareFixture,
 {
   //get location of address file. Assumption: it is located with the connection file
@@ -111,6 +225,72 @@ UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(SingleReadWriteTestSuite, search_device_id,
 )
 
 
+BOOST_AUTO_TEST_SUITE( ipbusudp_2_0 )
+BOOST_AUTO_TEST_SUITE( SingleReadWriteTestSuite )
+
+BOOST_FIXTURE_TEST_CASE( dispatch_group_overlaps_delayed_devices , DummyHardwareFixture<IPBUS_2_0_UDP> )
+{
+  // Two more dummy devices, so that each member of the group waits for its own delayed hardware
+  DummyHardwareRunner lRunner2 ( new UDPDummyHardware<2,0> ( 60003 , 0 , false ) );
+  DummyHardwareRunner lRunner3 ( new UDPDummyHardware<2,0> ( 60004 , 0 , false ) );
+  const std::vector< DummyHardwareRunner* > lRunners = { &hwRunner , &lRunner2 , &lRunner3 };
+
+  std::string address_file;
+  {
+    boost::filesystem::path conn_fn ( connectionFileURI );
+    boost::filesystem::path fn ( "dummy_address.xml" );
+    address_file = ( conn_fn.parent_path() /fn ).string();
+  }
+  std::vector< HwInterface > lDevices;
+  lDevices.push_back ( getHwInterface() );
+  lDevices.push_back ( ConnectionManager::getDevice ( "dummy.udp2.second", "ipbusudp-2.0://localhost:60003", address_file ) );
+  lDevices.push_back ( ConnectionManager::getDevice ( "dummy.udp2.third", "ipbusudp-2.0://localhost:60004", address_file ) );
+
+  // Each device delays its reply to the next packet, so dispatching a single read takes at least the delay
+  const std::chrono::milliseconds lDelay ( 100 );
+
+  // Dispatch the devices one after the other
+  std::chrono::steady_clock::duration lSerialTime ( 0 );
+  for ( size_t i = 0; i < lDevices.size(); i++ )
+  {
+    lDevices.at ( i ).setTimeoutPeriod ( timeout );
+    lRunners.at ( i )->setReplyDelay ( lDelay );
+    ValWord< uint32_t > lMem = lDevices.at ( i ).getNode ( "REG" ).read();
+    const std::chrono::steady_clock::time_point lStart = std::chrono::steady_clock::now();
+    BOOST_CHECK_NO_THROW ( lDevices.at ( i ).dispatch() );
+    lSerialTime += std::chrono::steady_clock::now() - lStart;
+    BOOST_CHECK ( lMem.valid() );
+  }
+  BOOST_CHECK ( lSerialTime >= lDevices.size() * lDelay );
+
+  // Dispatch the same transactions as a group, whose members wait for their replies concurrently
+  DispatchGroup lGroup;
+  std::vector< ValWord< uint32_t > > lMems;
+  for ( size_t i = 0; i < lDevices.size(); i++ )
+  {
+    lGroup.add ( lDevices.at ( i ) );
+    lRunners.at ( i )->setReplyDelay ( lDelay );
+    lMems.push_back ( lDevices.at ( i ).getNode ( "REG" ).read() );
+  }
+  const std::chrono::steady_clock::time_point lStart = std::chrono::steady_clock::now();
+  BOOST_CHECK_EQUAL ( lGroup.dispatch().size(), size_t ( 0 ) );
+  const std::chrono::steady_clock::duration lGroupTime = std::chrono::steady_clock::now() - lStart;
+  for ( size_t i = 0; i < lMems.size(); i++ )
+  {
+    BOOST_CHECK ( lMems.at ( i ).valid() );
+  }
+
+  BOOST_TEST_MESSAGE ( "  Serial dispatch: " << std::chrono::duration_cast< std::chrono::milliseconds > ( lSerialTime ).count() << " ms, "
+                       << "group dispatch: " << std::chrono::duration_cast< std::chrono::milliseconds > ( lGroupTime ).count() << " ms" );
+  // The group's wall time is under the sum of the members' dispatch times, by at least one delay so that timing jitter cannot hide serial waits
+  BOOST_CHECK ( lGroupTime >= lDelay );
+  BOOST_CHECK ( lGroupTime < lSerialTime - lDelay );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+
 } // end ns tests
 } // end ns uhal
 
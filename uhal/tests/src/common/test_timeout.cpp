@@ -35,14 +35,20 @@
 #include "uhal/uhal.hpp"
 
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
+#include <future>
 #include <iostream>
 #include <thread>
+#include <string>
 #include <typeinfo>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
 
+#include "uhal/IOServicePool.hpp"
 #include "uhal/ProtocolUDP.hpp"
 #include "uhal/ProtocolTCP.hpp"
 #include "uhal/ProtocolPCIe.hpp"
@@ -64,6 +70,8 @@ UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(TimeoutTestSuite, check_timeout, DummyHardwa
 
   // Check we get an exception when first packet timeout occurs (dummy hardware only has delay on first packet)
   BOOST_CHECK_THROW ( { hw.getNode ( "REG" ).read();  hw.dispatch(); } , uhal::exception::ClientTimeout );
+  BOOST_CHECK_EQUAL ( hw.getClient().getMetrics().getTimeouts() , 1u );
+  BOOST_CHECK_EQUAL ( hw.getClient().getMetrics().getPacketsInFlight() , 0u );
 
   const std::chrono::milliseconds sleepDuration = std::chrono::milliseconds(timeout) + std::chrono::seconds(1);
   BOOST_TEST_MESSAGE("Sleeping for " << sleepDuration.count() << "ms to allow DummyHardware to clear itself");
@@ -81,5 +89,343 @@ UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(TimeoutTestSuite, check_timeout, DummyHardwa
 )
 
 
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(TimeoutTestSuite, check_timeout_async_dispatch, DummyHardwareFixture,
+{
+  hwRunner.setReplyDelay( std::chrono::milliseconds(timeout) + std::chrono::seconds(1) );
+  HwInterface hw = getHwInterface();
+
+  // The timeout exception is delivered through the future
+  hw.getNode ( "REG" ).read();
+  std::future<void> lFuture = hw.dispatchAsync();
+  BOOST_CHECK_THROW ( lFuture.get() , uhal::exception::ClientTimeout );
+
+  const std::chrono::milliseconds sleepDuration = std::chrono::milliseconds(timeout) + std::chrono::seconds(1);
+  BOOST_TEST_MESSAGE("Sleeping for " << sleepDuration.count() << "ms to allow DummyHardware to clear itself");
+  std::this_thread::sleep_for(sleepDuration);
+  // Check we can continue as normal without further exceptions.
+  uint32_t x = static_cast<uint32_t> ( rand() );
+  hw.getNode ( "REG" ).write ( x );
+  ValWord<uint32_t> y = hw.getNode ( "REG" ).read();
+  BOOST_CHECK_NO_THROW ( hw.dispatchAsync().get() );
+  BOOST_CHECK ( x == y );
+}
+)
+
+
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(TimeoutTestSuite, check_timeout_dispatch_during_async_dispatch, DummyHardwareFixture,
+{
+  hwRunner.setReplyDelay( std::chrono::milliseconds(timeout) + std::chrono::seconds(1) );
+  HwInterface hw = getHwInterface();
+
+  hw.getNode ( "REG" ).read();
+  std::future<void> lFuture = hw.dispatchAsync();
+
+  // If the replies are still outstanding, a plain dispatch also waits for them; the timeout must reach both the
+  // dispatch and the future, rather than being consumed by whichever of them sees it first
+  if ( lFuture.wait_for ( std::chrono::seconds ( 0 ) ) != std::future_status::ready )
+  {
+    hw.getNode ( "REG" ).read();
+    BOOST_CHECK_THROW ( hw.dispatch() , uhal::exception::ClientTimeout );
+  }
+  BOOST_CHECK_THROW ( lFuture.get() , uhal::exception::ClientTimeout );
+
+  const std::chrono::milliseconds sleepDuration = std::chrono::milliseconds(timeout) + std::chrono::seconds(1);
+  BOOST_TEST_MESSAGE("Sleeping for " << sleepDuration.count() << "ms to allow DummyHardware to clear itself");
+  std::this_thread::sleep_for(sleepDuration);
+  // Check we can continue as normal without further exceptions.
+  uint32_t x = static_cast<uint32_t> ( rand() );
+  hw.getNode ( "REG" ).write ( x );
+  ValWord<uint32_t> y = hw.getNode ( "REG" ).read();
+  BOOST_CHECK_NO_THROW ( hw.dispatch() );
+  BOOST_CHECK ( x == y );
+}
+)
+
+
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(TimeoutTestSuite, check_answered_async_dispatch_not_delayed_by_later_timeout, DummyHardwareFixture,
+{
+  HwInterface hw = getHwInterface();
+
+  // Hold up the completion thread, so that the first batch has been answered, but its future not yet completed, by the time the second batch is sent
+  std::promise<void> lRelease;
+  std::shared_future<void> lReleased ( lRelease.get_future() );
+  IOServicePool::getInstance().post ( [lReleased] () { lReleased.wait(); } );
+
+  ValWord<uint32_t> lMem1 = hw.getNode ( "REG" ).read();
+  std::future<void> lFuture1 = hw.dispatchAsync();
+
+  while ( ! lMem1.valid() )
+  {
+    std::this_thread::sleep_for ( std::chrono::milliseconds ( 1 ) );
+  }
+
+  hwRunner.setReplyDelay( std::chrono::milliseconds(timeout) + std::chrono::seconds(1) );
+  hw.getNode ( "REG" ).read();
+  std::future<void> lFuture2 = hw.dispatchAsync();
+  lRelease.set_value();
+
+  // The first batch completes straight away, rather than once the second one has timed out
+  BOOST_REQUIRE ( lFuture1.wait_for ( std::chrono::milliseconds ( timeout / 2 ) ) == std::future_status::ready );
+  BOOST_CHECK_NO_THROW ( lFuture1.get() );
+  BOOST_CHECK_THROW ( lFuture2.get() , uhal::exception::ClientTimeout );
+
+  const std::chrono::milliseconds sleepDuration = std::chrono::milliseconds(timeout) + std::chrono::seconds(1);
+  BOOST_TEST_MESSAGE("Sleeping for " << sleepDuration.count() << "ms to allow DummyHardware to clear itself");
+  std::this_thread::sleep_for(sleepDuration);
+}
+)
+
+
+BOOST_AUTO_TEST_SUITE(ipbusudp_2_0)
+BOOST_AUTO_TEST_SUITE(PacketLossRecoveryTestSuite)
+
+BOOST_FIXTURE_TEST_CASE( lost_reply , DummyHardwareFixture<IPBUS_2_0_UDP> )
+{
+  // Same device as dummy.udp2, but with lost packets recovered using status and resend requests
+  ConnectionManager manager(connectionFileURI);
+  HwInterface hw(manager.getDevice("dummy.udp2.recovery"));
+  hw.setTimeoutPeriod(timeout);
+
+  hwRunner.dropReplies(1);
+  uint32_t x = static_cast<uint32_t> ( rand() );
+  hw.getNode ( "REG" ).write ( x );
+  ValWord<uint32_t> y = hw.getNode ( "REG" ).read();
+  BOOST_CHECK_NO_THROW ( hw.dispatch() );
+  BOOST_CHECK ( y.valid() );
+  BOOST_CHECK_EQUAL ( x , y.value() );
+}
+
+
+BOOST_FIXTURE_TEST_CASE( lost_request , DummyHardwareFixture<IPBUS_2_0_UDP> )
+{
+  ConnectionManager manager(connectionFileURI);
+  HwInterface hw(manager.getDevice("dummy.udp2.recovery"));
+  hw.setTimeoutPeriod(timeout);
+
+  hwRunner.dropRequests(1);
+  uint32_t x = static_cast<uint32_t> ( rand() );
+  hw.getNode ( "REG" ).write ( x );
+  ValWord<uint32_t> y = hw.getNode ( "REG" ).read();
+  BOOST_CHECK_NO_THROW ( hw.dispatch() );
+  BOOST_CHECK ( y.valid() );
+  BOOST_CHECK_EQUAL ( x , y.value() );
+  BOOST_CHECK ( hw.getClient().getMetrics().getRetries() > 0 );
+  BOOST_CHECK_EQUAL ( hw.getClient().getMetrics().getTimeouts() , 0u );
+}
+
+
+BOOST_FIXTURE_TEST_CASE( lost_packets_block_write_read , DummyHardwareFixture<IPBUS_2_0_UDP> )
+{
+  ConnectionManager manager(connectionFileURI);
+  HwInterface hw(manager.getDevice("dummy.udp2.recovery"));
+  hw.setTimeoutPeriod(timeout);
+
+  // Lose packets in both directions while several packets are in flight
+  const size_t N = 1024 * 1024 / 4;
+  std::vector<uint32_t> xx;
+  xx.reserve ( N );
+  for ( size_t i=0; i!= N; ++i )
+  {
+    xx.push_back ( static_cast<uint32_t> ( rand() ) );
+  }
+
+  hwRunner.dropRequests(2);
+  hwRunner.dropReplies(2);
+  hw.getNode ( "LARGE_MEM" ).writeBlock ( xx );
+  ValVector< uint32_t > mem = hw.getNode ( "LARGE_MEM" ).readBlock ( N );
+  BOOST_CHECK_NO_THROW ( hw.dispatch() );
+  BOOST_CHECK ( mem.valid() );
+  BOOST_CHECK_EQUAL ( mem.size(), N );
+  BOOST_CHECK ( std::equal ( mem.begin() , mem.end() , xx.begin() ) );
+
+  // Check that the client stays in step with the device afterwards
+  hwRunner.dropReplies(1);
+  ValVector< uint32_t > mem2 = hw.getNode ( "LARGE_MEM" ).readBlock ( N );
+  BOOST_CHECK_NO_THROW ( hw.dispatch() );
+  BOOST_CHECK ( std::equal ( mem2.begin() , mem2.end() , xx.begin() ) );
+}
+
+
+BOOST_FIXTURE_TEST_CASE( congestion_window_backs_off_on_loss , DummyHardwareFixture<IPBUS_2_0_UDP> )
+{
+  // Same device as dummy.udp2.recovery, but with the number of packets in flight also limited by a congestion window
+  ConnectionManager manager(connectionFileURI);
+  HwInterface hw(manager.getDevice("dummy.udp2.adaptive.recovery"));
+  hw.setTimeoutPeriod(timeout);
+  UDP< IPbus< 2 , 0 > >& lClient = dynamic_cast< UDP< IPbus< 2 , 0 > >& > ( hw.getClient() );
+  BOOST_CHECK_EQUAL ( lClient.getCongestionWindow() , 1u );
+
+  const size_t N = 256 * 1024;
+  std::vector<uint32_t> xx;
+  xx.reserve ( N );
+  for ( size_t i=0; i!= N; ++i )
+  {
+    xx.push_back ( static_cast<uint32_t> ( rand() ) );
+  }
+
+  hw.getNode ( "LARGE_MEM" ).writeBlock ( xx );
+  BOOST_CHECK_NO_THROW ( hw.dispatch() );
+
+  // Without loss, the window opens up to the number of buffers in the target (16 for IPbus 2.0), and stays there even
+  // though the dummy hardware handles one packet at a time, so replies are delayed by the packets queued ahead of them
+  const uint32_t lMaxWindow ( lClient.getCongestionWindow() );
+  BOOST_CHECK_EQUAL ( lMaxWindow , 16u );
+  for ( size_t i = 0; i != 3; i++ )
+  {
+    ValVector< uint32_t > mem = hw.getNode ( "LARGE_MEM" ).readBlock ( N );
+    BOOST_CHECK_NO_THROW ( hw.dispatch() );
+    BOOST_CHECK ( std::equal ( mem.begin() , mem.end() , xx.begin() ) );
+    BOOST_CHECK_EQUAL ( lClient.getCongestionWindow() , lMaxWindow );
+  }
+
+  // A lost reply halves the window ...
+  hwRunner.dropReplies(1);
+  ValWord<uint32_t> y = hw.getNode ( "LARGE_MEM" ).read();
+  BOOST_CHECK_NO_THROW ( hw.dispatch() );
+  BOOST_CHECK_EQUAL ( y.value() , xx.at ( 0 ) );
+  BOOST_CHECK ( hw.getClient().getMetrics().getRetries() > 0 );
+  BOOST_CHECK_EQUAL ( lClient.getCongestionWindow() , lMaxWindow / 2 );
+
+  // ... and it opens up again as further replies arrive
+  ValVector< uint32_t > mem = hw.getNode ( "LARGE_MEM" ).readBlock ( N );
+  BOOST_CHECK_NO_THROW ( hw.dispatch() );
+  BOOST_CHECK ( std::equal ( mem.begin() , mem.end() , xx.begin() ) );
+  BOOST_CHECK_EQUAL ( lClient.getCongestionWindow() , lMaxWindow );
+}
+
+
+BOOST_FIXTURE_TEST_CASE( late_status_reply , DummyHardwareFixture<IPBUS_2_0_UDP> )
+{
+  ConnectionManager manager(connectionFileURI);
+  HwInterface hw(manager.getDevice("dummy.udp2.recovery"));
+  hw.setTimeoutPeriod(timeout);
+
+  // The first packet is the status request used to find the next packet ID; its reply only arrives after the request has been
+  // repeated, and is then followed by the reply to the repeated request
+  hwRunner.setReplyDelay( std::chrono::milliseconds(timeout / 2) );
+  uint32_t x = static_cast<uint32_t> ( rand() );
+  hw.getNode ( "REG" ).write ( x );
+  ValWord<uint32_t> y = hw.getNode ( "REG" ).read();
+  BOOST_CHECK_NO_THROW ( hw.dispatch() );
+  BOOST_CHECK ( y.valid() );
+  BOOST_CHECK_EQUAL ( x , y.value() );
+
+  ValWord<uint32_t> z = hw.getNode ( "REG" ).read();
+  BOOST_CHECK_NO_THROW ( hw.dispatch() );
+  BOOST_CHECK_EQUAL ( x , z.value() );
+  BOOST_CHECK_EQUAL ( hw.getClient().getMetrics().getRetries() , 0u );
+}
+
+
+BOOST_FIXTURE_TEST_CASE( status_request_timeout , DummyHardwareFixture<IPBUS_2_0_UDP> )
+{
+  std::string address_file;
+  {
+    boost::filesystem::path conn_fn ( connectionFileURI );
+    boost::filesystem::path fn ( "dummy_address.xml" );
+    address_file = ( conn_fn.parent_path() /fn ).string();
+  }
+  // Nothing is listening on this port, so the status request used to find the next packet ID is never answered
+  HwInterface hw = ConnectionManager::getDevice ( "unreachable", "ipbusudp-2.0://localhost:60099?packet_loss_recovery=1", address_file );
+  hw.setTimeoutPeriod(timeout);
+
+  // The status request is sent without waiting for its reply, and the timeout is reported through the future
+  hw.getNode ( "REG" ).read();
+  const std::chrono::steady_clock::time_point lStart = std::chrono::steady_clock::now();
+  std::future<void> lFuture = hw.dispatchAsync();
+  BOOST_CHECK ( std::chrono::steady_clock::now() - lStart < std::chrono::milliseconds(timeout / 2) );
+  BOOST_CHECK_THROW ( lFuture.get() , uhal::exception::ClientTimeout );
+  BOOST_CHECK ( std::chrono::steady_clock::now() - lStart >= std::chrono::milliseconds(timeout / 2) );
+
+  hw.getNode ( "REG" ).read();
+  BOOST_CHECK_THROW ( hw.dispatch() , uhal::exception::ClientTimeout );
+}
+
+
+BOOST_FIXTURE_TEST_CASE( lost_reply_without_recovery , DummyHardwareFixture<IPBUS_2_0_UDP> )
+{
+  HwInterface hw = getHwInterface();
+
+  // Without packet-loss recovery, a lost reply results in a timeout
+  hwRunner.dropReplies(1);
+  hw.getNode ( "REG" ).read();
+  BOOST_CHECK_THROW ( hw.dispatch() , uhal::exception::ClientTimeout );
+
+  ValWord<uint32_t> y = hw.getNode ( "REG" ).read();
+  BOOST_CHECK_NO_THROW ( hw.dispatch() );
+  BOOST_CHECK ( y.valid() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(ipbuspcie_2_0)
+BOOST_AUTO_TEST_SUITE(TimeoutTestSuite)
+
+BOOST_FIXTURE_TEST_CASE( check_timeout_spin_then_poll , DummyHardwareFixture<IPBUS_2_0_PCIE> )
+{
+  // Same device as dummy.pcie2, but (respectively) spinning for a minute, and polling without spinning first
+  const std::vector<std::string> lDeviceIds = { "dummy.pcie2.spin" , "dummy.pcie2.nospin" };
+
+  for (const std::string& lDeviceId : lDeviceIds) {
+    BOOST_TEST_MESSAGE("  Device = " << lDeviceId);
+    hwRunner.setReplyDelay( std::chrono::milliseconds(timeout) + std::chrono::seconds(1) );
+    ConnectionManager manager(connectionFileURI);
+    HwInterface hw(manager.getDevice(lDeviceId));
+    hw.setTimeoutPeriod(timeout);
+
+    // The timeout is checked while spinning, as well as between polls, so it is not postponed until the end of the spin period
+    const std::chrono::steady_clock::time_point lStart = std::chrono::steady_clock::now();
+    BOOST_CHECK_THROW ( { hw.getNode ( "REG" ).read();  hw.dispatch(); } , uhal::exception::ClientTimeout );
+    const std::chrono::steady_clock::duration lElapsed = std::chrono::steady_clock::now() - lStart;
+    BOOST_CHECK ( lElapsed >= std::chrono::milliseconds(timeout) );
+    BOOST_CHECK ( lElapsed < std::chrono::milliseconds(timeout) + std::chrono::seconds(1) );
+
+    const std::chrono::milliseconds sleepDuration = std::chrono::milliseconds(timeout) + std::chrono::seconds(1);
+    BOOST_TEST_MESSAGE("Sleeping for " << sleepDuration.count() << "ms to allow DummyHardware to clear itself");
+    std::this_thread::sleep_for(sleepDuration);
+    // Check we can continue as normal without further exceptions.
+    uint32_t x = static_cast<uint32_t> ( rand() );
+    ValWord<uint32_t> y;
+    BOOST_CHECK_NO_THROW (
+      hw.getNode ( "REG" ).write ( x );
+      y = hw.getNode ( "REG" ).read();
+      hw.dispatch();
+    );
+    BOOST_CHECK ( x == y );
+  }
+}
+
+
+BOOST_FIXTURE_TEST_CASE( check_timeout_completion_thread , DummyHardwareFixture<IPBUS_2_0_PCIE> )
+{
+  hwRunner.setReplyDelay( std::chrono::milliseconds(timeout) + std::chrono::seconds(1) );
+  // Same device as dummy.pcie2, but with replies read by a dedicated completion thread
+  ConnectionManager manager(connectionFileURI);
+  HwInterface hw(manager.getDevice("dummy.pcie2.pipelined"));
+  hw.setTimeoutPeriod(timeout);
+
+  // The timeout occurs in the completion thread, but the exception is thrown from dispatch
+  BOOST_CHECK_THROW ( { hw.getNode ( "REG" ).read();  hw.dispatch(); } , uhal::exception::ClientTimeout );
+
+  const std::chrono::milliseconds sleepDuration = std::chrono::milliseconds(timeout) + std::chrono::seconds(1);
+  BOOST_TEST_MESSAGE("Sleeping for " << sleepDuration.count() << "ms to allow DummyHardware to clear itself");
+  std::this_thread::sleep_for(sleepDuration);
+  // Check we can continue as normal without further exceptions.
+  uint32_t x = static_cast<uint32_t> ( rand() );
+  ValWord<uint32_t> y;
+  BOOST_CHECK_NO_THROW (
+    hw.getNode ( "REG" ).write ( x );
+    y = hw.getNode ( "REG" ).read();
+    hw.dispatch();
+  );
+  BOOST_CHECK ( x == y );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+
 } // end ns tests
 } // end ns uhal
@@ -64,6 +64,21 @@ void DummyHardwareRunner::setReplyDelay(const std::chrono::microseconds& aDelay)
   mHw->setReplyDelay(aDelay);
 }
 
+void DummyHardwareRunner::dropRequests(uint32_t aCount)
+{
+  mHw->dropRequests(aCount);
+}
+
+void DummyHardwareRunner::dropReplies(uint32_t aCount)
+{
+  mHw->dropReplies(aCount);
+}
+
+void DummyHardwareRunner::truncateNextReply(uint32_t aNrWords)
+{
+  mHw->truncateNextReply(aNrWords);
+}
+
 
 double measureReadLatency(ClientInterface& aClient, uint32_t aBaseAddr, uint32_t aDepth, size_t aNrIterations, bool aDispatchEachIteration, bool aVerbose)
 {
@@ -40,7 +40,9 @@
 #define _uhal_Buffers_hpp_
 
 
+#include <chrono>
 #include <deque>
+#include <memory>           // for shared_ptr
 #include <stdint.h>         // for uint32_t, uint8_t
 #include <utility>          // for pair
 #include <vector>           // for vector
@@ -102,6 +104,15 @@ namespace uhal
       */
       uint8_t* send ( const uint8_t* aPtr , const uint32_t& aSize );
 
+      /**
+        Helper function to add a block of memory to the send stream without copying it into the send buffer
+        The corresponding bytes of the send buffer are reserved, but only filled if a contiguous copy of the packet is requested via getSendBuffer
+        @param aPtr a pointer to the start of the memory, which must remain valid until the buffer has been sent (e.g. by passing its owner to the add method)
+        @param aSize the number of bytes
+        @note Small blocks, and blocks beyond the first few in each buffer, are copied as usual since the length of gather lists is limited
+      */
+      void sendByReference ( const uint8_t* aPtr , const uint32_t& aSize );
+
       /**
       	Helper function to add a destination object to the reply queue
       	@param aPtr a pointer to some persistent object which can be written to when the transaction is performed
@@ -142,11 +153,29 @@ namespace uhal
       void add ( const ValVector< uint32_t >& aValMem );
 
       /**
-      	Get a pointer to the start of the send buffer
+        Helper function to associate the source of a block sent by reference with this buffer so that it is guaranteed to exist when the transaction is performed
+        @param aSource the memory containing the block(s) sent by reference
+      */
+      void add ( const std::shared_ptr< const std::vector< uint32_t > >& aSource );
+
+      /**
+      	Get a pointer to the start of the send buffer, first copying any blocks sent by reference into it so that it contains the full packet
       	@return a pointer to the start of the send buffer
       */
       uint8_t* getSendBuffer();
 
+      /**
+        Get a pointer to the start of the send buffer, without copying in any blocks sent by reference
+        @return a pointer to the start of the send buffer; the transaction headers can be parsed from this, but the payload of blocks sent by reference is not filled in
+      */
+      uint8_t* getSendBufferHeaders();
+
+      /**
+        Get the list of memory blocks which together make up the packet, for use in vectored (scatter-gather) I/O
+        @return the memory blocks, as (pointer, size in bytes) pairs
+      */
+      const std::vector< std::pair< const uint8_t* , size_t > >& getSendSegments();
+
       /**
       	Get a reference to the reply queue
       	@return a reference to the reply queue
@@ -159,14 +188,42 @@ namespace uhal
       //! Clear the counters and the reply buffers
       void clear();
 
+      //! Record the time at which the buffer is handed to the transport layer
+      void setDispatchTime();
+
+      /**
+        Get the time at which the buffer was handed to the transport layer
+        @return the time at which the buffer was handed to the transport layer
+      */
+      const std::chrono::steady_clock::time_point& getDispatchTime() const;
+
     private:
       //! The number of bytes that are currently in the send buffer
       uint32_t mSendCounter;
       //! The number of bytes that are currently expected by the reply buffer
       uint32_t mReplyCounter;
 
+      //! A block of memory that is sent from its original location, rather than being copied into the send buffer
+      struct SendReference
+      {
+        //! The offset of the block within the send stream
+        uint32_t offset;
+        //! The start of the block
+        const uint8_t* ptr;
+        //! The number of bytes in the block
+        uint32_t size;
+      };
+
       //! The start location of the memory buffer
       std::vector<uint8_t> mSendBuffer;
+      //! The blocks sent by reference, in order of their position in the send stream
+      std::vector< SendReference > mSendReferences;
+      //! Whether the blocks sent by reference have been copied into the send buffer
+      bool mSendReferencesCopied;
+      //! The gather list returned by getSendSegments
+      std::vector< std::pair< const uint8_t* , size_t > > mSendSegments;
+      //! The sources of the blocks sent by reference, so that they are guaranteed to exist when the transaction is performed
+      std::deque< std::shared_ptr< const std::vector< uint32_t > > > mSendSources;
       //! The queue of reply destinations
       std::deque< std::pair< uint8_t* , uint32_t > > mReplyBuffer;
 
@@ -176,6 +233,9 @@ namespace uhal
       std::deque< ValWord< uint32_t > > mUnsignedValWords;
       //! Deque holding validated memories so that they are guaranteed to exist when the transaction is performed
       std::deque< ValVector< uint32_t > > mUnsignedValVectors;
+
+      //! The time at which the buffer was handed to the transport layer
+      std::chrono::steady_clock::time_point mDispatchTime;
   };
 
 }
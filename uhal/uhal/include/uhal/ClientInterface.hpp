@@ -41,7 +41,12 @@
 #define _uhal_ClientInterface_hpp_
 
 
+#include <atomic>
+#include <chrono>
 #include <deque>
+#include <exception>
+#include <future>
+#include <iosfwd>
 #include <memory>
 #include <mutex>
 #include <stdint.h>
@@ -53,8 +58,10 @@
 
 #include "uhal/grammars/URI.hpp"
 #include "uhal/log/exception.hpp"
+#include "uhal/ClientMetrics.hpp"
 #include "uhal/definitions.hpp"
 #include "uhal/ValMem.hpp"
+#include "uhal/ValMemPool.hpp"
 
 
 namespace uhal
@@ -94,6 +101,9 @@ namespace uhal
     UHAL_DEFINE_EXCEPTION_CLASS ( TransportLayerError, "Base exception class covering non-timeout transport-layer-specific errors.")
 
     UHAL_DEFINE_EXCEPTION_CLASS ( InvalidURI, "Exception class for invalid URIs." )
+
+    //! Exception class to handle the case where a client does not support reading a block into user-provided memory.
+    UHAL_DEFINE_EXCEPTION_CLASS ( ReadBlockIntoBufferNotSupported, "Exception class to handle the case where a client does not support reading a block into user-provided memory." )
   }
 
   //! An abstract base class for defining the interface to the various IPbus clients as well as providing the generalized packing functionality
@@ -149,6 +159,32 @@ namespace uhal
       //! Method to dispatch all queued transactions, and wait until all corresponding responses have been received
       void dispatch ();
 
+      /**
+        Method to dispatch all queued transactions without waiting for the corresponding responses
+        The future is completed by the process-wide completion thread of the IOServicePool, once the transport has received all
+        responses; for transports which receive the responses in the calling thread, it is completed before this method returns.
+        If the transactions are also covered by a later call to dispatch (i.e. dispatch is called before the future is ready), then
+        any exception raised by that dispatch is delivered through the future as well.
+        @return a future which becomes ready once all responses have been received, and which holds any exception raised during
+          the dispatch; if the client is destroyed first, the future holds a std::future_error (broken promise)
+      */
+      std::future<void> dispatchAsync ();
+
+      /**
+        Return the counters and histograms describing the traffic through this client
+        @return the metrics of this client
+      */
+      const ClientMetrics& getMetrics() const;
+
+      //! Reset the counters and histograms describing the traffic through this client
+      void resetMetrics();
+
+      /**
+        Write the metrics of this client in the Prometheus text exposition format, labelled with the client's ID and URI
+        @param aStream the stream to write to
+      */
+      void streamMetrics ( std::ostream& aStream ) const;
+
       /**
       	A method to modify the timeout period for any pending or future transactions
         @warning Protected by user mutex, so only for use from user side (not from client code)
@@ -196,6 +232,14 @@ namespace uhal
       */
       ValHeader writeBlock ( const uint32_t& aAddr, const std::vector< uint32_t >& aValues, const defs::BlockReadWriteMode& aMode=defs::INCREMENTAL );
 
+      /**
+        Write a block of data to a block of registers or a block-write port, without copying the data into the send buffers (if the protocol supports it)
+        @param aAddr the address of the register to write
+        @param aValues the values to write to the registers or a block-write port; these are moved into the client, which keeps them until the data has been sent
+        @param aMode whether we are writing to a block of registers (INCREMENTAL) or a block-write port (NON_INCREMENTAL)
+      */
+      ValHeader writeBlock ( const uint32_t& aAddr, std::vector< uint32_t >&& aValues, const defs::BlockReadWriteMode& aMode=defs::INCREMENTAL );
+
       /**
       	Read a single, unmasked, unsigned word
       	@param aAddr the address of the register to read
@@ -220,6 +264,16 @@ namespace uhal
       */
       ValVector< uint32_t > readBlock ( const uint32_t& aAddr, const uint32_t& aSize, const defs::BlockReadWriteMode& aMode=defs::INCREMENTAL );
 
+      /**
+        Read a block of unsigned data from a block of registers or a block-read port directly into user-provided memory
+        @param aAddr the lowest address in the block of registers or the address of the block-read port
+        @param aBuffer the memory into which the data will be written; must remain valid until the transaction has been dispatched
+        @param aSize the number of words to read (the buffer must be at least this size)
+        @param aMode whether we are reading from a block of registers (INCREMENTAL) or a block-read port (NON_INCREMENTAL)
+        @return a Validated Header, which is marked as valid once the data has been written into the buffer
+      */
+      ValHeader readBlock ( const uint32_t& aAddr, uint32_t* aBuffer, const uint32_t& aSize, const defs::BlockReadWriteMode& aMode=defs::INCREMENTAL );
+
       /**
       	Read the value of a register, apply the AND-term, apply the OR-term, set the register to this new value and return a copy of the original value to the user
       	@param aAddr the address of the register to read, modify, write
@@ -247,6 +301,32 @@ namespace uhal
       //! Virtual function to dispatch all buffers and block until all replies are received
       virtual void Flush( );
 
+      /**
+        Virtual function to send any buffers that the transport is holding back, without waiting for the replies
+        The default implementation does nothing, and is for transports which receive the replies in the thread calling Flush
+        @return true if the replies are received by the transport's own thread, which then calls repliesReceived; false if they are only received by Flush
+      */
+      virtual bool beginFlush( );
+
+      /**
+        Virtual function reporting, without waiting for any replies, whether the transport's own thread has hit an error which Flush would rethrow
+        The default implementation returns false, and is for transports which receive the replies in the thread calling Flush
+      */
+      virtual bool asynchronousExceptionPending( );
+
+      /**
+        Function which the transport calls from its own thread once the replies to all packets in flight have been received, or once an
+        error has occurred; completes the futures returned by dispatchAsync, from the completion thread of the IOServicePool
+      */
+      void repliesReceived( );
+
+      /**
+        Stop the completion thread from using this client, waiting for any completion task which is already doing so
+        Transports which call repliesReceived must call this at the start of their destructor, before tearing down anything that
+        Flush relies on; the futures of any batches still waiting for their replies then fail with a broken promise
+      */
+      void detachAsyncDispatches( );
+
 
       //! Send a byte order transaction
       virtual ValHeader implementBOT( ) = 0;
@@ -266,6 +346,15 @@ namespace uhal
       */
       virtual ValHeader implementWriteBlock ( const uint32_t& aAddr, const std::vector< uint32_t >& aValues, const defs::BlockReadWriteMode& aMode=defs::INCREMENTAL ) = 0;
 
+      /**
+      Write a block of data to a block of registers or a block-write port, referencing the data from the send buffers rather than copying it
+      The default implementation simply calls implementWriteBlock
+      @param aAddr the address of the register to write
+      @param aValues the values to write to the registers or a block-write port
+      @param aMode whether we are writing to a block of registers (INCREMENTAL) or a block-write port (NON_INCREMENTAL)
+      */
+      virtual ValHeader implementWriteBlockByReference ( const uint32_t& aAddr, const std::shared_ptr< const std::vector< uint32_t > >& aValues, const defs::BlockReadWriteMode& aMode=defs::INCREMENTAL );
+
       /**
       Read a single, masked, unsigned word
       @param aAddr the address of the register to read
@@ -283,6 +372,17 @@ namespace uhal
       */
       virtual ValVector< uint32_t > implementReadBlock ( const uint32_t& aAddr, const uint32_t& aSize, const defs::BlockReadWriteMode& aMode=defs::INCREMENTAL ) = 0;
 
+      /**
+      Read a block of unsigned data from a block of registers or a block-read port directly into user-provided memory
+      The default implementation throws, since this must be supported by the packing protocol
+      @param aAddr the lowest address in the block of registers or the address of the block-read port
+      @param aBuffer the memory into which the data will be written
+      @param aSize the number of words to read
+      @param aMode whether we are reading from a block of registers (INCREMENTAL) or a block-read port (NON_INCREMENTAL)
+      @return a Validated Header, which is marked as valid once the data has been written into the buffer
+      */
+      virtual ValHeader implementReadBlockIntoBuffer ( const uint32_t& aAddr, uint32_t* aBuffer, const uint32_t& aSize, const defs::BlockReadWriteMode& aMode=defs::INCREMENTAL );
+
 
       /**
       Read the value of a register, apply the AND-term, apply the OR-term, set the register to this new value and return a copy of the new value to the user
@@ -359,6 +459,12 @@ namespace uhal
       //! Function which is called when an exception is thrown
       virtual void dispatchExceptionHandler();
 
+      /**
+        Return the metrics of this client, so that the transport layer can record protocol-specific events such as retries
+        @return the metrics of this client
+      */
+      ClientMetrics& metrics();
+
       /**
         Function to return a buffer to the buffer pool
         @param aBuffers a shared-pointer to a buffer to be returned to the buffer pool
@@ -388,6 +494,37 @@ namespace uhal
       void updateCurrentBuffers();
       void deleteBuffers();
 
+      /**
+        Pass all queued buffers to the transport layer; the user-side mutex must be held by the caller
+        @return whether any buffers were dispatched
+      */
+      bool sendQueuedBuffers();
+
+      /**
+        Finalize a buffer and pass it to the transport layer
+        @param aBuffers the buffer, for which responsibility is passed to the transport layer
+      */
+      void transmit ( std::shared_ptr< Buffers >& aBuffers );
+
+      //! Record the exception currently being handled as the reason for a failed dispatch; must only be called from a catch block
+      void recordDispatchException();
+
+      //! Wait for the replies to the batches sent by dispatchAsync, and complete their futures; the user-side mutex must be held by the caller
+      void completeAsyncDispatches();
+
+      /**
+        Complete the futures of the batches sent by dispatchAsync whose packets have all been answered, or fail them all if the transport
+        has hit an error; never waits for replies still in flight, since it runs in the completion thread shared by all clients. The
+        user-side mutex must be held by the caller
+      */
+      void completeAnsweredAsyncDispatches();
+
+      /**
+        Complete the futures of all batches sent by dispatchAsync which are still waiting for their replies
+        @param aException the exception with which the batches failed; null if all replies were received successfully
+      */
+      void deliverAsyncDispatches ( const std::exception_ptr& aException );
+
 
     private:
       //! A MutEx lock used to make sure the access functions are thread safe
@@ -426,6 +563,59 @@ namespace uhal
 
       std::string mUriString;
 
+    private:
+      //! Pool from which the memory underlying the ValHeader, ValWord and ValVector objects returned by this client is allocated
+      std::shared_ptr< ValMemPool > mValMemPool;
+
+      //! Counters and histograms describing the traffic through this client
+      ClientMetrics mMetrics;
+
+      //! A batch of transactions sent by dispatchAsync, which is waiting for its replies
+      struct AsyncDispatch
+      {
+        //! The promise behind the future returned by dispatchAsync
+        std::promise<void> mPromise;
+        //! The time at which the batch was dispatched
+        std::chrono::steady_clock::time_point mStart;
+        //! The number of packets transmitted by the client once the batch had been sent, i.e. the sequence number of its last packet
+        uint64_t mLastPacket;
+      };
+
+      //! The client as seen by the completion tasks, which may run after the client has been destroyed
+      struct AsyncDispatchOwner
+      {
+        //! Held by a completion task while it uses the client, and by the destructor when detaching the client
+        std::mutex mMutex;
+        //! The client; NULL once it is being destroyed
+        ClientInterface* mClient;
+      };
+
+      //! The batches sent by dispatchAsync which are waiting for their replies, oldest first; only modified with the user-side mutex held
+      std::deque< AsyncDispatch > mAsyncDispatches;
+
+      //! The number of packets handed to the transport layer; only modified with the user-side mutex held
+      uint64_t mPacketsTransmitted;
+
+      //! The number of packets whose replies have been validated, which the transport's thread increments
+      std::atomic< uint64_t > mPacketsValidated;
+
+      //! Whether a task to complete the batches has been posted to the completion thread, and has not started yet
+      bool mAsyncCompletionPosted;
+
+      //! A MutEx lock protecting the list of batches waiting for their replies, which the transport's thread may inspect
+      std::mutex mAsyncDispatchMutex;
+
+      //! Handle shared with the completion tasks posted by this client
+      std::shared_ptr< AsyncDispatchOwner > mAsyncDispatchOwner;
+
+      /**
+        Task run in the completion thread, which completes the futures of the client's batches, unless the client has been detached
+        @param aOwner handle to the client
+      */
+      static void completeAsyncDispatches ( const std::shared_ptr< AsyncDispatchOwner >& aOwner );
+
+    protected:
+
       /**
         Function which checks the available space in the currently filling buffer against requested send and receive sizes and, if there is insufficient space in the currently filling buffer, then dispatch it and create a new buffer
         @param aSendSize the amount of data that the current instruction wishes to send
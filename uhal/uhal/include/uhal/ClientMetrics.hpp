@@ -0,0 +1,207 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+---------------------------------------------------------------------------
+*/
+
+
+/**
+	@file
+*/
+
+#ifndef _uhal_ClientMetrics_hpp_
+#define _uhal_ClientMetrics_hpp_
+
+
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+#include <stdint.h>
+#include <string>
+
+
+namespace uhal
+{
+
+  /**
+    A histogram of unsigned integer values, which can be filled concurrently from several threads without locking
+    As in HdrHistogram, each power of two is split into a fixed number of linear sub-buckets, so the relative precision is the same at all scales
+  */
+  class Histogram
+  {
+    public:
+      //! The number of bits used for the sub-buckets in each power of two, so values are recorded with a relative precision of 1 in 2^kSubBucketBits
+      static const uint32_t kSubBucketBits = 3;
+      //! The total number of buckets needed to cover all 64-bit values
+      static const uint32_t kNrBuckets = ( 64 - kSubBucketBits + 1 ) << kSubBucketBits;
+
+      //! Constructor
+      Histogram();
+
+      /**
+        Add a value to the histogram
+        @param aValue the value
+      */
+      void record ( const uint64_t aValue );
+
+      //! Remove all values from the histogram
+      void reset();
+
+      /**
+        Return the number of values that have been recorded
+        @return the number of values
+      */
+      uint64_t count() const;
+
+      /**
+        Return the sum of the values that have been recorded
+        @return the sum of the values
+      */
+      uint64_t sum() const;
+
+      /**
+        Return the largest value that has been recorded
+        @return the largest value, or 0 if none have been recorded
+      */
+      uint64_t max() const;
+
+      /**
+        Return an upper bound for the given quantile of the recorded values, accurate to the width of a bucket
+        @param aQuantile the quantile, between 0 and 1 (e.g. 0.99 for the 99th percentile)
+        @return the quantile, or 0 if no values have been recorded
+      */
+      uint64_t quantile ( const double aQuantile ) const;
+
+    private:
+      //! Return the index of the bucket containing a value
+      static uint32_t bucket ( const uint64_t aValue );
+
+      //! Return the largest value contained in a bucket
+      static uint64_t bucketUpperBound ( const uint32_t aBucket );
+
+      //! The number of values recorded in each bucket
+      std::atomic< uint64_t > mBuckets[kNrBuckets];
+      //! The number of values recorded
+      std::atomic< uint64_t > mCount;
+      //! The sum of the values recorded
+      std::atomic< uint64_t > mSum;
+      //! The largest value recorded
+      std::atomic< uint64_t > mMax;
+  };
+
+
+  /**
+    Counters and histograms describing the traffic through a client, updated as packets are dispatched and replies are received
+    All methods are thread safe; the counters are updated with relaxed atomic operations, so different counters may be momentarily out of step
+  */
+  class ClientMetrics
+  {
+    public:
+      //! Constructor
+      ClientMetrics();
+
+      //! Record that a packet has been handed to the transport layer
+      void packetSent ( const uint32_t aBytes );
+
+      //! Record that a reply has been received and validated
+      void packetReceived ( const uint32_t aBytes , const std::chrono::steady_clock::duration& aLatency );
+
+      //! Record that a dispatch has completed
+      void dispatchCompleted ( const std::chrono::steady_clock::duration& aLatency );
+
+      //! Record that a dispatch failed due to a timeout
+      void timeout();
+
+      //! Record that a dispatch failed for a reason other than a timeout
+      void error();
+
+      //! Record that a packet or its reply had to be resent
+      void retry();
+
+      //! Record that the packets in flight have been discarded, e.g. after an error
+      void packetsDiscarded();
+
+      //! Reset all counters and histograms, other than the number of packets in flight
+      void reset();
+
+      //! Return the number of packets handed to the transport layer
+      uint64_t getPacketsSent() const;
+
+      //! Return the number of replies received and validated
+      uint64_t getPacketsReceived() const;
+
+      //! Return the number of bytes handed to the transport layer
+      uint64_t getBytesSent() const;
+
+      //! Return the number of reply bytes received and validated
+      uint64_t getBytesReceived() const;
+
+      //! Return the number of packets which have been handed to the transport layer, but whose reply has not yet been received
+      uint64_t getPacketsInFlight() const;
+
+      //! Return the number of dispatches which have completed
+      uint64_t getDispatches() const;
+
+      //! Return the number of dispatches which failed due to a timeout
+      uint64_t getTimeouts() const;
+
+      //! Return the number of dispatches which failed for any other reason
+      uint64_t getErrors() const;
+
+      //! Return the number of packets or replies which had to be resent
+      uint64_t getRetries() const;
+
+      //! Return the histogram of dispatch latency in microseconds, from the dispatch call until all replies have been received
+      const Histogram& getDispatchLatency() const;
+
+      //! Return the histogram of packet latency in microseconds, from the packet being handed to the transport layer until its reply has been validated
+      const Histogram& getPacketLatency() const;
+
+      //! Return the histogram of the number of packets already in flight when each packet is handed to the transport layer
+      const Histogram& getQueueDepth() const;
+
+      /**
+        Write the metrics in the Prometheus text exposition format
+        @param aStream the stream to write to
+        @param aLabels the labels to attach to each metric, in the form 'name="value",...'
+      */
+      void stream ( std::ostream& aStream , const std::string& aLabels ) const;
+
+    private:
+      std::atomic< uint64_t > mPacketsSent;
+      std::atomic< uint64_t > mPacketsReceived;
+      std::atomic< uint64_t > mBytesSent;
+      std::atomic< uint64_t > mBytesReceived;
+      std::atomic< uint64_t > mPacketsInFlight;
+      std::atomic< uint64_t > mDispatches;
+      std::atomic< uint64_t > mTimeouts;
+      std::atomic< uint64_t > mErrors;
+      std::atomic< uint64_t > mRetries;
+
+      Histogram mDispatchLatency;
+      Histogram mPacketLatency;
+      Histogram mQueueDepth;
+  };
+
+}
+
+#endif
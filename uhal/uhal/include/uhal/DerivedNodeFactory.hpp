@@ -94,6 +94,21 @@ namespace uhal
 
       Node* convertToClassType( Node* aNode );
 
+      /**
+        Convert a node to the derived node type registered under the specified name
+        @param aNode the node to be converted; deleted if a derived node is created
+        @param aNodeClassName the node type identifier
+        @return the derived node, or the original node if the type identifier is unknown
+      */
+      Node* convertToClassType( Node* aNode , const std::string& aNodeClassName );
+
+      /**
+        Returns the identifier under which the type of the specified node was registered
+        @param aNode a node
+        @return the node type identifier, or an empty string if the node is not of a registered derived type
+      */
+      std::string getClassName ( const Node& aNode ) const;
+
       /**
         Method to create an associate between a node type identifier and a Creator of that particular node type
         @param aNodeClassName the node type identifier
@@ -122,6 +137,17 @@ namespace uhal
           @return a new node tree
           */
           virtual Node* create ( const Node& aNode ) = 0;
+
+          /**
+          Interface to a function which checks whether a node is of the type created by this creator
+          The default implementation returns false, so address tables containing such nodes are not cached
+          @param aNode a node
+          @return whether the node is of the type created by this creator
+          */
+          virtual bool isTypeOf ( const Node& aNode ) const
+          {
+            return false;
+          }
       };
 
 
@@ -147,6 +173,13 @@ namespace uhal
           @return a new node tree
           */
           Node* create ( const Node& aNode );
+
+          /**
+          Concrete function which checks whether a node is of type T (and not a further derived type)
+          @param aNode a node
+          @return whether the node is of type T
+          */
+          bool isTypeOf ( const Node& aNode ) const;
       };
 
 
@@ -0,0 +1,93 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+---------------------------------------------------------------------------
+*/
+
+
+/**
+	@file
+*/
+
+#ifndef _uhal_DispatchGroup_hpp_
+#define _uhal_DispatchGroup_hpp_
+
+
+#include <exception>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "uhal/HwInterface.hpp"
+
+
+namespace uhal
+{
+
+  /**
+    A group of devices whose queued transactions are dispatched together
+    All devices' transactions are sent before waiting for any replies, so the time taken to dispatch the group is roughly
+    that of the slowest device rather than the sum over all devices. A failure on one device does not prevent the
+    transactions of the other devices from completing; instead, the errors are returned to the caller per device.
+  */
+  class DispatchGroup
+  {
+    public:
+      //! Constructor for an empty group
+      DispatchGroup();
+
+      /**
+        Constructor
+        @param aDevices the devices to add to the group
+      */
+      DispatchGroup ( const std::vector< HwInterface* >& aDevices );
+
+      //! Destructor
+      ~DispatchGroup();
+
+      /**
+        Add a device to the group
+        @param aDevice the device to add; the group shares ownership of its client, so the HwInterface itself may be destroyed first.
+          Devices are identified by their position in the group, in the order in which they were added, since IDs need not be unique
+      */
+      void add ( HwInterface& aDevice );
+
+      /**
+        Return the number of devices in the group
+        @return the number of devices in the group
+      */
+      std::size_t size() const;
+
+      /**
+        Dispatch the queued transactions of all devices in the group, and wait until all replies have been received
+        @return the exceptions thrown by the devices whose dispatch failed, indexed by the devices' positions in the group; empty if all succeeded
+      */
+      std::map< std::size_t , std::exception_ptr > dispatch();
+
+    private:
+      //! The clients of the devices in the group
+      std::vector< std::shared_ptr< ClientInterface > > mClients;
+  };
+
+}
+
+#endif
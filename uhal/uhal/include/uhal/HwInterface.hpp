@@ -40,6 +40,7 @@
 #define _uhal_HwInterface_hpp_
 
 
+#include <future>
 #include <memory>
 #include <stdint.h>
 #include <string>
@@ -64,8 +65,7 @@ namespace uhal
 
       /**
       	Copy Constructor
-        Calls the copy constructor on the ClientInterface
-        Calls the clone method on the Node Tree
+        Shares the ClientInterface and the Node Tree with the original
         @param hwInterface a Hardware Interface instance to copy
       */
       HwInterface ( const HwInterface& );
@@ -95,6 +95,12 @@ namespace uhal
       //! Make the IPbus client issue a dispatch
       void dispatch ();
 
+      /**
+        Make the IPbus client issue a dispatch, without waiting for the responses
+        @return a future which becomes ready once all responses have been received; see ClientInterface::dispatchAsync
+      */
+      std::future<void> dispatchAsync ();
+
       /**
       	A method to modify the timeout period for any pending or future transactions
       	@param aTimeoutPeriod the desired timeout period in milliseconds
@@ -147,8 +153,11 @@ namespace uhal
       std::vector<std::string> getNodes ( const std::string& aRegex ) const;
 
     private:
+      //! Make DispatchGroup a friend so that it can share ownership of the client
+      friend class DispatchGroup;
+
       /**
-      	A function which sets the HwInterface pointer in the Node to point to this HwInterface
+      	A function which binds a Node and its descendants to the client of this HwInterface
       	@param aNode a Node that is to be claimed
       */
       void claimNode ( Node& aNode );
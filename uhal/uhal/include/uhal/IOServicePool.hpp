@@ -0,0 +1,198 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+---------------------------------------------------------------------------
+*/
+
+/**
+	@file
+*/
+
+#ifndef _uhal_IOServicePool_hpp_
+#define _uhal_IOServicePool_hpp_
+
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/system/error_code.hpp>
+
+
+namespace uhal
+{
+
+  /**
+    Wrapper around a handler for one of a client's asynchronous operations, which does nothing once the client has been closed
+    @tparam Handler the type of the wrapped handler
+  */
+  template < typename Handler >
+  class GuardedHandler
+  {
+    public:
+      /**
+        Constructor
+        @param aAlive token held by the client until its sockets and timers are closed
+        @param aHandler the handler
+      */
+      GuardedHandler ( const std::weak_ptr< void >& aAlive , const Handler& aHandler );
+
+      //! Run the handler of a timer, unless the client has been closed
+      void operator() ( const boost::system::error_code& aErrorCode );
+
+      //! Run the handler of a socket operation, unless the client has been closed
+      void operator() ( const boost::system::error_code& aErrorCode , std::size_t aBytesTransferred );
+
+    private:
+      //! Token held by the client until its sockets and timers are closed
+      std::weak_ptr< void > mAlive;
+
+      //! The handler
+      Handler mHandler;
+  };
+
+
+  /**
+    Process-wide pool of boost::asio::io_service threads, used by the UDP and TCP clients to run their asynchronous operations.
+    If the number of threads is 0 (the default), each client is given its own io_service and thread, as before; otherwise,
+    clients share a fixed number of threads, each client being assigned to the thread that is serving the fewest clients.
+    All of a client's handlers run in the same thread, so no additional synchronisation is needed within the clients.
+    The initial number of threads is taken from the UHAL_IO_THREADS environment variable, if set.
+  */
+  class IOServicePool
+  {
+    private:
+      //! An io_service together with the thread that runs it
+      struct Worker
+      {
+        Worker();
+
+        //! Stops the io_service and joins the thread; if called from within the thread itself, the thread is detached instead
+        ~Worker();
+
+        //! The io_service that the client's sockets and timers are bound to; shared with the thread, which may outlive the worker
+        std::shared_ptr< boost::asio::io_service > mIOservice;
+        //! Stops the io_service from returning when it runs out of work
+        boost::asio::io_service::work mIOserviceWork;
+        //! The thread that runs the io_service
+        std::thread mThread;
+      };
+
+      /**
+        Default constructor
+        This is private since only a single instance is to be created, using the getInstance method
+      */
+      IOServicePool();
+
+    public:
+      IOServicePool(const IOServicePool&) = delete;
+      IOServicePool& operator=(const IOServicePool&) = delete;
+
+      //! Destructor
+      ~IOServicePool();
+
+      /**
+        Static method to retrieve the single instance of the class
+        @return the single instance of the class
+      */
+      static IOServicePool& getInstance();
+
+      /**
+        Set the number of threads shared by all UDP and TCP clients created from now on
+        @param aNrThreads the number of threads; if 0, each new client gets its own thread
+        @note Existing clients keep using the thread that they were assigned to
+      */
+      void setNumberOfThreads ( size_t aNrThreads );
+
+      /**
+        Get the number of threads shared by the UDP and TCP clients
+        @return the number of threads; 0 if each client has its own thread
+      */
+      size_t getNumberOfThreads() const;
+
+      /**
+        Get an io_service for a new client
+        @return a shared pointer to the io_service; the associated thread is kept alive for as long as this pointer (or a copy of it) exists
+      */
+      std::shared_ptr< boost::asio::io_service > getIOService();
+
+      /**
+        Close a client's sockets and cancel its timers from within its io_service thread, and wait until all of the resulting handlers have completed
+        Clients must call this (with functions that close all their sockets and timers) in their destructor, before the sockets and timers are destroyed
+        If called from within the io_service thread itself, the close function is run immediately, without waiting for the resulting handlers (which
+        would otherwise require running the handlers of other clients sharing the thread); the client's handlers must therefore be wrapped using
+        guard, and the close function must release the token passed to guard
+        @param aIOService the client's io_service
+        @param aCloseFunction function that closes the client's sockets and cancels its timers
+      */
+      static void close ( boost::asio::io_service& aIOService , const std::function< void () >& aCloseFunction );
+
+      /**
+        Wrap a handler for one of a client's asynchronous operations, so that it does nothing once the client has been closed
+        @param aAlive token held by the client, and released by its close function
+        @param aHandler the handler
+        @return the wrapped handler
+      */
+      template < typename Handler >
+      static GuardedHandler< Handler > guard ( const std::weak_ptr< void >& aAlive , const Handler& aHandler );
+
+      /**
+        Run a task in the completion thread, which is shared by all clients and created on first use
+        Clients use this to complete the futures returned by dispatchAsync once their own thread has received the replies; since the
+        tasks run one after another, they must not block for long
+        @param aTask the task to run
+      */
+      void post ( const std::function< void () >& aTask );
+
+      /**
+        Run a task in the completion thread once a delay has elapsed, without occupying the completion thread in the meantime
+        @param aTask the task to run
+        @param aDelay the time to wait before running the task
+      */
+      void post ( const std::function< void () >& aTask , const boost::posix_time::time_duration& aDelay );
+
+    private:
+      //! The number of threads shared by the clients
+      size_t mNrThreads;
+
+      //! The shared threads, created on demand
+      std::vector< std::shared_ptr< Worker > > mWorkers;
+
+      //! The thread which runs the tasks passed to post, created on demand
+      std::shared_ptr< Worker > mCompletionWorker;
+
+      //! Mutex protecting the number of threads, the list of workers and the completion thread
+      mutable std::mutex mMutex;
+
+      //! The single instance of this class
+      static std::shared_ptr< IOServicePool > mInstance;
+  };
+
+}
+
+#include "uhal/TemplateDefinitions/IOServicePool.hxx"
+
+#endif
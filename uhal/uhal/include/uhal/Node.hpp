@@ -42,6 +42,7 @@
 
 
 #include <iterator>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -279,6 +280,13 @@ namespace uhal
       */
       ValHeader writeBlock ( const std::vector< uint32_t >& aValues ) const;
 
+      /**
+        Write a block of data to a block of registers or a block-write port, without copying the data into the send buffers
+        @param aValues the values to write to the registers or a block-write port; these are moved into the client, which keeps them until the data has been sent
+        @return a Validated Header which will contain the returned IPbus header
+      */
+      ValHeader writeBlock ( std::vector< uint32_t >&& aValues ) const;
+
       /**
         Write a block of data to a block of registers or a block-write port
         @param aValues the values to write to the registers or a block-write port
@@ -300,6 +308,14 @@ namespace uhal
       */
       ValVector< uint32_t > readBlock ( const uint32_t& aSize ) const;
 
+      /**
+        Read a block of unsigned data from a block of registers or a block-read port directly into user-provided memory
+        @param aBuffer the memory into which the data will be written; must remain valid until the transaction has been dispatched
+        @param aSize the number of words to read (the buffer must be at least this size)
+        @return a Validated Header, which is marked as valid once the data has been written into the buffer
+      */
+      ValHeader readBlock ( uint32_t* aBuffer , const uint32_t& aSize ) const;
+
       /**
         Read a block of unsigned data from a block of registers or a block-read port
         @param aSize the number of words to read
@@ -324,48 +340,101 @@ namespace uhal
 
       std::string getRelativePath(const Node& aAncestor) const;
 
+      /**
+        Check that a block write of the specified size is allowed on this node, throwing if not
+        @param aSize the number of words to be written
+      */
+      void checkWriteBlock ( const size_t aSize ) const;
+
+      /**
+        Check that a block read of the specified size is allowed on this node, throwing if not
+        @param aSize the number of words to be read
+      */
+      void checkReadBlock ( const uint32_t& aSize ) const;
+
       //! Get the full path to the current node
       void getAncestors ( std::deque< const Node* >& aPath ) const;
 
     private:
 
-      //! The parent hardware interface of which this node is a child (or rather decendent)
-      HwInterface* mHw;
+      /**
+        The properties of a node which do not depend on the device that it is bound to.
+        These are shared between all copies of a node tree (e.g. one per device), and must not be modified once the tree has been built.
+      */
+      struct Attributes
+      {
+        Attributes();
+
+        //! The Unique ID of this node
+        std::string mUid;
+
+        //! The register address with which this node is associated
+        uint32_t mPartialAddr;
 
-      //! The Unique ID of this node
-      std::string mUid;
+        //! The register address with which this node is associated
+        uint32_t mAddr;
 
-      //! The register address with which this node is associated
-      uint32_t mPartialAddr;
-      //! The register address with which this node is associated
-      uint32_t mAddr;
+        //! The mask to be applied if this node is a sub-field, rather than an entire register
+        uint32_t mMask;
 
-      //! The mask to be applied if this node is a sub-field, rather than an entire register
-      uint32_t mMask;
-      //! The read/write access permissions of this node
-      defs::NodePermission mPermission;
-      //! Whether the node represents a single register, a block of registers or a block-read/write port
-      defs::BlockReadWriteMode mMode;
-      //! The maximum size available to a block read/write
-      uint32_t mSize;
+        //! The read/write access permissions of this node
+        defs::NodePermission mPermission;
 
-      //! Optional string which the user can specify
-      std::string mTags;
+        //! Whether the node represents a single register, a block of registers or a block-read/write port
+        defs::BlockReadWriteMode mMode;
 
-      //! Optional string which the user can specify
-      std::string mDescription;
+        //! The maximum size available to a block read/write
+        uint32_t mSize;
 
-      //! The name of the module in which the current node resides
-      std::string mModule;
+        //! Optional string which the user can specify
+        std::string mTags;
 
-      //! Class name used to construct the derived node type
-      std::string mClassName;
+        //! Optional string which the user can specify
+        std::string mDescription;
 
-      //! Additional parameters of the node
-      std::unordered_map< std::string, std::string > mParameters;
+        //! The name of the module in which the current node resides
+        std::string mModule;
 
-      //!  parameters to infer the VHDL address decoding
-      std::unordered_map< std::string, std::string > mFirmwareInfo;
+        //! Class name used to construct the derived node type
+        std::string mClassName;
+
+        //! Additional parameters of the node
+        std::unordered_map< std::string, std::string > mParameters;
+
+        //!  parameters to infer the VHDL address decoding
+        std::unordered_map< std::string, std::string > mFirmwareInfo;
+
+        //! Helper to assist look-up of a particular child node, given a name (value is the index in mChildren)
+        std::unordered_map< std::string , size_t > mChildIndices;
+      };
+
+      /**
+        Returns the attributes of this node for modification, first making a private copy if they are shared with another node
+        @return the attributes of this node
+      */
+      Attributes& modifyAttributes();
+
+      //! Add a child node, taking ownership of it
+      void addChild ( Node* aChild );
+
+      //! Rebuild the index used to look up children by ID; must be called after the children are reordered
+      void indexChildren();
+
+      //! Build the index used to look up any descendant by path in a single step; called on the top node once the tree is complete
+      void indexDescendants();
+
+      //! Remove the descendant index, e.g. when the tree is included as a module in a larger tree; the index is released rather than modified, since it may be shared with other copies of the tree
+      void clearDescendantIndex();
+
+      //! Fill mDescendants from the structure of the tree, and point each descendant at its path in the index, if this node has a descendant index
+      void bindDescendants();
+
+    private:
+      //! The client through which this node's transactions are sent; NULL until the node tree is bound to a device
+      ClientInterface* mClient;
+
+      //! The device-independent properties of this node
+      std::shared_ptr< Attributes > mAttributes;
 
       //! The parent of the current node
       Node* mParent;
@@ -373,8 +442,14 @@ namespace uhal
       //! The direct children of the node
       std::vector< Node* > mChildren;
 
-      //! Helper to assist look-up of a particular child node, given a name
-      std::unordered_map< std::string , Node* > mChildrenMap;
+      //! All descendants of the node in depth-first order, if it is the top node of a tree
+      std::vector< const Node* > mDescendants;
+
+      //! For the top node of a tree, maps the path of every descendant to its index in mDescendants; shared between copies of the tree, and NULL for other nodes
+      std::shared_ptr< const std::unordered_map< std::string , size_t > > mDescendantIndices;
+
+      //! The path of this node from the indexed top node of its tree (i.e. its key in that node's descendant index), or NULL if the tree has no index
+      const std::string* mPathFromTop;
   };
 
   std::ostream& operator<< ( std::ostream& aStr ,  const uhal::Node& aNode );
@@ -41,7 +41,12 @@
 #define _uhal_NodeTreeBuilder_hpp_
 
 
+#include <deque>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <boost/filesystem/path.hpp>
 #include <boost/spirit/include/qi.hpp>
@@ -77,6 +82,9 @@ namespace uhal
 
     //! Exception class to handle the case when someone tries to give a bit-masked node a child.
     UHAL_DEFINE_EXCEPTION_CLASS ( MaskedNodeCannotHaveChild , "Exception class to handle the case when someone tries to give a bit-masked node a child." )
+
+    //! Exception class to handle the case where a compiled address table file in the on-disk cache is truncated or malformed.
+    UHAL_DEFINE_EXCEPTION_CLASS ( CorruptAddressTableCache , "Exception class to handle the case where a compiled address table file in the on-disk cache is truncated or malformed." )
   }
 
 
@@ -115,9 +123,50 @@ namespace uhal
       //! Clears address filename -> Node tree cache. NOT thread safe; for tread-safety, use ConnectionManager method
       void clearAddressFileCache();
 
+      /**
+        Set the directory in which compiled address tables are stored, so that later processes can skip parsing the XML files.
+        Compiled files are only used if the content of every file that contributed to the node tree is unchanged.
+        The initial value is taken from the UHAL_ADDRESS_TABLE_CACHE environment variable. NOT thread safe
+        @param aDirectory the cache directory; the on-disk cache is disabled if this is empty
+      */
+      void setCacheDirectory ( const boost::filesystem::path& aDirectory );
+
+      //! Returns the directory in which compiled address tables are stored (empty if the on-disk cache is disabled)
+      const boost::filesystem::path& getCacheDirectory() const;
+
+      /**
+        Set the number of threads used to read and parse module files ahead of time, while the node tree is being built.
+        The initial value is taken from the UHAL_ADDRESS_TABLE_THREADS environment variable, if set. NOT thread safe
+        @param aNrThreads the number of threads; if 0, module files are read and parsed one at a time, as they are reached
+      */
+      void setNumberOfThreads ( size_t aNrThreads );
+
+      //! Returns the number of threads used to read and parse module files ahead of time
+      size_t getNumberOfThreads() const;
+
       Node* build(const pugi::xml_node& aNode, const boost::filesystem::path& aAddressFilePath);
 
     private:
+      //! An address file that has been opened, and possibly also parsed
+      struct AddressFile
+      {
+        //! The protocol by which the file was loaded
+        std::string mProtocol;
+        //! The fully qualified path to the file
+        boost::filesystem::path mPath;
+        //! The content of the file; modified by the XML parser, if the file has been parsed
+        std::vector<uint8_t> mContent;
+        //! Hash of the original content of the file
+        uint64_t mHash;
+        //! The parsed XML document; NULL if the file has not been parsed yet
+        std::shared_ptr<pugi::xml_document> mDocument;
+        //! The result of parsing the XML document
+        pugi::xml_parse_result mParseResult;
+      };
+
+      //! Reads and parses module files in a pool of threads, while the top-level node tree is being built
+      class Prefetcher;
+
       /**
       	Method called once the file specified in the call to getNodeTree( aFilenameExpr ) has been opened
       	@param aProtocol The protocol by which the file was loaded
@@ -127,6 +176,20 @@ namespace uhal
       */
       void CallBack ( const std::string& aProtocol , const boost::filesystem::path& aPath , std::vector<uint8_t>& aFile , std::vector< const Node* >& aAddressTable );
 
+      /**
+        Construct the node tree for an address file, unless it has been constructed already
+        @param aFile the address file, which is parsed if that hasn't been done already
+        @param aAddressTable The address table constructed from the file
+      */
+      void addFile ( AddressFile& aFile , std::vector< const Node* >& aAddressTable );
+
+      /**
+        Start reading and parsing the files of the module nodes within an XML document in the prefetch threads
+        @param aXmlNode the top-level node of the XML document
+        @param aPath the path of the XML document
+      */
+      void prefetchModules ( const pugi::xml_node& aXmlNode , const boost::filesystem::path& aPath );
+
       /**
       	Propagate the addresses down through the hierarchical structure
       	@param aNode the node whose address we are calculating
@@ -154,6 +217,34 @@ namespace uhal
       void setFirmwareInfo ( const pugi::xml_node& aXmlNode , Node* aNode );
       void addChildren ( const pugi::xml_node& aXmlNode , Node* aNode );
 
+      //! The files (protocol + path) from which a node tree was built, along with a hash of their contents
+      typedef std::vector< std::pair< std::string , uint64_t > > FileDependencies;
+
+      //! Record that the node tree currently being built depends on the specified files
+      void addDependencies ( const FileDependencies& aDependencies );
+
+      //! Returns the path of the compiled address table file for the specified address file (protocol + path)
+      boost::filesystem::path getCachePath ( const std::string& aName ) const;
+
+      /**
+        Load a node tree from the on-disk cache, if the compiled file is present and up to date
+        @param aName the protocol and path of the address file
+        @param aHash hash of the current content of the address file
+        @param aDependencies filled with the files that the cached node tree was built from
+        @return the cached node tree, or NULL if the XML file must be parsed
+      */
+      Node* loadCachedNodeTree ( const std::string& aName , const uint64_t aHash , FileDependencies& aDependencies );
+
+      //! Write a node tree to the on-disk cache
+      void writeCachedNodeTree ( const std::string& aName , const Node& aNode , const FileDependencies& aDependencies );
+
+      /**
+        Append a node and its descendants to a compiled address table
+        @return false if a node is of a derived type whose creator cannot identify it, so the tree cannot be cached
+      */
+      bool writeCachedNode ( const Node& aNode , std::string& aBuffer );
+      Node* readCachedNode ( const uint8_t*& aPtr , const uint8_t* aEnd );
+
       static const std::string mIdAttribute;
       static const std::string mAddressAttribute;
       static const std::string mParametersAttribute;
@@ -179,6 +270,21 @@ namespace uhal
       //! Hash map associating a Node tree with a file name so that we do not need to repeatedly parse the xml documents if someone asks for a second copy of a particular node tree
       std::unordered_map< std::string , const Node* > mNodes;
 
+      //! The files that each of the node trees in mNodes was built from
+      std::unordered_map< std::string , FileDependencies > mFileDependencies;
+
+      //! The files read so far for each of the node trees currently being built (innermost module last)
+      std::deque< FileDependencies > mDependencyStack;
+
+      //! Directory in which compiled address tables are stored; empty if the on-disk cache is disabled
+      boost::filesystem::path mCacheDirectory;
+
+      //! The number of threads used to read and parse module files ahead of time
+      size_t mNrThreads;
+
+      //! Threads reading and parsing module files for the top-level node tree currently being built
+      std::unique_ptr<Prefetcher> mPrefetcher;
+
       //! A look-up table that the boost qi parser uses for associating strings ("r","w","rw","wr","read","write","readwrite","writeread") with enumerated permissions types
       static const struct permissions_lut : boost::spirit::qi::symbols<char, defs::NodePermission>
       {
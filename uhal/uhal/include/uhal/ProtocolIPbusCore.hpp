@@ -162,6 +162,14 @@ namespace uhal
       */
       virtual ValHeader implementWriteBlock ( const uint32_t& aAddr, const std::vector< uint32_t >& aValues, const defs::BlockReadWriteMode& aMode=defs::INCREMENTAL );
 
+      /**
+        Write a block of data to a block of registers or a block-write port, referencing the data from the send buffers rather than copying it
+        @param aAddr the address of the register to write
+        @param aValues the values to write to the registers or a block-write port
+        @param aMode whether we are writing to a block of registers (INCREMENTAL) or a block-write port (NON_INCREMENTAL)
+      */
+      virtual ValHeader implementWriteBlockByReference ( const uint32_t& aAddr, const std::shared_ptr< const std::vector< uint32_t > >& aValues, const defs::BlockReadWriteMode& aMode=defs::INCREMENTAL );
+
       /**
         Read a single, masked, unsigned word
         @param aAddr the address of the register to read
@@ -179,6 +187,16 @@ namespace uhal
       */
       virtual ValVector< uint32_t > implementReadBlock ( const uint32_t& aAddr, const uint32_t& aSize, const defs::BlockReadWriteMode& aMode=defs::INCREMENTAL );
 
+      /**
+        Read a block of unsigned data from a block of registers or a block-read port directly into user-provided memory
+        @param aAddr the lowest address in the block of registers or the address of the block-read port
+        @param aBuffer the memory into which the data will be written
+        @param aSize the number of words to read
+        @param aMode whether we are reading from a block of registers (INCREMENTAL) or a block-read port (NON_INCREMENTAL)
+        @return a Validated Header, which is marked as valid once the data has been written into the buffer
+      */
+      virtual ValHeader implementReadBlockIntoBuffer ( const uint32_t& aAddr, uint32_t* aBuffer, const uint32_t& aSize, const defs::BlockReadWriteMode& aMode=defs::INCREMENTAL );
+
       /**
         Read a single, masked, unsigned word from the configuration address space
         @param aAddr the address of the register to read
@@ -251,6 +269,27 @@ namespace uhal
 
     private:
 
+      /**
+        Write a block of data, split over as many IPbus transactions as required
+        @param aAddr the address of the register to write
+        @param aSource the values to write to the registers or a block-write port
+        @param aMode whether we are writing to a block of registers (INCREMENTAL) or a block-write port (NON_INCREMENTAL)
+        @param aSourceOwner if non-null, the payload is referenced from the send buffers (rather than copied), and this is stored in those buffers to keep the values alive
+      */
+      ValHeader implementWriteBlock ( const uint32_t& aAddr, const std::vector< uint32_t >& aSource, const defs::BlockReadWriteMode& aMode, const std::shared_ptr< const std::vector< uint32_t > >& aSourceOwner );
+
+      /**
+        Read a block of data, split over as many IPbus transactions as required
+        @param aAddr the lowest address in the block of registers or the address of the block-read port
+        @param aDestination the memory into which the data will be written
+        @param aSize the number of words to read
+        @param aMode whether we are reading from a block of registers (INCREMENTAL) or a block-read port (NON_INCREMENTAL)
+        @param aReply the validated memory whose IPbus headers are filled in, and which is stored in the last buffer
+        @param aReplyMembers the members of the validated memory
+      */
+      template < typename T >
+      void implementReadBlock ( const uint32_t& aAddr, uint8_t* aDestination, const uint32_t& aSize, const defs::BlockReadWriteMode& aMode, const T& aReply, _ValHeader_& aReplyMembers );
+
       virtual std::function<void (std::ostream&, const uint8_t&)> getInfoCodeTranslator() = 0;
 
       //! The transaction counter which will be incremented in the sent IPbus headers
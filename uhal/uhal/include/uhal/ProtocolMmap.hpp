@@ -55,6 +55,7 @@
 
 #include "uhal/ClientInterface.hpp"
 #include "uhal/log/exception.hpp"
+#include "uhal/log/LogRateLimiter.hpp"
 #include "uhal/ProtocolIPbus.hpp"
 
 
@@ -87,7 +88,7 @@ namespace uhal
         const std::vector< std::pair<const uint8_t*, size_t> > mData;
       };
 
-    private:
+      //! Device file, mapped into memory on opening; the request packets are written to it, and status words & replies read from it
       class File {
       public:
         File(const std::string& aPath, int aFlags);
@@ -103,6 +104,10 @@ namespace uhal
 
         void read(const uint32_t aAddr, const uint32_t aNrWords, std::vector<uint32_t>& aValues);
 
+        //! Copy aNrBytes bytes, starting at 32-bit word address aAddr, directly into the memory at aPtr
+        void read(const uint32_t aAddr, uint8_t* const aPtr, const size_t aNrBytes);
+
+        //! Write the concatenation of the data fragments starting at byte address aAddr, without an intermediate buffer
         void write(const uint32_t aAddr, const std::vector<std::pair<const uint8_t*, size_t> >& aData);
 
       private:
@@ -114,6 +119,7 @@ namespace uhal
         void* mMmapIOPtr;
       };
 
+    private:
       template <typename T>
       struct HexTo {
         T value;
@@ -191,11 +197,17 @@ namespace uhal
 
       std::chrono::microseconds mSleepDuration;
 
+      //! Header word and send segments of the packet being written; kept as a member to avoid allocating for each packet
+      std::vector<std::pair<const uint8_t*, size_t> > mDataToWrite;
+
       uint32_t mNumberOfPages, mPageSize, mIndexNextPage, mPublishedReplyPageCount, mReadReplyPageCount;
 
       //! The list of buffers still awaiting a reply
       std::deque < std::shared_ptr< Buffers > > mReplyQueue;
 
+      //! Rate limiters for the log entries written for each packet, so that enabling the Info level does not flood the log
+      LogRateLimiter mWriteLogLimiter, mStatusLogLimiter, mReadLogLimiter, mReplyLengthLogLimiter;
+
       /**
         A pointer to an exception object for passing exceptions from the worker thread to the main thread.
         Exceptions must always be created on the heap (i.e. using `new`) and deletion will be handled in the main thread
@@ -43,13 +43,18 @@
 #define _uhal_ProtocolPCIe_hpp_
 
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <deque>                           // for deque
+#include <exception>
 #include <memory>
 #include <mutex>
 #include <stddef.h>                        // for size_t
 #include <stdint.h>                        // for uint32_t, uint8_t
 #include <string>                          // for string
+#include <sys/uio.h>                       // for iovec
+#include <thread>
 #include <utility>                         // for pair
 #include <vector>                          // for vector
 
@@ -57,6 +62,7 @@
 
 #include "uhal/ClientInterface.hpp"
 #include "uhal/log/exception.hpp"
+#include "uhal/log/LogRateLimiter.hpp"
 #include "uhal/ProtocolIPbus.hpp"
 
 
@@ -105,12 +111,33 @@ namespace uhal
 
         void read(const uint32_t aAddr, const uint32_t aNrWords, std::vector<uint32_t>& aValues);
 
+        /**
+          Read directly into a list of memory regions, using a single positioned, vectored read
+          @param aAddr byte address of the start of the read
+          @param aData the memory regions to fill, in order
+        */
+        void read(const uint32_t aAddr, const std::vector<struct iovec>& aData);
+
+        /**
+          Block until the file becomes readable (i.e. an event is pending), or the timeout expires
+          @param aTimeout the maximum time to wait
+          @return true if the file is readable, false if the timeout expired
+        */
+        bool waitUntilReadable(const std::chrono::microseconds& aTimeout);
+
         void write(const uint32_t aAddr, const std::vector<uint32_t>& aValues);
 
         void write(const uint32_t aAddr, const uint8_t* const aPtr, const size_t aNrBytes);
 
         void write(const uint32_t aAddr, const std::vector<std::pair<const uint8_t*, size_t> >& aData);
 
+        /**
+          Write the concatenation of a list of memory regions, using a single positioned, vectored write
+          @param aAddr byte address of the start of the write
+          @param aData the memory regions to write, in order
+        */
+        void write(const uint32_t aAddr, const std::vector<struct iovec>& aData);
+
         bool haveLock() const;
 
         void lock();
@@ -121,9 +148,14 @@ namespace uhal
         std::string mPath;
         int mFd;
         int mFlags;
+        //! False if the file is a FIFO (as used by the dummy hardware), in which case writes ignore the address
+        bool mSeekable;
         bool mLocked;
+        //! Persistent page-aligned buffer, only used if a transfer consists of more regions than a single syscall accepts
         size_t mBufferSize;
         char* mBuffer;
+        //! Scratch list of regions for the write method that takes a list of pointer-size pairs
+        std::vector<struct iovec> mIOVecs;
       };
 
     private:
@@ -189,6 +221,12 @@ namespace uhal
       //!	Destructor
       virtual ~PCIe();
 
+      //! Return the number of replies that have been read and validated by the completion thread
+      uint64_t getCompletionThreadReplyCount() const;
+
+      //! Return the number of times that the client has stopped spinning, and blocked or slept, while waiting for a reply
+      uint64_t getReplyWaitCount() const;
+
     private:
 
       PCIe ( const PCIe& aPCIe );
@@ -205,6 +243,15 @@ namespace uhal
       //! Concrete implementation of the synchronization function to block until all buffers have been sent, all replies received and all data validated
       virtual void Flush( );
 
+      /**
+        Packets are written to the device as soon as they are dispatched, so nothing is held back
+        @return whether the replies are read by the completion thread
+      */
+      virtual bool beginFlush( );
+
+      //! Report whether the completion thread has hit an error which Flush would rethrow, without waiting for any replies
+      virtual bool asynchronousExceptionPending( );
+
       //! Function which tidies up this protocol layer in the event of an exception
       virtual void dispatchExceptionHandler();
 
@@ -239,6 +286,12 @@ namespace uhal
       //! Read next pending reply packet from appropriate page of FPGA-to-host device file, and validate contents
       void read();
 
+      //! Body of the completion thread: reads and validates replies as soon as packets are in flight, until told to stop
+      void runCompletionThread();
+
+      //! Stop the completion thread from starting on any further replies, and wait until it has finished any reply that it's currently reading
+      void pauseCompletionThread();
+
       bool mConnected;
 
       //! Host-to-FPGA device file
@@ -258,10 +311,53 @@ namespace uhal
 
       std::chrono::microseconds mSleepDuration;
 
+      //! Time for which the page count / event file is re-read without sleeping, before blocking or sleeping
+      std::chrono::microseconds mSpinDuration;
+      //! Number of times that the client has blocked or slept after the spin period, while waiting for a reply
+      std::atomic<uint64_t> mReplyWaitCount;
+
       uint32_t mNumberOfPages, mMaxInFlight, mPageSize, mMaxPacketSize, mIndexNextPage, mPublishedReplyPageCount, mReadReplyPageCount;
 
       //! The list of buffers still awaiting a reply
       std::deque < std::shared_ptr< Buffers > > mReplyQueue;
+
+      //! Header word and send segments of the packet being written; kept as a member to avoid allocating for each packet
+      std::vector<std::pair<const uint8_t*, size_t> > mDataToWrite;
+
+      //! Memory regions that the reply page is read into (header word, reply buffers, padding); kept as a member to avoid allocating for each packet
+      std::vector<struct iovec> mReplyIOVecs;
+
+      //! Destination for the extra words read by the 7-series xdma workaround
+      uint32_t mReplyPadding[4];
+
+      //! Whether replies are read and validated by a dedicated completion thread, rather than by the thread calling dispatch
+      bool mUseCompletionThread;
+
+      //! Thread that reads and validates replies, if mUseCompletionThread is true
+      std::thread mCompletionThread;
+
+      //! Mutex protecting the reply queue, the next page index and the completion thread's state, when the completion thread is used
+      std::mutex mReplyQueueMutex;
+
+      //! Signals changes to the reply queue, or to the completion thread's state
+      std::condition_variable mReplyQueueCondition;
+
+      //! Set to stop the completion thread
+      bool mStopCompletionThread;
+
+      //! Set while the completion thread must not start reading any further replies
+      bool mCompletionThreadPaused;
+
+      //! Rate limiters for the log entries written for each packet, so that enabling the Info level does not flood the log
+      LogRateLimiter mWriteLogLimiter, mReadLogLimiter, mReplyLengthLogLimiter;
+
+      //! True while the completion thread is reading a reply
+      bool mCompletionThreadBusy;
+      //! Number of replies read by the completion thread
+      std::atomic<uint64_t> mCompletionThreadReplyCount;
+
+      //! Exception thrown in the completion thread, to be rethrown in the thread calling dispatch
+      std::exception_ptr mAsynchronousException;
   };
 
   std::ostream& operator<<(std::ostream& aStream, const PCIe::PacketFmt& aPacket);
@@ -121,6 +121,15 @@ namespace uhal
       //! Concrete implementation of the synchronization function to block until all buffers have been sent, all replies received and all data validated
       virtual void Flush( );
 
+      /**
+        Send the packets which are being held back to be combined with later ones, without waiting for the replies
+        @return true, since the replies are received in the IO thread
+      */
+      virtual bool beginFlush( );
+
+      //! Report whether the IO thread has hit an error which Flush would rethrow, without waiting for any replies
+      virtual bool asynchronousExceptionPending( );
+
       //! Function which tidies up this protocol layer in the event of an exception
       virtual void dispatchExceptionHandler();
 
@@ -186,8 +195,8 @@ namespace uhal
       //! The maximum UDP payload size (in bytes)
       size_t mMaxPayloadSize;
 
-      //! The boost::asio::io_service used to create the connections
-      boost::asio::io_service mIOservice;
+      //! The boost::asio::io_service used to create the connections (either dedicated to this client, or shared via the IOServicePool)
+      std::shared_ptr< boost::asio::io_service > mIOservice;
 
       //! A shared pointer to a boost::asio tcp socket through which the operation will be performed
       boost::asio::ip::tcp::socket mSocket;
@@ -198,11 +207,11 @@ namespace uhal
       //! The mechanism for providing the time-out
       boost::asio::deadline_timer mDeadlineTimer;
 
-      /// Needed when multi-threading to stop the boost::asio::io_service thinking it has nothing to do and so close the socket
-      boost::asio::io_service::work mIOserviceWork;
+      //! Set when the client is being destroyed, to stop the deadline timer from being re-armed
+      bool mClosing;
 
-      //! The Worker thread in Multi-threaded mode
-      std::thread mDispatchThread;
+      //! Token passed to the handlers of the asynchronous operations, which do nothing once it has been released when the client is closed
+      std::shared_ptr< void > mAliveToken;
 
       //! A MutEx lock used to make sure the access functions are thread safe
       std::mutex mTransportLayerMutex;
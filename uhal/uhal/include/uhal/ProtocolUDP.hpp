@@ -40,9 +40,11 @@
 #define _uhal_ProtocolUDP_hpp_
 
 
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <stdint.h>
 #include <string>
@@ -55,6 +57,7 @@
 
 #include "uhal/ClientInterface.hpp"
 #include "uhal/log/exception.hpp"
+#include "uhal/log/LogRateLimiter.hpp"
 
 
 namespace boost {
@@ -109,6 +112,18 @@ namespace uhal
       //! Destructor
       virtual ~UDP();
 
+      /**
+        Return the maximum number of packets that may currently be in flight
+        @return the congestion window if congestion control is enabled, and otherwise the number of buffers in the target
+      */
+      uint32_t getCongestionWindow();
+
+      /**
+        Return the largest number of packets that have been sent in a single sendmmsg call
+        @return the largest batch sent so far, or 0 if packets are sent individually via ASIO
+      */
+      uint32_t getLargestBatch();
+
     private:
       /**
       	Send the IPbus buffer to the target, read back the response and call the packing-protocol's validate function
@@ -120,6 +135,15 @@ namespace uhal
       //! Concrete implementation of the synchronization function to block until all buffers have been sent, all replies received and all data validated
       virtual void Flush( );
 
+      /**
+        Packets are sent as soon as the in-flight window allows, so nothing is held back
+        @return true, since the replies are received in the IO thread
+      */
+      virtual bool beginFlush( );
+
+      //! Report whether the IO thread has hit an error which Flush would rethrow, without waiting for any replies
+      virtual bool asynchronousExceptionPending( );
+
       //! Function which tidies up this protocol layer in the event of an exception
       virtual void dispatchExceptionHandler();
 
@@ -152,6 +176,13 @@ namespace uhal
       */
       void write_callback ( const boost::system::error_code& aErrorCode , std::size_t aBytesTransferred );
 
+      /**
+        Send the current dispatch buffer, along with any others in the current batch, using a single sendmmsg call
+        @param aErrorCode set to the error encountered during the send, if any
+        @return the total number of bytes sent
+      */
+      std::size_t sendBatch ( boost::system::error_code& aErrorCode );
+
       /**
         Initialize performing the next UDP read operation
         In multi-threaded mode, this runs the ASIO async receive and exits
@@ -166,6 +197,83 @@ namespace uhal
       */
       void read_callback ( const boost::system::error_code& aErrorCode , std::size_t aBytesTransferred );
 
+      /**
+        Receive all available replies to buffers currently awaiting a reply (up to the maximum batch size) using a single recvmmsg call
+        @param aByteCounts returns the number of bytes received in each reply packet
+        @param aErrorCode set to the error encountered during the receive, if any
+      */
+      void receiveBatch ( std::vector< uint32_t >& aByteCounts , boost::system::error_code& aErrorCode );
+
+      /**
+        Copy a reply packet into the reply buffer's destinations, validate it, and move on to the next buffer awaiting a reply
+        @param aReplyData a pointer to the start of the reply packet
+        @param aBytesTransferred the number of bytes in the reply packet
+        @return whether the reply was validated successfully
+      */
+      bool processReply ( const uint8_t* aReplyData , std::size_t aBytesTransferred );
+
+      /**
+        Return how long to wait for a reply before declaring it lost
+        @return the full timeout period, or a fraction of it if packet-loss recovery is enabled
+      */
+      boost::posix_time::time_duration getReplyTimeout();
+
+      /**
+        Give a packet the next ID in the sequence expected by the target, in place of the ID 0 used by the IPbus layer (packet-loss recovery only)
+        @param aBuffers the buffer containing the packet
+      */
+      void assignPacketId ( Buffers& aBuffers );
+
+      /**
+        Start querying the target's next expected packet ID with a status request, so that sequential packet IDs can be used (packet-loss recovery only)
+        Packets are queued until the status reply is received by the IO thread; the deadline timer repeats the request if there is no reply
+      */
+      void synchronisePacketIds();
+
+      /**
+        Callback function which is called upon completion of the ASIO async receive of the reply to the status request sent by synchronisePacketIds
+        This, then, assigns packet IDs to the queued packets and starts sending them
+        @param aErrorCode the error code with which the ASIO operation completed
+        @param aBytesTransferred the number of bytes received
+      */
+      void synchronise_callback ( const boost::system::error_code& aErrorCode , std::size_t aBytesTransferred );
+
+      //! Send an IPbus 2.0 status request to the target
+      void sendStatusRequest();
+
+      //! Start recovering from a missing reply, by sending a status request (called from the deadline timer when packet-loss recovery is enabled)
+      void requestRecovery();
+
+      /**
+        Resend the requests, or request resends of the replies, of all packets in flight that are missing a reply, according to the target's status
+        @param aReplyData a pointer to the start of the status reply packet
+        @param aBytesTransferred the number of bytes in the status reply packet
+      */
+      void handleStatusReply ( const uint8_t* aReplyData , std::size_t aBytesTransferred );
+
+      /**
+        Pass a received packet to processReply, first checking (if packet-loss recovery is enabled) whether it is a status reply, or the reply to a packet other than the oldest one in flight
+        @param aReplyData a pointer to the start of the received packet
+        @param aBytesTransferred the number of bytes in the received packet
+        @return whether the reply was validated successfully (or was not a reply to the oldest packet in flight)
+      */
+      bool handleReply ( const uint8_t* aReplyData , std::size_t aBytesTransferred );
+
+      /**
+        Return the maximum number of packets that may currently be in flight
+        @return the congestion window if congestion control is enabled, and otherwise the number of buffers in the target
+      */
+      uint32_t getWindowSize();
+
+      /**
+        Update the round-trip time estimate with the round-trip time of a packet, and grow the congestion window
+        @param aRoundTripTime the time between the packet being sent and its reply being received
+      */
+      void updateCongestionWindow ( const std::chrono::steady_clock::duration& aRoundTripTime );
+
+      //! Halve the congestion window (at most once per round-trip time) in response to a lost request or reply
+      void reduceCongestionWindow();
+
       //! Function called by the ASIO deadline timer
       void CheckDeadline();
 
@@ -179,11 +287,19 @@ namespace uhal
       void WaitOnConditionalVariable();
 
     private:
+      //! The maximum number of status requests sent to recover a lost packet, before giving up and reporting a timeout
+      static const uint32_t kMaxRecoveryAttempts = 3;
+
       //! The maximum UDP payload size (in bytes)
       size_t mMaxPayloadSize;
 
-      //! The boost::asio::io_service used to create the connections
-      boost::asio::io_service mIOservice;
+      //! The maximum number of packets sent/received in each sendmmsg/recvmmsg call; if 1, packets are sent/received individually via ASIO
+      size_t mMaxBatchSize;
+      //! The largest number of packets sent in a single sendmmsg call so far
+      size_t mLargestBatch;
+
+      //! The boost::asio::io_service used to create the connections (either dedicated to this client, or shared via the IOServicePool)
+      std::shared_ptr< boost::asio::io_service > mIOservice;
 
       //! A shared pointer to a boost::asio udp socket through which the operation will be performed
       boost::asio::ip::udp::socket mSocket;
@@ -195,17 +311,17 @@ namespace uhal
       boost::asio::deadline_timer mDeadlineTimer;
 
       /**
-        A block of memory into which we write replies, before copying them to their final destination
+        A block of memory into which we write replies, before copying them to their final destination (one slot of mMaxPayloadSize+20 bytes for each packet in a batch)
         @note This should not be necessary and was, for a while, removed, with the buffer sequence created, instead, pointing to the final destinations
         @note Tom Williams, however believes that there is a problem with scatter-gather operations of size>64 with the UDP and so has reverted it -- see https://svnweb.cern.ch/trac/cactus/ticket/259#comment:17
       */
       std::vector<uint8_t> mReplyMemory;
 
-      //! Needed when multi-threading to stop the boost::asio::io_service thinking it has nothing to do and so close the socket
-      boost::asio::io_service::work mIOserviceWork;
+      //! Set when the client is being destroyed, to stop the deadline timer from being re-armed
+      bool mClosing;
 
-      //! The Worker thread in Multi-threaded mode
-      std::thread mDispatchThread;
+      //! Token passed to the handlers of the asynchronous operations, which do nothing once it has been released when the client is closed
+      std::shared_ptr< void > mAliveToken;
 
       //! A MutEx lock used to make sure the access functions are thread safe
       std::mutex mTransportLayerMutex;
@@ -218,6 +334,35 @@ namespace uhal
       //! Counter of how many writes have been sent, for which no reply has yet been received
       uint32_t mPacketsInFlight;
 
+      //! Whether the number of packets in flight is limited by a congestion window, rather than just by the number of buffers in the target
+      bool mCongestionControl;
+      //! The congestion window (i.e. maximum number of packets in flight); fractional, since it grows by 1/window for each reply in congestion avoidance
+      double mCongestionWindow;
+      //! Window size above which the congestion window grows linearly rather than exponentially
+      double mSlowStartThreshold;
+      //! Smoothed round-trip time, in microseconds; 0 until the first reply is received
+      double mSmoothedRoundTripTime;
+      //! Round-trip time variation, in microseconds
+      double mRoundTripTimeVariation;
+      //! The congestion window is not reduced again until this time, so that a burst of late replies only counts as one congestion event
+      std::chrono::steady_clock::time_point mWindowReductionHoldoff;
+      //! The times at which the packets in flight were sent, in the same order as the packets (only filled if congestion control is enabled)
+      std::deque< std::chrono::steady_clock::time_point > mSendTimes;
+
+      //! Whether lost packets are recovered using IPbus 2.0 status and resend requests, rather than causing a timeout
+      bool mPacketLossRecovery;
+      //! The ID of the next control packet to be sent (packet-loss recovery only); 0 until the IDs have been synchronised with the target
+      uint16_t mNextPacketId;
+      //! Whether a status request has been sent to find the next packet ID, and its reply has not been received yet
+      bool mSynchronisingPacketIds;
+      //! The number of status requests sent since the last reply was received
+      uint32_t mRecoveryAttempts;
+      //! Replies received before the reply to an earlier packet, indexed by packet header
+      std::map< uint32_t , std::vector< uint8_t > > mOutOfOrderReplies;
+
+      //! Rate limiters for the log entries written for each unexpected or lost packet, so that a burst of packet loss does not flood the log
+      LogRateLimiter mUnexpectedPacketLogLimiter, mLostPacketLogLimiter, mResendLogLimiter;
+
       //! A mutex for use by the conditional variable
       std::mutex mConditionalVariableMutex;
       //! A conditional variable for blocking the main thread until the variable with which it is associated is set correctly
@@ -227,6 +372,8 @@ namespace uhal
 
       //! The send operation currently in progress
       std::shared_ptr< Buffers > mDispatchBuffers;
+      //! Additional buffers sent in the same sendmmsg call as mDispatchBuffers (batched mode only)
+      std::vector< std::shared_ptr< Buffers > > mDispatchBatch;
       //! The receive operation currently in progress or the next to be done
       std::shared_ptr< Buffers > mReplyBuffers;
 
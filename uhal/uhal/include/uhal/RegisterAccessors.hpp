@@ -0,0 +1,109 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+---------------------------------------------------------------------------
+*/
+
+/**
+	@file
+	Typed accessors for registers whose properties are known at compile time, as described by the headers written by the
+	gen_uhal_register_header script. Each node of the address table becomes a struct with the following static members:
+	  - static constexpr const char* path : the ID path of the node, relative to the top of the address table
+	  - static constexpr uint32_t address : the absolute address of the node
+	  - static constexpr uint32_t mask : the mask of the node
+	  - static constexpr defs::NodePermission permission : the read/write permissions of the node
+	  - static constexpr defs::BlockReadWriteMode mode : the block read/write mode of the node
+	  - static constexpr uint32_t size : the maximum size of block transfers to the node
+	Access which the address table does not permit (e.g. writing a read-only register) is rejected by the compiler.
+*/
+
+#ifndef _uhal_RegisterAccessors_hpp_
+#define _uhal_RegisterAccessors_hpp_
+
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "uhal/ClientInterface.hpp"
+#include "uhal/definitions.hpp"
+#include "uhal/Node.hpp"
+#include "uhal/ValMem.hpp"
+
+
+namespace uhal
+{
+  namespace registers
+  {
+    /**
+      Read a single word from a register, without looking the node up by name
+      @tparam R the generated description of the register
+      @param aClient the client through which the transaction will be sent
+      @return a Validated Memory which wraps the location to which the reply data is to be written
+    */
+    template< typename R >
+    ValWord< uint32_t > read ( ClientInterface& aClient );
+
+    /**
+      Write a single word to a register, without looking the node up by name
+      @tparam R the generated description of the register
+      @param aClient the client through which the transaction will be sent
+      @param aValue the value to write to the register
+      @return a Validated Memory which wraps the transaction's header
+    */
+    template< typename R >
+    ValHeader write ( ClientInterface& aClient , const uint32_t& aValue );
+
+    /**
+      Read a block of words from a block of registers or a block-read port, without looking the node up by name
+      @tparam R the generated description of the register
+      @param aClient the client through which the transaction will be sent
+      @param aSize the number of words to read
+      @return a Validated Memory which wraps the location to which the reply data is to be written
+    */
+    template< typename R >
+    ValVector< uint32_t > readBlock ( ClientInterface& aClient , const uint32_t& aSize );
+
+    /**
+      Write a block of words to a block of registers or a block-write port, without looking the node up by name
+      @tparam R the generated description of the register
+      @param aClient the client through which the transaction will be sent
+      @param aValues the values to write
+      @return a Validated Memory which wraps the transaction's header
+    */
+    template< typename R >
+    ValHeader writeBlock ( ClientInterface& aClient , const std::vector< uint32_t >& aValues );
+
+    /**
+      Check that the generated description of a register agrees with the address table that a node tree was built from
+      @tparam R the generated description of the register
+      @param aTop the top node of the tree
+      @return whether the tree contains a node with the same path, address, mask, permissions, mode and size
+    */
+    template< typename R >
+    bool matches ( const Node& aTop );
+  }
+}
+
+#include "uhal/TemplateDefinitions/RegisterAccessors.hxx"
+
+#endif
@@ -31,6 +31,8 @@
 */
 
 
+#include <typeinfo>
+
 #include "uhal/log/LogLevels.hpp"
 #include "uhal/log/log_inserters.quote.hpp"
 #include "uhal/log/log_inserters.type.hpp"
@@ -62,4 +64,11 @@ namespace uhal
     return new T ( aNode );
   }
 
+
+  template <class T>
+  bool DerivedNodeFactory::Creator<T>::isTypeOf ( const Node& aNode ) const
+  {
+    return typeid ( aNode ) == typeid ( T );
+  }
+
 }
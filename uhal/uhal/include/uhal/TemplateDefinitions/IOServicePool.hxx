@@ -0,0 +1,65 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+---------------------------------------------------------------------------
+*/
+
+
+namespace uhal
+{
+
+  template < typename Handler >
+  GuardedHandler< Handler >::GuardedHandler ( const std::weak_ptr< void >& aAlive , const Handler& aHandler ) :
+    mAlive ( aAlive ),
+    mHandler ( aHandler )
+  {
+  }
+
+
+  template < typename Handler >
+  void GuardedHandler< Handler >::operator() ( const boost::system::error_code& aErrorCode )
+  {
+    // The client is only closed from within its io_service thread, so it cannot be closed while the handler runs
+    if ( ! mAlive.expired() )
+    {
+      mHandler ( aErrorCode );
+    }
+  }
+
+
+  template < typename Handler >
+  void GuardedHandler< Handler >::operator() ( const boost::system::error_code& aErrorCode , std::size_t aBytesTransferred )
+  {
+    if ( ! mAlive.expired() )
+    {
+      mHandler ( aErrorCode , aBytesTransferred );
+    }
+  }
+
+
+  template < typename Handler >
+  GuardedHandler< Handler > IOServicePool::guard ( const std::weak_ptr< void >& aAlive , const Handler& aHandler )
+  {
+    return GuardedHandler< Handler > ( aAlive , aHandler );
+  }
+
+}
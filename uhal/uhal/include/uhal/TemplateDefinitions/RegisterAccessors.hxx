@@ -0,0 +1,142 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+---------------------------------------------------------------------------
+*/
+
+
+#include <string>
+
+#include "uhal/log/log_inserters.quote.hpp"
+#include "uhal/log/log.hpp"
+
+
+namespace uhal
+{
+  namespace registers
+  {
+    // NOTE: The static members of the generated structs are copied into locals before being passed by reference, so that
+    //       they do not need a definition outside of the struct
+
+    template< typename R >
+    ValWord< uint32_t > read ( ClientInterface& aClient )
+    {
+      static_assert ( ( R::permission & defs::READ ) , "Register does not allow read access" );
+      const uint32_t lAddr ( R::address );
+      const uint32_t lMask ( R::mask );
+
+      if ( lMask == defs::NOMASK )
+      {
+        return aClient.read ( lAddr );
+      }
+      else
+      {
+        return aClient.read ( lAddr , lMask );
+      }
+    }
+
+
+    template< typename R >
+    ValHeader write ( ClientInterface& aClient , const uint32_t& aValue )
+    {
+      static_assert ( ( R::permission & defs::WRITE ) , "Register does not allow write access" );
+      // Masked writes are implemented as RMW transactions, which involve reading the register
+      static_assert ( ( R::mask == defs::NOMASK ) or ( R::permission & defs::READ ) , "Cannot write to a write-only masked register" );
+      const uint32_t lAddr ( R::address );
+      const uint32_t lMask ( R::mask );
+
+      if ( lMask == defs::NOMASK )
+      {
+        return aClient.write ( lAddr , aValue );
+      }
+      else
+      {
+        return aClient.write ( lAddr , aValue , lMask );
+      }
+    }
+
+
+    template< typename R >
+    ValVector< uint32_t > readBlock ( ClientInterface& aClient , const uint32_t& aSize )
+    {
+      static_assert ( ( R::permission & defs::READ ) , "Register does not allow read access" );
+
+      if ( ( R::mode == defs::SINGLE ) && ( aSize != 1 ) ) //We allow the user to call a bulk access of size=1 to a single register
+      {
+        exception::BulkTransferOnSingleRegister lExc;
+        log ( lExc , "Bulk Transfer requested on single register node ", Quote ( std::string ( R::path ) ) );
+        throw lExc;
+      }
+
+      if ( ( R::size != 1 ) && ( aSize > R::size ) )
+      {
+        exception::BulkTransferRequestedTooLarge lExc;
+        log ( lExc , "Requested bulk read of greater size than the specified endpoint size of node " , Quote ( std::string ( R::path ) ) );
+        throw lExc;
+      }
+
+      const uint32_t lAddr ( R::address );
+      const defs::BlockReadWriteMode lMode ( R::mode );
+      return aClient.readBlock ( lAddr , aSize , lMode );
+    }
+
+
+    template< typename R >
+    ValHeader writeBlock ( ClientInterface& aClient , const std::vector< uint32_t >& aValues )
+    {
+      static_assert ( ( R::permission & defs::WRITE ) , "Register does not allow write access" );
+
+      if ( ( R::mode == defs::SINGLE ) && ( aValues.size() != 1 ) ) //We allow the user to call a bulk access of size=1 to a single register
+      {
+        exception::BulkTransferOnSingleRegister lExc;
+        log ( lExc , "Bulk Transfer requested on single register node " , Quote ( std::string ( R::path ) ) );
+        throw lExc;
+      }
+
+      if ( ( R::size != 1 ) && ( aValues.size() > R::size ) )
+      {
+        exception::BulkTransferRequestedTooLarge lExc;
+        log ( lExc , "Requested bulk write of greater size than the specified endpoint size of node ", Quote ( std::string ( R::path ) ) );
+        throw lExc;
+      }
+
+      const uint32_t lAddr ( R::address );
+      const defs::BlockReadWriteMode lMode ( R::mode );
+      return aClient.writeBlock ( lAddr , aValues , lMode );
+    }
+
+
+    template< typename R >
+    bool matches ( const Node& aTop )
+    {
+      try
+      {
+        const Node& lNode ( aTop.getNode ( R::path ) );
+        return ( lNode.getAddress() == R::address ) and ( lNode.getMask() == R::mask ) and ( lNode.getPermission() == R::permission ) and ( lNode.getMode() == R::mode ) and ( lNode.getSize() == R::size );
+      }
+      catch ( const exception::NoBranchFoundWithGivenUID& aExc )
+      {
+        return false;
+      }
+    }
+  }
+}
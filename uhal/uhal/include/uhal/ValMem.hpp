@@ -74,6 +74,71 @@ namespace uhal
   template< typename T > class ValVector;
 
 
+  // Forward declaration so we can define friends
+  template< typename T > class ValMemPoolAllocator;
+
+
+  /**
+    Storage for the IPbus headers of the transactions that returned a ValHeader, ValWord or ValVector
+    Single-word transactions (and small block transactions) only have one header, which is stored inline; any further headers
+    are stored in a deque. The addresses of stored headers never change, since the reply buffers hold pointers to them.
+  */
+  class IPbusHeaderStore
+  {
+    public:
+      IPbusHeaderStore();
+
+      /**
+        Append a header
+        @param aHeader the header to append
+      */
+      void push_back ( const uint32_t& aHeader );
+
+      /**
+        Return the most recently appended header
+        @return a reference to the most recently appended header
+      */
+      uint32_t& back();
+
+      /**
+        Return a header
+        @param aIndex the index of the header
+        @return a reference to the header
+      */
+      uint32_t& operator[] ( std::size_t aIndex );
+
+      /**
+        Return a header
+        @param aIndex the index of the header
+        @return a const reference to the header
+      */
+      const uint32_t& operator[] ( std::size_t aIndex ) const;
+
+      /**
+        Return the number of headers
+        @return the number of headers
+      */
+      std::size_t size() const;
+
+      //! Return whether any headers have been stored
+      bool empty() const;
+
+      //! Remove all headers
+      void clear();
+
+    private:
+      //! Number of headers stored inline
+      static const std::size_t kInlineSize = 2;
+
+      //! Inline storage for the first headers
+      uint32_t mInline[kInlineSize];
+      //! Number of headers stored
+      std::size_t mSize;
+      //! Storage for the headers beyond the inline ones
+      std::deque<uint32_t> mOverflow;
+  };
+
+
   //! A helper struct wrapping an IPbus header and a valid flag
   struct _ValHeader_
   {
@@ -81,11 +146,13 @@ namespace uhal
       //! A flag for marking whether the data is actually valid
       bool valid;
       //! The IPbus header associated with the transaction that returned this data
-      std::deque<uint32_t> IPbusHeaders;
+      IPbusHeaderStore IPbusHeaders;
 
     protected:
       //! Make ValHeader a friend since it is the only class that should be able to create an instance this struct
       friend class ValHeader;
+      //! Make the pool allocator a friend, so that the client can allocate this struct from its pool
+      template< typename U > friend class ValMemPoolAllocator;
       /**
         Constructor
         Private, since this struct should only be used by the ValHeader
@@ -109,6 +176,8 @@ namespace uhal
     protected:
       //! Make ValWord a friend since it is the only class that should be able to create an instance this struct
       friend class ValWord<T>;
+      //! Make the pool allocator a friend, so that the client can allocate this struct from its pool
+      template< typename U > friend class ValMemPoolAllocator;
       /**
         Constructor
         Private, since this struct should only be used by the ValWord
@@ -131,6 +200,8 @@ namespace uhal
     protected:
       //! Make ValVector a friend since it is the only class that should be able to create an instance this struct
       friend class ValVector<T>;
+      //! Make the pool allocator a friend, so that the client can allocate this struct from its pool
+      template< typename U > friend class ValMemPoolAllocator;
       /**
         Constructor
         Private, since this struct should only be used by the ValVector
@@ -178,6 +249,12 @@ namespace uhal
       void valid ( bool aValid );
 
     protected:
+      /**
+        Constructor from existing underlying memory, used by the client to wrap memory allocated from its pool
+        @param aMembers the underlying memory
+      */
+      explicit ValHeader ( const std::shared_ptr< _ValHeader_ >& aMembers );
+
       //! A shared pointer to a _ValWord_ struct, so that every copy of this ValWord points to the same underlying memory
       std::shared_ptr< _ValHeader_ > mMembers;
   };
@@ -261,6 +338,12 @@ namespace uhal
       void mask ( const uint32_t& aMask );
 
     private:
+      /**
+        Constructor from existing underlying memory, used by the client to wrap memory allocated from its pool
+        @param aMembers the underlying memory
+      */
+      explicit ValWord ( const std::shared_ptr< _ValWord_<T> >& aMembers );
+
       //! A shared pointer to a _ValWord_ struct, so that every copy of this ValWord points to the same underlying memory
       std::shared_ptr< _ValWord_<T> > mMembers;
 
@@ -394,6 +477,12 @@ namespace uhal
       void value ( const std::vector<T>& aValue );
 
     private:
+      /**
+        Constructor from existing underlying memory, used by the client to wrap memory allocated from its pool
+        @param aMembers the underlying memory
+      */
+      explicit ValVector ( const std::shared_ptr< _ValVector_<T> >& aMembers );
+
       //! A shared pointer to a _ValVector_ struct, so that every copy of this ValVector points to the same underlying memory
       std::shared_ptr< _ValVector_<T> > mMembers;
 
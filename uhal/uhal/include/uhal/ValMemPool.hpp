@@ -0,0 +1,173 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+---------------------------------------------------------------------------
+*/
+
+
+/**
+	@file
+*/
+
+#ifndef _uhal_ValMemPool_hpp_
+#define _uhal_ValMemPool_hpp_
+
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+
+namespace uhal
+{
+
+  /**
+    Thread-safe pool of small, fixed-size memory blocks, used to allocate the shared state of the ValHeader, ValWord and
+    ValVector objects returned by a client. Freed blocks are kept in per-size free lists and reused by later transactions,
+    so that a long sequence of single-word reads and writes does not hit the general-purpose heap for each transaction.
+    Memory is returned to the heap when the pool is destroyed, i.e. once the client and all of its outstanding
+    ValHeader/ValWord/ValVector objects have been destroyed.
+  */
+  class ValMemPool
+  {
+    public:
+      ValMemPool();
+
+      ValMemPool(const ValMemPool&) = delete;
+      ValMemPool& operator=(const ValMemPool&) = delete;
+
+      //! Destructor; returns all blocks to the heap
+      ~ValMemPool();
+
+      /**
+        Allocate a block of memory
+        @param aSize the size of the block, in bytes; blocks larger than the largest size class are allocated from the heap
+        @return a pointer to the block
+      */
+      void* allocate ( std::size_t aSize );
+
+      /**
+        Return a block of memory to the pool
+        @param aPtr a pointer to the block, as returned by allocate
+        @param aSize the size of the block, in bytes; must be the same as the size passed to allocate
+      */
+      void deallocate ( void* aPtr , std::size_t aSize );
+
+    private:
+      //! Header written into each free block, linking it to the next free block of the same size class
+      struct FreeBlock
+      {
+        FreeBlock* next;
+      };
+
+      //! Granularity (and alignment) of the block sizes
+      static const std::size_t kGranularity = 16;
+      //! Number of size classes; blocks larger than kGranularity * kNrSizeClasses bytes are not pooled
+      static const std::size_t kNrSizeClasses = 16;
+      //! Number of blocks allocated from the heap at a time when a free list is empty
+      static const std::size_t kBlocksPerChunk = 64;
+
+      //! Mutex protecting the free lists; blocks can be returned to the pool from any thread
+      std::mutex mMutex;
+
+      //! Head of the free list for each size class
+      FreeBlock* mFreeLists[kNrSizeClasses];
+
+      //! The chunks of memory that the blocks have been carved from
+      std::vector< void* > mChunks;
+  };
+
+
+  /**
+    Minimal C++11 allocator drawing from a ValMemPool, for use with std::allocate_shared
+    Each copy holds a shared pointer to the pool, so the pool outlives any control block allocated from it
+  */
+  template< typename T >
+  class ValMemPoolAllocator
+  {
+    public:
+      typedef T value_type;
+
+      /**
+        Constructor
+        @param aPool the pool to allocate memory from
+      */
+      explicit ValMemPoolAllocator ( const std::shared_ptr< ValMemPool >& aPool ) :
+        mPool ( aPool )
+      {
+      }
+
+      //! Rebinding constructor
+      template< typename U >
+      ValMemPoolAllocator ( const ValMemPoolAllocator< U >& aOther ) :
+        mPool ( aOther.mPool )
+      {
+      }
+
+      T* allocate ( std::size_t aN )
+      {
+        return static_cast< T* > ( mPool->allocate ( aN * sizeof ( T ) ) );
+      }
+
+      void deallocate ( T* aPtr , std::size_t aN )
+      {
+        mPool->deallocate ( aPtr , aN * sizeof ( T ) );
+      }
+
+      //! Construct in place; defined explicitly so that classes with non-public constructors can befriend the allocator
+      template< typename U , typename... Args >
+      void construct ( U* aPtr , Args&&... aArgs )
+      {
+        ::new ( static_cast< void* > ( aPtr ) ) U ( std::forward< Args > ( aArgs )... );
+      }
+
+      template< typename U >
+      void destroy ( U* aPtr )
+      {
+        aPtr->~U();
+      }
+
+      template< typename U >
+      bool operator== ( const ValMemPoolAllocator< U >& aOther ) const
+      {
+        return mPool == aOther.mPool;
+      }
+
+      template< typename U >
+      bool operator!= ( const ValMemPoolAllocator< U >& aOther ) const
+      {
+        return mPool != aOther.mPool;
+      }
+
+    private:
+      template< typename U > friend class ValMemPoolAllocator;
+
+      //! The pool that memory is allocated from
+      std::shared_ptr< ValMemPool > mPool;
+  };
+
+}
+
+#endif
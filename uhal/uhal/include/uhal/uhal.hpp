@@ -39,5 +39,6 @@
 #include "uhal/definitions.hpp"
 #include "uhal/ValMem.hpp"
 #include "uhal/ConnectionManager.hpp"
+#include "uhal/DispatchGroup.hpp"
 #include "uhal/HwInterface.hpp"
 #include "uhal/Node.hpp"
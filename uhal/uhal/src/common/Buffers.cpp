@@ -42,7 +42,8 @@ namespace uhal
   Buffers::Buffers ( const uint32_t& aMaxSendSize ) :
     mSendCounter ( 0 ),
     mReplyCounter ( 0 ),
-    mSendBuffer ( aMaxSendSize , 0x00 )
+    mSendBuffer ( aMaxSendSize , 0x00 ),
+    mSendReferencesCopied ( true )
   {
   }
 
@@ -72,6 +73,22 @@ namespace uhal
   }
 
 
+  void Buffers::sendByReference ( const uint8_t* aPtr , const uint32_t& aSize )
+  {
+    // Gather lists are limited in length (e.g. 64 buffers for a single ASIO send), so only large blocks are referenced
+    if ( ( aSize < 256 ) || ( mSendReferences.size() >= 8 ) )
+    {
+      send ( aPtr , aSize );
+      return;
+    }
+
+    SendReference lReference = { mSendCounter , aPtr , aSize };
+    mSendReferences.push_back ( lReference );
+    mSendReferencesCopied = false;
+    mSendCounter += aSize;
+  }
+
+
   void Buffers::receive ( uint8_t* aPtr , const uint32_t& aSize )
   {
     mReplyBuffer.push_back ( std::make_pair ( aPtr , aSize ) );
@@ -93,11 +110,49 @@ namespace uhal
     mUnsignedValVectors.push_back ( aValMem );
   }
 
+  void Buffers::add ( const std::shared_ptr< const std::vector< uint32_t > >& aSource )
+  {
+    mSendSources.push_back ( aSource );
+  }
+
   uint8_t* Buffers::getSendBuffer()
   {
+    if ( !mSendReferencesCopied )
+    {
+      for (const auto& lReference: mSendReferences)
+        memcpy ( &mSendBuffer[0] + lReference.offset , lReference.ptr , lReference.size );
+
+      mSendReferencesCopied = true;
+    }
+
     return &mSendBuffer[0];
   }
 
+  uint8_t* Buffers::getSendBufferHeaders()
+  {
+    return &mSendBuffer[0];
+  }
+
+  const std::vector< std::pair< const uint8_t* , size_t > >& Buffers::getSendSegments()
+  {
+    mSendSegments.clear();
+    uint32_t lOffset ( 0 );
+
+    for (const auto& lReference: mSendReferences)
+    {
+      if ( lReference.offset > lOffset )
+        mSendSegments.push_back ( std::make_pair ( &mSendBuffer[0] + lOffset , lReference.offset - lOffset ) );
+
+      mSendSegments.push_back ( std::make_pair ( lReference.ptr , lReference.size ) );
+      lOffset = lReference.offset + lReference.size;
+    }
+
+    if ( ( mSendCounter > lOffset ) || mSendSegments.empty() )
+      mSendSegments.push_back ( std::make_pair ( &mSendBuffer[0] + lOffset , mSendCounter - lOffset ) );
+
+    return mSendSegments;
+  }
+
   std::deque< std::pair< uint8_t* , uint32_t > >& Buffers::getReplyBuffer()
   {
     return mReplyBuffer;
@@ -122,11 +177,26 @@ namespace uhal
     mSendCounter = 0 ;
     mReplyCounter = 0 ;
     mReplyBuffer.clear();
+    mSendReferences.clear();
+    mSendReferencesCopied = true;
+    mSendSources.clear();
     mValHeaders.clear();
     mUnsignedValWords.clear();
     mUnsignedValVectors.clear();
   }
 
+
+  void Buffers::setDispatchTime()
+  {
+    mDispatchTime = std::chrono::steady_clock::now();
+  }
+
+
+  const std::chrono::steady_clock::time_point& Buffers::getDispatchTime() const
+  {
+    return mDispatchTime;
+  }
+
 }
 
 
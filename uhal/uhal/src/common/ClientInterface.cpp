@@ -33,13 +33,18 @@
 #include "uhal/ClientInterface.hpp"
 
 
+#include <chrono>
+#include <future>
 #include <memory>
 #include <mutex>
+#include <ostream>
 #include <sstream>
 
 #include "uhal/Buffers.hpp"
+#include "uhal/IOServicePool.hpp"
 #include "uhal/log/LogLevels.hpp"                              // for BaseLo...
 #include "uhal/log/log_inserters.integer.hpp"                  // for Integer
+#include "uhal/log/log_inserters.quote.hpp"                    // for Quote
 #include "uhal/log/log.hpp"
 #include "uhal/utilities/bits.hpp"
 
@@ -47,6 +52,35 @@
 namespace uhal
 {
 
+  namespace
+  {
+    //! Escape the characters which have a special meaning within the label values of the Prometheus text exposition format
+    std::string escapeLabelValue ( const std::string& aValue )
+    {
+      std::string lEscaped;
+
+      for ( const char lChar : aValue )
+      {
+        if ( ( lChar == '\\' ) or ( lChar == '"' ) )
+        {
+          lEscaped += '\\';
+          lEscaped += lChar;
+        }
+        else if ( lChar == '\n' )
+        {
+          lEscaped += "\\n";
+        }
+        else
+        {
+          lEscaped += lChar;
+        }
+      }
+
+      return lEscaped;
+    }
+  }
+
+
   ClientInterface::ClientInterface ( const std::string& aId, const URI& aUri,  const boost::posix_time::time_duration& aTimeoutPeriod ) :
     mBuffers(),
 #ifdef NO_PREEMPTIVE_DISPATCH
@@ -55,8 +89,14 @@ namespace uhal
     mId ( aId ),
     mTimeoutPeriod ( aTimeoutPeriod ),
     mUri ( aUri ),
-    mUriString( toString(aUri) )
+    mUriString( toString(aUri) ),
+    mValMemPool ( std::make_shared< ValMemPool >() ),
+    mPacketsTransmitted ( 0 ),
+    mPacketsValidated ( 0 ),
+    mAsyncCompletionPosted ( false ),
+    mAsyncDispatchOwner ( std::make_shared< AsyncDispatchOwner >() )
   {
+    mAsyncDispatchOwner->mClient = this;
   }
 
 
@@ -68,8 +108,14 @@ namespace uhal
     mId ( ),
     mTimeoutPeriod ( boost::posix_time::pos_infin ),
     mUri ( ),
-    mUriString( "" )
+    mUriString( "" ),
+    mValMemPool ( std::make_shared< ValMemPool >() ),
+    mPacketsTransmitted ( 0 ),
+    mPacketsValidated ( 0 ),
+    mAsyncCompletionPosted ( false ),
+    mAsyncDispatchOwner ( std::make_shared< AsyncDispatchOwner >() )
   {
+    mAsyncDispatchOwner->mClient = this;
   }
 
 
@@ -81,8 +127,14 @@ namespace uhal
     mId ( aClientInterface.mId ),
     mTimeoutPeriod ( aClientInterface.mTimeoutPeriod ),
     mUri ( aClientInterface.mUri ),
-    mUriString( aClientInterface.mUriString )
+    mUriString( aClientInterface.mUriString ),
+    mValMemPool ( std::make_shared< ValMemPool >() ),
+    mPacketsTransmitted ( 0 ),
+    mPacketsValidated ( 0 ),
+    mAsyncCompletionPosted ( false ),
+    mAsyncDispatchOwner ( std::make_shared< AsyncDispatchOwner >() )
   {
+    mAsyncDispatchOwner->mClient = this;
   }
 
 
@@ -99,6 +151,7 @@ namespace uhal
 
   ClientInterface::~ClientInterface()
   {
+    detachAsyncDispatches();
     deleteBuffers();
   }
 
@@ -143,40 +196,321 @@ namespace uhal
   void ClientInterface::dispatch ()
   {
     std::lock_guard<std::mutex> lLock ( mUserSideMutex );
+    const std::chrono::steady_clock::time_point lStart ( std::chrono::steady_clock::now() );
 
     try
     {
-#ifdef NO_PREEMPTIVE_DISPATCH
-      log ( Info() , "mNoPreemptiveDispatchBuffers.size() = " , Integer ( mNoPreemptiveDispatchBuffers.size() ) );
+      if ( this->sendQueuedBuffers() )
+      {
+        this->Flush();
+        mMetrics.dispatchCompleted ( std::chrono::steady_clock::now() - lStart );
+        // Flush also waited for the replies to any batches sent by dispatchAsync
+        this->deliverAsyncDispatches ( std::exception_ptr() );
+      }
+    }
+    catch ( ... )
+    {
+      this->recordDispatchException();
+      // Any batches sent by dispatchAsync are discarded by the exception handler too, so they fail with the same exception
+      this->deliverAsyncDispatches ( std::current_exception() );
+      this->dispatchExceptionHandler();
+      throw;
+    }
+  }
 
-      for (auto& lBuffer: mNoPreemptiveDispatchBuffers)
+
+  std::future<void> ClientInterface::dispatchAsync ()
+  {
+    std::lock_guard<std::mutex> lLock ( mUserSideMutex );
+    std::future<void> lFuture;
+
+    {
+      // Register the batch before sending it, so that the transport's thread cannot report the replies before the batch is known
+      std::lock_guard<std::mutex> lAsyncLock ( mAsyncDispatchMutex );
+      mAsyncDispatches.push_back ( AsyncDispatch() );
+      mAsyncDispatches.back().mStart = std::chrono::steady_clock::now();
+      lFuture = mAsyncDispatches.back().mPromise.get_future();
+    }
+
+    try
+    {
+      if ( ! this->sendQueuedBuffers() )
+      {
+        std::lock_guard<std::mutex> lAsyncLock ( mAsyncDispatchMutex );
+        mAsyncDispatches.back().mPromise.set_value();
+        mAsyncDispatches.pop_back();
+      }
+      else
       {
-        this->predispatch ( lBuffer );
-        this->implementDispatch ( lBuffer ); //responsibility for lBuffer passed to the implementDispatch function
-        lBuffer.reset();
+        {
+          std::lock_guard<std::mutex> lAsyncLock ( mAsyncDispatchMutex );
+          mAsyncDispatches.back().mLastPacket = mPacketsTransmitted;
+        }
+
+        if ( ! this->beginFlush() )
+        {
+          // The transport only receives replies in the thread calling Flush, so collect them now
+          this->completeAsyncDispatches();
+        }
       }
+    }
+    catch ( ... )
+    {
+      this->recordDispatchException();
+      this->deliverAsyncDispatches ( std::current_exception() );
+      this->dispatchExceptionHandler();
+    }
+
+    return lFuture;
+  }
+
+
+  void ClientInterface::completeAsyncDispatches ()
+  {
+    {
+      std::lock_guard<std::mutex> lAsyncLock ( mAsyncDispatchMutex );
+      mAsyncCompletionPosted = false;
 
+      if ( mAsyncDispatches.empty() )
       {
-        std::lock_guard<std::mutex> lLock ( mBufferMutex );
-        mNoPreemptiveDispatchBuffers.clear();
+        return;
       }
+    }
 
+    try
+    {
       this->Flush();
-#endif
+    }
+    catch ( ... )
+    {
+      this->recordDispatchException();
+      this->deliverAsyncDispatches ( std::current_exception() );
+      this->dispatchExceptionHandler();
+      return;
+    }
+
+    this->deliverAsyncDispatches ( std::exception_ptr() );
+  }
+
 
-      if ( mCurrentBuffers )
+  void ClientInterface::completeAnsweredAsyncDispatches ()
+  {
+    std::deque< AsyncDispatch > lAnswered;
+    bool lAllAnswered ( false );
+    {
+      std::lock_guard<std::mutex> lAsyncLock ( mAsyncDispatchMutex );
+      mAsyncCompletionPosted = false;
+
+      if ( mAsyncDispatches.empty() )
       {
-        this->predispatch ( mCurrentBuffers );
-        this->implementDispatch ( mCurrentBuffers ); //responsibility for mCurrentBuffers passed to the implementDispatch function
-        mCurrentBuffers.reset();
-        this->Flush();
+        return;
       }
+
+      const uint64_t lPacketsValidated ( mPacketsValidated );
+
+      while ( ( ! mAsyncDispatches.empty() ) and ( mAsyncDispatches.front().mLastPacket <= lPacketsValidated ) )
+      {
+        lAnswered.push_back ( std::move ( mAsyncDispatches.front() ) );
+        mAsyncDispatches.pop_front();
+      }
+
+      lAllAnswered = ( lPacketsValidated == mPacketsTransmitted );
+    }
+
+    const std::chrono::steady_clock::time_point lNow ( std::chrono::steady_clock::now() );
+
+    for ( AsyncDispatch& lDispatch : lAnswered )
+    {
+      mMetrics.dispatchCompleted ( lNow - lDispatch.mStart );
+      lDispatch.mPromise.set_value();
+    }
+
+    // Batches sent after the transport reported its replies are left for the next report, unless the transport has failed meanwhile.
+    // Flush is only called once it has nothing left to wait for, so that the transport can finish off the dispatch (e.g. release the
+    // PCIe device lock) or rethrow its error
+    if ( ( ! lAllAnswered ) and ( ! this->asynchronousExceptionPending() ) )
+    {
+      return;
+    }
+
+    try
+    {
+      this->Flush();
     }
     catch ( ... )
     {
+      this->recordDispatchException();
+      this->deliverAsyncDispatches ( std::current_exception() );
       this->dispatchExceptionHandler();
+    }
+  }
+
+
+  void ClientInterface::deliverAsyncDispatches ( const std::exception_ptr& aException )
+  {
+    std::deque< AsyncDispatch > lDispatches;
+    {
+      std::lock_guard<std::mutex> lAsyncLock ( mAsyncDispatchMutex );
+      lDispatches.swap ( mAsyncDispatches );
+    }
+
+    const std::chrono::steady_clock::time_point lNow ( std::chrono::steady_clock::now() );
+
+    for ( AsyncDispatch& lDispatch : lDispatches )
+    {
+      if ( aException )
+      {
+        lDispatch.mPromise.set_exception ( aException );
+      }
+      else
+      {
+        mMetrics.dispatchCompleted ( lNow - lDispatch.mStart );
+        lDispatch.mPromise.set_value();
+      }
+    }
+  }
+
+
+  void ClientInterface::repliesReceived ()
+  {
+    {
+      std::lock_guard<std::mutex> lAsyncLock ( mAsyncDispatchMutex );
+
+      if ( mAsyncDispatches.empty() or mAsyncCompletionPosted )
+      {
+        return;
+      }
+
+      mAsyncCompletionPosted = true;
+    }
+
+    // Called from the transport's thread, which must not block on the user-side mutex, so the futures are completed in the completion thread
+    std::shared_ptr< AsyncDispatchOwner > lOwner ( mAsyncDispatchOwner );
+    IOServicePool::getInstance().post ( [lOwner] () { completeAsyncDispatches ( lOwner ); } );
+  }
+
+
+  void ClientInterface::completeAsyncDispatches ( const std::shared_ptr< AsyncDispatchOwner >& aOwner )
+  {
+    std::lock_guard<std::mutex> lOwnerLock ( aOwner->mMutex );
+    ClientInterface* lClient ( aOwner->mClient );
+
+    if ( ! lClient )
+    {
+      return;
+    }
+
+    // The completion thread is shared by all clients, so it must not wait while another thread holds the user-side mutex (e.g.
+    // for a synchronous dispatch); instead, try again a little later, so that the futures of other clients are completed meanwhile
+    std::unique_lock<std::mutex> lLock ( lClient->mUserSideMutex , std::try_to_lock );
+
+    if ( ! lLock.owns_lock() )
+    {
+      std::shared_ptr< AsyncDispatchOwner > lOwner ( aOwner );
+      IOServicePool::getInstance().post ( [lOwner] () { completeAsyncDispatches ( lOwner ); } , boost::posix_time::microseconds ( 100 ) );
+      return;
+    }
+
+    try
+    {
+      lClient->completeAnsweredAsyncDispatches();
+    }
+    catch ( const std::exception& aExc )
+    {
+      log ( Error() , "Exception " , Quote ( aExc.what() ) , " caught while completing asynchronous dispatch for client " , Quote ( lClient->id() ) );
+    }
+  }
+
+
+  void ClientInterface::detachAsyncDispatches ()
+  {
+    // Wait for any completion task which is using this client, and stop later ones from doing so
+    std::lock_guard<std::mutex> lLock ( mAsyncDispatchOwner->mMutex );
+    mAsyncDispatchOwner->mClient = NULL;
+  }
+
+
+  bool ClientInterface::sendQueuedBuffers ()
+  {
+    bool lSent ( false );
+#ifdef NO_PREEMPTIVE_DISPATCH
+    log ( Info() , "mNoPreemptiveDispatchBuffers.size() = " , Integer ( mNoPreemptiveDispatchBuffers.size() ) );
+
+    for (auto& lBuffer: mNoPreemptiveDispatchBuffers)
+    {
+      this->transmit ( lBuffer );
+      lSent = true;
+    }
+
+    {
+      std::lock_guard<std::mutex> lLock ( mBufferMutex );
+      mNoPreemptiveDispatchBuffers.clear();
+    }
+#endif
+
+    if ( mCurrentBuffers )
+    {
+      this->transmit ( mCurrentBuffers );
+      lSent = true;
+    }
+
+    return lSent;
+  }
+
+
+  void ClientInterface::transmit ( std::shared_ptr< Buffers >& aBuffers )
+  {
+    this->predispatch ( aBuffers );
+    aBuffers->setDispatchTime();
+    mMetrics.packetSent ( aBuffers->sendCounter() );
+    ++mPacketsTransmitted;
+    this->implementDispatch ( aBuffers ); //responsibility for aBuffers passed to the implementDispatch function
+    aBuffers.reset();
+  }
+
+
+  void ClientInterface::recordDispatchException()
+  {
+    try
+    {
       throw;
     }
+    catch ( const exception::ClientTimeout& aExc )
+    {
+      mMetrics.timeout();
+    }
+    catch ( ... )
+    {
+      mMetrics.error();
+    }
+
+    // The buffers in flight are deleted by the exception handler, so will never be answered
+    mMetrics.packetsDiscarded();
+    mPacketsValidated = mPacketsTransmitted;
+  }
+
+
+  const ClientMetrics& ClientInterface::getMetrics() const
+  {
+    return mMetrics;
+  }
+
+
+  void ClientInterface::resetMetrics()
+  {
+    mMetrics.reset();
+  }
+
+
+  void ClientInterface::streamMetrics ( std::ostream& aStream ) const
+  {
+    mMetrics.stream ( aStream , "id=\"" + escapeLabelValue ( mId ) + "\",uri=\"" + escapeLabelValue ( mUriString ) + "\"" );
+  }
+
+
+  ClientMetrics& ClientInterface::metrics()
+  {
+    return mMetrics;
   }
 
 
@@ -184,17 +518,31 @@ namespace uhal
   {}
 
 
+  bool ClientInterface::beginFlush ()
+  {
+    return false;
+  }
+
+
+  bool ClientInterface::asynchronousExceptionPending ()
+  {
+    return false;
+  }
+
+
   exception::exception* ClientInterface::validate ( std::shared_ptr< Buffers > aBuffers )
   {
-    exception::exception* lRet = this->validate ( aBuffers->getSendBuffer() ,
-                                 aBuffers->getSendBuffer() + aBuffers->sendCounter() ,
+    exception::exception* lRet = this->validate ( aBuffers->getSendBufferHeaders() ,
+                                 aBuffers->getSendBufferHeaders() + aBuffers->sendCounter() ,
                                  aBuffers->getReplyBuffer().begin() ,
                                  aBuffers->getReplyBuffer().end() );
+    mMetrics.packetReceived ( aBuffers->replyCounter() , std::chrono::steady_clock::now() - aBuffers->getDispatchTime() );
 
     //results are valid, so mark returned data as valid
     if ( !lRet )
     {
       aBuffers->validate ();
+      ++mPacketsValidated;
     }
 
     returnBufferToPool ( aBuffers );
@@ -307,12 +655,11 @@ namespace uhal
 
     try
     {
-      this->predispatch ( mCurrentBuffers );
-      this->implementDispatch ( mCurrentBuffers );
-      mCurrentBuffers.reset();
+      this->transmit ( mCurrentBuffers );
     }
     catch ( ... )
     {
+      this->recordDispatchException();
       this->dispatchExceptionHandler();
       throw;
     }
@@ -385,21 +732,21 @@ namespace uhal
 
   std::pair < ValHeader , _ValHeader_* > ClientInterface::CreateValHeader()
   {
-    ValHeader lReply;
+    ValHeader lReply ( std::allocate_shared< _ValHeader_ > ( ValMemPoolAllocator< _ValHeader_ > ( mValMemPool ) , false ) );
     return std::make_pair ( lReply , & ( * ( lReply.mMembers ) ) );
   }
 
 
   std::pair < ValWord<uint32_t> , _ValWord_<uint32_t>* > ClientInterface::CreateValWord ( const uint32_t& aValue , const uint32_t& aMask )
   {
-    ValWord<uint32_t> lReply ( aValue , aMask );
+    ValWord<uint32_t> lReply ( std::allocate_shared< _ValWord_<uint32_t> > ( ValMemPoolAllocator< _ValWord_<uint32_t> > ( mValMemPool ) , aValue , false , aMask ) );
     return std::make_pair ( lReply , & ( * ( lReply.mMembers ) ) );
   }
 
 
   std::pair < ValVector<uint32_t> , _ValVector_<uint32_t>* > ClientInterface::CreateValVector ( const uint32_t& aSize )
   {
-    ValVector<uint32_t> lReply ( aSize );
+    ValVector<uint32_t> lReply ( std::allocate_shared< _ValVector_<uint32_t> > ( ValMemPoolAllocator< _ValVector_<uint32_t> > ( mValMemPool ) , std::vector<uint32_t> ( aSize , 0 ) , false ) );
     return std::make_pair ( lReply , & ( * ( lReply.mMembers ) ) );
   }
 
@@ -446,6 +793,19 @@ namespace uhal
     std::lock_guard<std::mutex> lLock ( mUserSideMutex );
     return implementWriteBlock ( aAddr, aSource, aMode );
   }
+
+
+  ValHeader ClientInterface::writeBlock ( const uint32_t& aAddr, std::vector< uint32_t >&& aSource, const defs::BlockReadWriteMode& aMode )
+  {
+    std::lock_guard<std::mutex> lLock ( mUserSideMutex );
+    return implementWriteBlockByReference ( aAddr, std::make_shared< const std::vector< uint32_t > > ( std::move ( aSource ) ), aMode );
+  }
+
+
+  ValHeader ClientInterface::implementWriteBlockByReference ( const uint32_t& aAddr, const std::shared_ptr< const std::vector< uint32_t > >& aSource, const defs::BlockReadWriteMode& aMode )
+  {
+    return implementWriteBlock ( aAddr, *aSource, aMode );
+  }
   //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 
@@ -469,6 +829,21 @@ namespace uhal
     std::lock_guard<std::mutex> lLock ( mUserSideMutex );
     return implementReadBlock ( aAddr, aSize, aMode );
   }
+
+
+  ValHeader ClientInterface::readBlock ( const uint32_t& aAddr, uint32_t* aBuffer, const uint32_t& aSize, const defs::BlockReadWriteMode& aMode )
+  {
+    std::lock_guard<std::mutex> lLock ( mUserSideMutex );
+    return implementReadBlockIntoBuffer ( aAddr, aBuffer, aSize, aMode );
+  }
+
+
+  ValHeader ClientInterface::implementReadBlockIntoBuffer ( const uint32_t& , uint32_t* , const uint32_t& , const defs::BlockReadWriteMode& )
+  {
+    exception::ReadBlockIntoBufferNotSupported lExc;
+    log ( lExc , "Client " , Quote ( id() ) , " (URI: " , Quote ( uri() ) , ") does not support reading a block into user-provided memory" );
+    throw lExc;
+  }
   //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 
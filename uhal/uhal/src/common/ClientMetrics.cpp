@@ -0,0 +1,357 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/ClientMetrics.hpp"
+
+
+#include <ostream>
+
+
+namespace uhal
+{
+
+  namespace
+  {
+    uint64_t toMicroseconds ( const std::chrono::steady_clock::duration& aDuration )
+    {
+      const int64_t lCount ( std::chrono::duration_cast< std::chrono::microseconds > ( aDuration ).count() );
+      return ( lCount > 0 ) ? lCount : 0;
+    }
+
+    void streamCounter ( std::ostream& aStream , const std::string& aName , const std::string& aLabels , const uint64_t aValue )
+    {
+      aStream << "uhal_client_" << aName << "{" << aLabels << "} " << aValue << "\n";
+    }
+
+    void streamHistogram ( std::ostream& aStream , const std::string& aName , const std::string& aLabels , const Histogram& aHistogram )
+    {
+      static const char* lQuantileLabels[] = { "0.5" , "0.9" , "0.99" , "0.999" };
+      static const double lQuantiles[] = { 0.5 , 0.9 , 0.99 , 0.999 };
+      const std::string lSeparator ( aLabels.empty() ? "" : "," );
+
+      for ( size_t i = 0; i != sizeof ( lQuantiles ) / sizeof ( lQuantiles[0] ); i++ )
+      {
+        aStream << "uhal_client_" << aName << "{" << aLabels << lSeparator << "quantile=\"" << lQuantileLabels[i] << "\"} " << aHistogram.quantile ( lQuantiles[i] ) << "\n";
+      }
+
+      streamCounter ( aStream , aName + "_max" , aLabels , aHistogram.max() );
+      streamCounter ( aStream , aName + "_sum" , aLabels , aHistogram.sum() );
+      streamCounter ( aStream , aName + "_count" , aLabels , aHistogram.count() );
+    }
+  }
+
+
+  Histogram::Histogram() :
+    mCount ( 0 ),
+    mSum ( 0 ),
+    mMax ( 0 )
+  {
+    for ( uint32_t i = 0; i != kNrBuckets; i++ )
+    {
+      mBuckets[i] = 0;
+    }
+  }
+
+
+  void Histogram::record ( const uint64_t aValue )
+  {
+    mBuckets[bucket ( aValue )].fetch_add ( 1 , std::memory_order_relaxed );
+    mCount.fetch_add ( 1 , std::memory_order_relaxed );
+    mSum.fetch_add ( aValue , std::memory_order_relaxed );
+
+    uint64_t lMax ( mMax.load ( std::memory_order_relaxed ) );
+
+    while ( ( aValue > lMax ) && !mMax.compare_exchange_weak ( lMax , aValue , std::memory_order_relaxed ) )
+    {}
+  }
+
+
+  void Histogram::reset()
+  {
+    for ( uint32_t i = 0; i != kNrBuckets; i++ )
+    {
+      mBuckets[i].store ( 0 , std::memory_order_relaxed );
+    }
+
+    mCount.store ( 0 , std::memory_order_relaxed );
+    mSum.store ( 0 , std::memory_order_relaxed );
+    mMax.store ( 0 , std::memory_order_relaxed );
+  }
+
+
+  uint64_t Histogram::count() const
+  {
+    return mCount.load ( std::memory_order_relaxed );
+  }
+
+
+  uint64_t Histogram::sum() const
+  {
+    return mSum.load ( std::memory_order_relaxed );
+  }
+
+
+  uint64_t Histogram::max() const
+  {
+    return mMax.load ( std::memory_order_relaxed );
+  }
+
+
+  uint64_t Histogram::quantile ( const double aQuantile ) const
+  {
+    // Sum the buckets, rather than using mCount, since values may be recorded concurrently
+    uint64_t lCounts[kNrBuckets];
+    uint64_t lTotal ( 0 );
+
+    for ( uint32_t i = 0; i != kNrBuckets; i++ )
+    {
+      lCounts[i] = mBuckets[i].load ( std::memory_order_relaxed );
+      lTotal += lCounts[i];
+    }
+
+    if ( lTotal == 0 )
+    {
+      return 0;
+    }
+
+    const double lQuantile ( ( aQuantile < 0 ) ? 0 : ( aQuantile > 1 ) ? 1 : aQuantile );
+    const uint64_t lRank ( ( lQuantile * lTotal < 1 ) ? 1 : uint64_t ( lQuantile * lTotal + 0.5 ) );
+    uint64_t lSeen ( 0 );
+
+    for ( uint32_t i = 0; i != kNrBuckets; i++ )
+    {
+      lSeen += lCounts[i];
+
+      if ( lSeen >= lRank )
+      {
+        const uint64_t lUpperBound ( bucketUpperBound ( i ) );
+        const uint64_t lMax ( max() );
+        return ( lUpperBound < lMax ) ? lUpperBound : lMax;
+      }
+    }
+
+    return max();
+  }
+
+
+  uint32_t Histogram::bucket ( const uint64_t aValue )
+  {
+    if ( aValue < ( uint64_t ( 1 ) << kSubBucketBits ) )
+    {
+      return aValue;
+    }
+
+    const uint32_t lExponent ( 63 - __builtin_clzll ( aValue ) );
+    const uint32_t lSubBucket ( ( aValue >> ( lExponent - kSubBucketBits ) ) & ( ( 1 << kSubBucketBits ) - 1 ) );
+    return ( ( lExponent - kSubBucketBits + 1 ) << kSubBucketBits ) + lSubBucket;
+  }
+
+
+  uint64_t Histogram::bucketUpperBound ( const uint32_t aBucket )
+  {
+    if ( aBucket < ( 1u << kSubBucketBits ) )
+    {
+      return aBucket;
+    }
+
+    const uint32_t lShift ( ( aBucket >> kSubBucketBits ) - 1 );
+    const uint64_t lLowerBound ( ( ( uint64_t ( 1 ) << kSubBucketBits ) + ( aBucket & ( ( 1 << kSubBucketBits ) - 1 ) ) ) << lShift );
+    return lLowerBound + ( ( uint64_t ( 1 ) << lShift ) - 1 );
+  }
+
+
+
+  ClientMetrics::ClientMetrics() :
+    mPacketsSent ( 0 ),
+    mPacketsReceived ( 0 ),
+    mBytesSent ( 0 ),
+    mBytesReceived ( 0 ),
+    mPacketsInFlight ( 0 ),
+    mDispatches ( 0 ),
+    mTimeouts ( 0 ),
+    mErrors ( 0 ),
+    mRetries ( 0 )
+  {
+  }
+
+
+  void ClientMetrics::packetSent ( const uint32_t aBytes )
+  {
+    mQueueDepth.record ( mPacketsInFlight.fetch_add ( 1 , std::memory_order_relaxed ) );
+    mPacketsSent.fetch_add ( 1 , std::memory_order_relaxed );
+    mBytesSent.fetch_add ( aBytes , std::memory_order_relaxed );
+  }
+
+
+  void ClientMetrics::packetReceived ( const uint32_t aBytes , const std::chrono::steady_clock::duration& aLatency )
+  {
+    // The count of packets in flight is reset when they are discarded, so must not wrap around if a late reply is then received
+    uint64_t lInFlight ( mPacketsInFlight.load ( std::memory_order_relaxed ) );
+
+    while ( ( lInFlight > 0 ) && !mPacketsInFlight.compare_exchange_weak ( lInFlight , lInFlight - 1 , std::memory_order_relaxed ) )
+    {}
+
+    mPacketLatency.record ( toMicroseconds ( aLatency ) );
+    mPacketsReceived.fetch_add ( 1 , std::memory_order_relaxed );
+    mBytesReceived.fetch_add ( aBytes , std::memory_order_relaxed );
+  }
+
+
+  void ClientMetrics::dispatchCompleted ( const std::chrono::steady_clock::duration& aLatency )
+  {
+    mDispatchLatency.record ( toMicroseconds ( aLatency ) );
+    mDispatches.fetch_add ( 1 , std::memory_order_relaxed );
+  }
+
+
+  void ClientMetrics::timeout()
+  {
+    mTimeouts.fetch_add ( 1 , std::memory_order_relaxed );
+  }
+
+
+  void ClientMetrics::error()
+  {
+    mErrors.fetch_add ( 1 , std::memory_order_relaxed );
+  }
+
+
+  void ClientMetrics::retry()
+  {
+    mRetries.fetch_add ( 1 , std::memory_order_relaxed );
+  }
+
+
+  void ClientMetrics::packetsDiscarded()
+  {
+    mPacketsInFlight.store ( 0 , std::memory_order_relaxed );
+  }
+
+
+  void ClientMetrics::reset()
+  {
+    mPacketsSent.store ( 0 , std::memory_order_relaxed );
+    mPacketsReceived.store ( 0 , std::memory_order_relaxed );
+    mBytesSent.store ( 0 , std::memory_order_relaxed );
+    mBytesReceived.store ( 0 , std::memory_order_relaxed );
+    mDispatches.store ( 0 , std::memory_order_relaxed );
+    mTimeouts.store ( 0 , std::memory_order_relaxed );
+    mErrors.store ( 0 , std::memory_order_relaxed );
+    mRetries.store ( 0 , std::memory_order_relaxed );
+    mDispatchLatency.reset();
+    mPacketLatency.reset();
+    mQueueDepth.reset();
+  }
+
+
+  uint64_t ClientMetrics::getPacketsSent() const
+  {
+    return mPacketsSent.load ( std::memory_order_relaxed );
+  }
+
+
+  uint64_t ClientMetrics::getPacketsReceived() const
+  {
+    return mPacketsReceived.load ( std::memory_order_relaxed );
+  }
+
+
+  uint64_t ClientMetrics::getBytesSent() const
+  {
+    return mBytesSent.load ( std::memory_order_relaxed );
+  }
+
+
+  uint64_t ClientMetrics::getBytesReceived() const
+  {
+    return mBytesReceived.load ( std::memory_order_relaxed );
+  }
+
+
+  uint64_t ClientMetrics::getPacketsInFlight() const
+  {
+    return mPacketsInFlight.load ( std::memory_order_relaxed );
+  }
+
+
+  uint64_t ClientMetrics::getDispatches() const
+  {
+    return mDispatches.load ( std::memory_order_relaxed );
+  }
+
+
+  uint64_t ClientMetrics::getTimeouts() const
+  {
+    return mTimeouts.load ( std::memory_order_relaxed );
+  }
+
+
+  uint64_t ClientMetrics::getErrors() const
+  {
+    return mErrors.load ( std::memory_order_relaxed );
+  }
+
+
+  uint64_t ClientMetrics::getRetries() const
+  {
+    return mRetries.load ( std::memory_order_relaxed );
+  }
+
+
+  const Histogram& ClientMetrics::getDispatchLatency() const
+  {
+    return mDispatchLatency;
+  }
+
+
+  const Histogram& ClientMetrics::getPacketLatency() const
+  {
+    return mPacketLatency;
+  }
+
+
+  const Histogram& ClientMetrics::getQueueDepth() const
+  {
+    return mQueueDepth;
+  }
+
+
+  void ClientMetrics::stream ( std::ostream& aStream , const std::string& aLabels ) const
+  {
+    streamCounter ( aStream , "packets_sent_total" , aLabels , getPacketsSent() );
+    streamCounter ( aStream , "packets_received_total" , aLabels , getPacketsReceived() );
+    streamCounter ( aStream , "bytes_sent_total" , aLabels , getBytesSent() );
+    streamCounter ( aStream , "bytes_received_total" , aLabels , getBytesReceived() );
+    streamCounter ( aStream , "packets_in_flight" , aLabels , getPacketsInFlight() );
+    streamCounter ( aStream , "dispatches_total" , aLabels , getDispatches() );
+    streamCounter ( aStream , "timeouts_total" , aLabels , getTimeouts() );
+    streamCounter ( aStream , "errors_total" , aLabels , getErrors() );
+    streamCounter ( aStream , "retries_total" , aLabels , getRetries() );
+    streamHistogram ( aStream , "dispatch_latency_us" , aLabels , mDispatchLatency );
+    streamHistogram ( aStream , "packet_latency_us" , aLabels , mPacketLatency );
+    streamHistogram ( aStream , "queue_depth" , aLabels , mQueueDepth );
+  }
+
+}
@@ -72,11 +72,17 @@ namespace uhal
 
   Node* DerivedNodeFactory::convertToClassType ( Node* aNode )
   {
-    std::unordered_map< std::string , std::shared_ptr<CreatorInterface> >::const_iterator lIt = mCreators.find ( aNode->mClassName );
+    return convertToClassType ( aNode , aNode->mAttributes->mClassName );
+  }
+
+
+  Node* DerivedNodeFactory::convertToClassType ( Node* aNode , const std::string& aNodeClassName )
+  {
+    std::unordered_map< std::string , std::shared_ptr<CreatorInterface> >::const_iterator lIt = mCreators.find ( aNodeClassName );
 
     if ( lIt == mCreators.end() )
     {
-      log ( Warning , "Class " , Quote ( aNode->mClassName ) , " is unknown to the NodeTreeBuilder class factory. A plain node will be returned instead." );
+      log ( Warning , "Class " , Quote ( aNodeClassName ) , " is unknown to the NodeTreeBuilder class factory. A plain node will be returned instead." );
 
       if ( mCreators.size() )
       {
@@ -102,4 +108,18 @@ namespace uhal
     }
   }
 
+
+  std::string DerivedNodeFactory::getClassName ( const Node& aNode ) const
+  {
+    for ( std::unordered_map< std::string , std::shared_ptr<CreatorInterface> >::const_iterator lIt = mCreators.begin() ; lIt != mCreators.end() ; ++lIt )
+    {
+      if ( lIt->second->isTypeOf ( aNode ) )
+      {
+        return lIt->first;
+      }
+    }
+
+    return "";
+  }
+
 }
@@ -0,0 +1,103 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/DispatchGroup.hpp"
+
+#include <future>
+
+#include "uhal/ClientInterface.hpp"
+#include "uhal/log/log.hpp"
+
+
+namespace uhal
+{
+
+  DispatchGroup::DispatchGroup()
+  {
+  }
+
+
+  DispatchGroup::DispatchGroup ( const std::vector< HwInterface* >& aDevices )
+  {
+    for ( HwInterface* lDevice : aDevices )
+    {
+      add ( *lDevice );
+    }
+  }
+
+
+  DispatchGroup::~DispatchGroup()
+  {
+  }
+
+
+  void DispatchGroup::add ( HwInterface& aDevice )
+  {
+    mClients.push_back ( aDevice.mClientInterface );
+  }
+
+
+  std::size_t DispatchGroup::size() const
+  {
+    return mClients.size();
+  }
+
+
+  std::map< std::size_t , std::exception_ptr > DispatchGroup::dispatch()
+  {
+    std::vector< std::future<void> > lFutures;
+    lFutures.reserve ( mClients.size() );
+
+    // Send all devices' transactions first, and then wait for the replies, so that the round trips overlap; the futures are
+    // completed by the clients' transports, so this does not need a thread per device
+    for ( const auto& lClient : mClients )
+    {
+      lFutures.push_back ( lClient->dispatchAsync() );
+    }
+
+    std::map< std::size_t , std::exception_ptr > lErrors;
+
+    for ( std::size_t i = 0; i != mClients.size(); i++ )
+    {
+      try
+      {
+        lFutures.at ( i ).get();
+      }
+      catch ( const std::exception& aExc )
+      {
+        log ( Error() , "Dispatch failed for device " , Quote ( mClients.at ( i )->id() ) , ": " , aExc.what() );
+        lErrors [ i ] = std::current_exception();
+      }
+      catch ( ... )
+      {
+        log ( Error() , "Dispatch failed for device " , Quote ( mClients.at ( i )->id() ) );
+        lErrors [ i ] = std::current_exception();
+      }
+    }
+
+    return lErrors;
+  }
+
+}
@@ -54,10 +54,9 @@ namespace uhal
 
   HwInterface::HwInterface ( const HwInterface& otherHw ) :
     mClientInterface ( otherHw.mClientInterface ),
-    mNode ( otherHw.mNode->clone() )
+    mNode ( otherHw.mNode )
   {
-    claimNode ( *mNode );
-    mClientInterface->mNode = mNode;
+    // Copies share both the client and the node tree, which is already bound to that client
   }
 
 
@@ -68,7 +67,7 @@ namespace uhal
 
   void HwInterface::claimNode ( Node& aNode )
   {
-    aNode.mHw = this;
+    aNode.mClient = mClientInterface.get();
 
     for (Node* lChild: aNode.mChildren)
       claimNode ( *lChild );
@@ -104,6 +103,12 @@ namespace uhal
   }
 
 
+  std::future<void> HwInterface::dispatchAsync ()
+  {
+    return mClientInterface->dispatchAsync ();
+  }
+
+
   const std::string& HwInterface::id() const
   {
     return mClientInterface->id();
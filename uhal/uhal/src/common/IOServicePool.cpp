@@ -0,0 +1,215 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/IOServicePool.hpp"
+
+#include <cstdlib>
+#include <future>
+
+#include <boost/asio/deadline_timer.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include "uhal/log/log.hpp"
+
+
+namespace uhal
+{
+
+  std::shared_ptr< IOServicePool > IOServicePool::mInstance;
+
+
+  IOServicePool::Worker::Worker() :
+    mIOservice ( new boost::asio::io_service() ),
+    mIOserviceWork ( *mIOservice ),
+    mThread ( )
+  {
+    std::shared_ptr< boost::asio::io_service > lIOService ( mIOservice );
+    mThread = std::thread ( [lIOService] () { lIOService->run(); } );
+  }
+
+
+  IOServicePool::Worker::~Worker()
+  {
+    mIOservice->stop();
+
+    // The last client of a worker may be destroyed by one of its own handlers (e.g. after the number of threads has been reduced);
+    // the thread cannot join itself, so it is left to finish once that handler returns, keeping the io_service alive until then
+    if ( std::this_thread::get_id() == mThread.get_id() )
+    {
+      mThread.detach();
+    }
+    else
+    {
+      mThread.join();
+    }
+  }
+
+
+  IOServicePool::IOServicePool() :
+    mNrThreads ( 0 )
+  {
+    if ( const char* lEnvVar = std::getenv ( "UHAL_IO_THREADS" ) )
+    {
+      try
+      {
+        mNrThreads = boost::lexical_cast<size_t> ( lEnvVar );
+        log ( Info() , "UDP and TCP clients will share " , Integer ( mNrThreads ) , " IO threads (from UHAL_IO_THREADS environment variable)" );
+      }
+      catch ( const boost::bad_lexical_cast& )
+      {
+        log ( Warning() , "Ignoring invalid value " , Quote ( lEnvVar ) , " of UHAL_IO_THREADS environment variable; each UDP/TCP client will have its own IO thread" );
+      }
+    }
+  }
+
+
+  IOServicePool::~IOServicePool()
+  {
+  }
+
+
+  IOServicePool& IOServicePool::getInstance()
+  {
+    static std::mutex lMutex;
+    std::lock_guard<std::mutex> lLock ( lMutex );
+
+    if ( ! mInstance )
+    {
+      mInstance.reset ( new IOServicePool() );
+    }
+
+    return *mInstance;
+  }
+
+
+  void IOServicePool::setNumberOfThreads ( size_t aNrThreads )
+  {
+    std::lock_guard<std::mutex> lLock ( mMutex );
+    mNrThreads = aNrThreads;
+
+    // Workers beyond the new size stay alive until their last client is destroyed
+    if ( mWorkers.size() > mNrThreads )
+    {
+      mWorkers.resize ( mNrThreads );
+    }
+  }
+
+
+  size_t IOServicePool::getNumberOfThreads() const
+  {
+    std::lock_guard<std::mutex> lLock ( mMutex );
+    return mNrThreads;
+  }
+
+
+  std::shared_ptr< boost::asio::io_service > IOServicePool::getIOService()
+  {
+    std::lock_guard<std::mutex> lLock ( mMutex );
+    std::shared_ptr< Worker > lWorker;
+
+    if ( mNrThreads == 0 )
+    {
+      lWorker.reset ( new Worker() );
+    }
+    else if ( mWorkers.size() < mNrThreads )
+    {
+      lWorker.reset ( new Worker() );
+      mWorkers.push_back ( lWorker );
+    }
+    else
+    {
+      // Pick the worker with the fewest clients; each client holds one reference, and the pool holds another
+      lWorker = mWorkers.front();
+
+      for ( const auto& lCandidate : mWorkers )
+      {
+        if ( lCandidate.use_count() < lWorker.use_count() )
+        {
+          lWorker = lCandidate;
+        }
+      }
+    }
+
+    // Aliasing constructor: the returned pointer keeps the worker (and hence its thread) alive
+    return std::shared_ptr< boost::asio::io_service > ( lWorker , lWorker->mIOservice.get() );
+  }
+
+
+  void IOServicePool::close ( boost::asio::io_service& aIOService , const std::function< void () >& aCloseFunction )
+  {
+    // Called from within one of the io_service's own handlers (e.g. a client destroyed by another client's handler, in a
+    // shared thread): waiting for a posted handler would deadlock, so close inline. The cancelled handlers run after the
+    // client has gone, and do nothing since they are guarded; they are not run here by polling the io_service, since that
+    // would also run other clients' handlers from within the caller's handler
+    if ( aIOService.get_executor().running_in_this_thread() )
+    {
+      aCloseFunction();
+      return;
+    }
+
+    std::promise<void> lPromise;
+
+    // Closing sockets and cancelling timers queues their pending handlers with 'operation_aborted'. Those handlers may be
+    // held in a per-thread queue until the current handler returns, so the promise is only fulfilled after two further hops
+    // through the io_service, by which point all of the cancelled handlers have run.
+    aIOService.post ( [&aIOService, &aCloseFunction, &lPromise] () {
+      aCloseFunction();
+      aIOService.post ( [&aIOService, &lPromise] () {
+        aIOService.post ( [&lPromise] () { lPromise.set_value(); } );
+      });
+    });
+
+    lPromise.get_future().wait();
+  }
+
+
+  void IOServicePool::post ( const std::function< void () >& aTask )
+  {
+    std::lock_guard<std::mutex> lLock ( mMutex );
+
+    if ( ! mCompletionWorker )
+    {
+      mCompletionWorker.reset ( new Worker() );
+    }
+
+    mCompletionWorker->mIOservice->post ( aTask );
+  }
+
+
+  void IOServicePool::post ( const std::function< void () >& aTask , const boost::posix_time::time_duration& aDelay )
+  {
+    std::lock_guard<std::mutex> lLock ( mMutex );
+
+    if ( ! mCompletionWorker )
+    {
+      mCompletionWorker.reset ( new Worker() );
+    }
+
+    // The handler keeps the timer alive until it has expired
+    std::shared_ptr< boost::asio::deadline_timer > lTimer ( new boost::asio::deadline_timer ( *mCompletionWorker->mIOservice , aDelay ) );
+    lTimer->async_wait ( [lTimer, aTask] ( const boost::system::error_code& ) { aTask(); } );
+  }
+
+}
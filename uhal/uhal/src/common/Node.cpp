@@ -48,8 +48,7 @@
 namespace uhal
 {
 
-  Node::Node ( )  :
-    mHw ( NULL ),
+  Node::Attributes::Attributes ( )  :
     mUid ( "" ),
     mPartialAddr ( 0x00000000 ),
     mAddr ( 0x00000000 ),
@@ -63,59 +62,48 @@ namespace uhal
     mClassName ( "" ),
     mParameters ( ),
     mFirmwareInfo( ),
+    mChildIndices ( )
+  {
+  }
+
+
+  Node::Node ( )  :
+    mClient ( NULL ),
+    mAttributes ( std::make_shared<Attributes>() ),
     mParent ( NULL ),
     mChildren ( ),
-    mChildrenMap ( )
+    mDescendants ( ),
+    mDescendantIndices ( ),
+    mPathFromTop ( NULL )
   {
   }
 
 
   Node::Node ( const Node& aNode )  :
-    mHw ( aNode.mHw ),
-    mUid ( aNode.mUid ),
-    mPartialAddr ( aNode.mPartialAddr ),
-    mAddr ( aNode.mAddr ),
-    mMask ( aNode.mMask ),
-    mPermission ( aNode.mPermission ),
-    mMode ( aNode.mMode ),
-    mSize ( aNode.mSize ),
-    mTags ( aNode.mTags ),
-    mDescription ( aNode.mDescription ),
-    mModule ( aNode.mModule ),
-    mClassName ( aNode.mClassName ),
-    mParameters ( aNode.mParameters ),
-    mFirmwareInfo ( aNode.mFirmwareInfo ),
+    mClient ( aNode.mClient ),
+    mAttributes ( aNode.mAttributes ),
     mParent ( NULL ),
     mChildren ( ),
-    mChildrenMap ( )
+    mDescendants ( ),
+    mDescendantIndices ( aNode.mDescendantIndices ),
+    mPathFromTop ( NULL )
   {
     mChildren.reserve(aNode.mChildren.size());
     for (Node* lChild : aNode.mChildren)
-      mChildren.push_back (lChild->clone());
-
-    for (Node* lChild : mChildren)
     {
-      lChild->mParent = this;
-      mChildrenMap.insert ( std::make_pair ( lChild->mUid , lChild ) );
+      mChildren.push_back (lChild->clone());
+      mChildren.back()->mParent = this;
     }
+
+    bindDescendants();
   }
 
 
   Node& Node::operator= ( const Node& aNode )
   {
-    mHw = aNode.mHw;
-    mUid = aNode.mUid ;
-    mPartialAddr = aNode.mPartialAddr;
-    mAddr = aNode.mAddr;
-    mMask = aNode.mMask;
-    mPermission = aNode.mPermission;
-    mMode = aNode.mMode;
-    mSize = aNode.mSize;
-    mTags = aNode.mTags;
-    mDescription = aNode.mDescription;
-    mModule = aNode.mModule;
-    mClassName = aNode.mClassName;
-    mParameters = aNode.mParameters;
+    mClient = aNode.mClient;
+    mAttributes = aNode.mAttributes;
+    mDescendantIndices = aNode.mDescendantIndices;
 
     for (Node* lChild: mChildren)
     {
@@ -127,18 +115,15 @@ namespace uhal
     }
 
     mChildren.clear();
-    mChildrenMap.clear();
 
     mChildren.reserve(aNode.mChildren.size());
     for (Node* lNode: aNode.mChildren)
-      mChildren.push_back ( lNode->clone() );
-
-    for (Node* lNode: mChildren)
     {
-      lNode->mParent = this;
-      mChildrenMap.insert ( std::make_pair ( lNode->mUid , lNode ) );
+      mChildren.push_back ( lNode->clone() );
+      mChildren.back()->mParent = this;
     }
 
+    bindDescendants();
     return *this;
   }
 
@@ -161,7 +146,104 @@ namespace uhal
     }
 
     mChildren.clear();
-    mChildrenMap.clear();
+  }
+
+
+  Node::Attributes& Node::modifyAttributes()
+  {
+    if ( mAttributes.use_count() > 1 )
+    {
+      mAttributes = std::make_shared<Attributes> ( *mAttributes );
+    }
+
+    return *mAttributes;
+  }
+
+
+  void Node::addChild ( Node* aChild )
+  {
+    aChild->mParent = this;
+    mChildren.push_back ( aChild );
+    modifyAttributes().mChildIndices.insert ( std::make_pair ( aChild->mAttributes->mUid , mChildren.size() - 1 ) );
+  }
+
+
+  void Node::indexChildren()
+  {
+    // Only copy the attributes (if shared) when the index actually changes, e.g. not when the children were already in order
+    const std::unordered_map< std::string , size_t >& lCurrentIndices = mAttributes->mChildIndices;
+    bool lUpToDate ( lCurrentIndices.size() == mChildren.size() );
+
+    for ( size_t i = 0; lUpToDate and ( i != mChildren.size() ); ++i )
+    {
+      std::unordered_map< std::string , size_t >::const_iterator lIt = lCurrentIndices.find ( mChildren.at(i)->mAttributes->mUid );
+      lUpToDate = ( ( lIt != lCurrentIndices.end() ) and ( lIt->second == i ) );
+    }
+
+    if ( lUpToDate )
+    {
+      return;
+    }
+
+    std::unordered_map< std::string , size_t >& lChildIndices = modifyAttributes().mChildIndices;
+    lChildIndices.clear();
+
+    for ( size_t i = 0; i != mChildren.size(); ++i )
+    {
+      lChildIndices.insert ( std::make_pair ( mChildren.at(i)->mAttributes->mUid , i ) );
+    }
+  }
+
+
+  void Node::indexDescendants()
+  {
+    std::shared_ptr< std::unordered_map< std::string , size_t > > lDescendantIndices ( std::make_shared< std::unordered_map< std::string , size_t > >() );
+    size_t lIndex = 0;
+
+    // The 'begin' method returns an iterator to this instance, so skip to the next node straight away
+    for ( Node::const_iterator lIt = ++begin(); lIt != end(); lIt++ )
+    {
+      lDescendantIndices->insert ( std::make_pair ( lIt->getRelativePath ( *this ) , lIndex++ ) );
+    }
+
+    mDescendantIndices = lDescendantIndices;
+    bindDescendants();
+  }
+
+
+  void Node::clearDescendantIndex()
+  {
+    for ( const Node* lDescendant : mDescendants )
+    {
+      const_cast< Node* > ( lDescendant )->mPathFromTop = NULL;
+    }
+
+    mDescendants.clear();
+    mDescendantIndices.reset();
+  }
+
+
+  void Node::bindDescendants()
+  {
+    mDescendants.clear();
+
+    if ( not mDescendantIndices )
+    {
+      return;
+    }
+
+    mDescendants.reserve ( mDescendantIndices->size() );
+
+    for ( Node::const_iterator lIt = ++begin(); lIt != end(); lIt++ )
+    {
+      mDescendants.push_back ( & ( *lIt ) );
+    }
+
+    // The keys of the index outlive the descendants, since the index is held by this node
+    for ( const auto& lEntry : *mDescendantIndices )
+    {
+      const_cast< Node* > ( mDescendants.at ( lEntry.second ) )->mPathFromTop = &lEntry.first;
+    }
   }
 
 
@@ -190,7 +272,7 @@ namespace uhal
 
   const std::string& Node::getId() const
   {
-    return mUid;
+    return mAttributes->mUid;
   }
 
 
@@ -202,9 +284,9 @@ namespace uhal
 
     for (const Node* lNode: lPath)
     {
-      if ( lNode->mUid.size() )
+      if ( lNode->mAttributes->mUid.size() )
       {
-        lRet += lNode->mUid;
+        lRet += lNode->mAttributes->mUid;
         lRet += ".";
       }
     }
@@ -226,9 +308,9 @@ namespace uhal
 
     for (std::deque< const Node* >::iterator lIt ( std::find(lPath.begin(), lPath.end(), &aAncestor) + 1 ) ; lIt != lPath.end() ; ++lIt )
     {
-      if ( ( **lIt ).mUid.size() )
+      if ( ( **lIt ).mAttributes->mUid.size() )
       {
-        lRet += ( **lIt ).mUid;
+        lRet += ( **lIt ).mAttributes->mUid;
         lRet += ".";
       }
     }
@@ -255,61 +337,61 @@ namespace uhal
 
   const uint32_t& Node::getAddress() const
   {
-    return mAddr;
+    return mAttributes->mAddr;
   }
 
 
   const uint32_t& Node::getMask() const
   {
-    return mMask;
+    return mAttributes->mMask;
   }
 
 
   const defs::BlockReadWriteMode& Node::getMode() const
   {
-    return mMode;
+    return mAttributes->mMode;
   }
 
 
   const uint32_t& Node::getSize() const
   {
-    return mSize;
+    return mAttributes->mSize;
   }
 
 
   const defs::NodePermission& Node::getPermission() const
   {
-    return mPermission;
+    return mAttributes->mPermission;
   }
 
 
   const std::string& Node::getTags() const
   {
-    return mTags;
+    return mAttributes->mTags;
   }
 
 
   const std::string& Node::getDescription() const
   {
-    return mDescription;
+    return mAttributes->mDescription;
   }
 
 
   const std::string& Node::getModule() const
   {
-    return mModule;
+    return mAttributes->mModule;
   }
 
 
   const std::unordered_map< std::string, std::string >& Node::getParameters() const
   {
-    return mParameters;
+    return mAttributes->mParameters;
   }
 
 
   const std::unordered_map< std::string, std::string >& Node::getFirmwareInfo() const
   {
-    return mFirmwareInfo;
+    return mAttributes->mFirmwareInfo;
   }
 
 
@@ -319,7 +401,7 @@ namespace uhal
 
     aStr << std::setfill ( '0' ) << std::uppercase;
     aStr << '\n' << std::string ( aIndent , ' ' ) << "+ ";
-    aStr << "Node \"" << mUid << "\", ";
+    aStr << "Node \"" << mAttributes->mUid << "\", ";
 
     if ( &typeid ( *this ) != &typeid ( Node ) )
     {
@@ -336,62 +418,62 @@ namespace uhal
       aStr << "\", ";
     }
 
-    switch ( mMode )
+    switch ( mAttributes->mMode )
     {
       case defs::SINGLE:
         aStr << "SINGLE register, "
-             << std::hex << "Address 0x" << std::setw ( 8 ) << mAddr << ", "
-             << std::hex << "Mask 0x" << std::setw ( 8 ) << mMask << ", "
-             << "Permissions " << ( mPermission&defs::READ?'r':'-' ) << ( mPermission&defs::WRITE?'w':'-' ) ;
+             << std::hex << "Address 0x" << std::setw ( 8 ) << mAttributes->mAddr << ", "
+             << std::hex << "Mask 0x" << std::setw ( 8 ) << mAttributes->mMask << ", "
+             << "Permissions " << ( mAttributes->mPermission&defs::READ?'r':'-' ) << ( mAttributes->mPermission&defs::WRITE?'w':'-' ) ;
         break;
       case defs::INCREMENTAL:
         aStr << "INCREMENTAL block, "
-             << std::dec << "Size " << mSize << ", "
-             << std::hex << "Addresses [0x" << std::setw ( 8 ) << mAddr << "-" << std::setw ( 8 ) << ( mAddr+mSize-1 ) << "], "
-             << "Permissions " << ( mPermission&defs::READ?'r':'-' ) << ( mPermission&defs::WRITE?'w':'-' ) ;
+             << std::dec << "Size " << mAttributes->mSize << ", "
+             << std::hex << "Addresses [0x" << std::setw ( 8 ) << mAttributes->mAddr << "-" << std::setw ( 8 ) << ( mAttributes->mAddr+mAttributes->mSize-1 ) << "], "
+             << "Permissions " << ( mAttributes->mPermission&defs::READ?'r':'-' ) << ( mAttributes->mPermission&defs::WRITE?'w':'-' ) ;
         break;
       case defs::NON_INCREMENTAL:
         aStr << "NON-INCREMENTAL block, ";
 
-        if ( mSize != 1 )
+        if ( mAttributes->mSize != 1 )
         {
-          aStr << std::dec << "Size " << mSize << ", ";
+          aStr << std::dec << "Size " << mAttributes->mSize << ", ";
         }
 
-        aStr << std::hex << "Address 0x"  << std::setw ( 8 ) << mAddr << ", "
-             << "Permissions " << ( mPermission&defs::READ?'r':'-' ) << ( mPermission&defs::WRITE?'w':'-' ) ;
+        aStr << std::hex << "Address 0x"  << std::setw ( 8 ) << mAttributes->mAddr << ", "
+             << "Permissions " << ( mAttributes->mPermission&defs::READ?'r':'-' ) << ( mAttributes->mPermission&defs::WRITE?'w':'-' ) ;
         break;
       case defs::HIERARCHICAL:
-        aStr << std::hex << "Address 0x" << std::setw ( 8 ) << mAddr;
+        aStr << std::hex << "Address 0x" << std::setw ( 8 ) << mAttributes->mAddr;
         break;
     }
 
-    if ( mTags.size() )
+    if ( mAttributes->mTags.size() )
     {
-      aStr << ", Tags \"" << mTags << "\"";
+      aStr << ", Tags \"" << mAttributes->mTags << "\"";
     }
 
-    if ( mDescription.size() )
+    if ( mAttributes->mDescription.size() )
     {
-      aStr << ", Description \"" << mDescription << "\"";
+      aStr << ", Description \"" << mAttributes->mDescription << "\"";
     }
 
-    if ( mModule.size() )
+    if ( mAttributes->mModule.size() )
     {
-      aStr << ", Module \"" << mModule << "\"";
+      aStr << ", Module \"" << mAttributes->mModule << "\"";
     }
 
-    if ( mClassName.size() )
+    if ( mAttributes->mClassName.size() )
     {
-      aStr << ", Class Name \"" << mClassName << "\"";
+      aStr << ", Class Name \"" << mAttributes->mClassName << "\"";
     }
 
-    if ( mParameters.size() )
+    if ( mAttributes->mParameters.size() )
     {
       aStr << ", Parameters: ";
       std::unordered_map<std::string, std::string>::const_iterator lIt;
 
-      for ( lIt = mParameters.begin(); lIt != mParameters.end(); ++lIt )
+      for ( lIt = mAttributes->mParameters.begin(); lIt != mAttributes->mParameters.end(); ++lIt )
       {
         aStr << lIt->first << "=" << lIt->second << ";";
       }
@@ -415,6 +497,25 @@ namespace uhal
       return *this;
     }
 
+    // Look up the full path in the index of the top node in a single step, if it has one
+    const Node* lTop = this;
+    while ( lTop->mParent )
+    {
+      lTop = lTop->mParent;
+    }
+
+    if ( lTop->mDescendantIndices and ( ( lTop == this ) or mPathFromTop ) )
+    {
+      const std::unordered_map< std::string , size_t >& lDescendantIndices = *lTop->mDescendantIndices;
+      std::unordered_map< std::string , size_t >::const_iterator lIt = lDescendantIndices.find ( ( lTop == this ) ? aId : ( *mPathFromTop + "." + aId ) );
+
+      if ( lIt != lDescendantIndices.end() )
+      {
+        return *lTop->mDescendants[lIt->second];
+      }
+    }
+
+    // Otherwise walk down the tree one level at a time, which also gives the most informative error message
     size_t lStartIdx = 0;
     size_t lDotIdx = 0;
 
@@ -422,10 +523,10 @@ namespace uhal
 
     do {
       lDotIdx = aId.find('.', lStartIdx);
-      std::unordered_map< std::string , Node* >::const_iterator lIt = lDescendant->mChildrenMap.find ( aId.substr(lStartIdx, lDotIdx - lStartIdx) );
+      std::unordered_map< std::string , size_t >::const_iterator lIt = lDescendant->mAttributes->mChildIndices.find ( aId.substr(lStartIdx, lDotIdx - lStartIdx) );
 
-      if (lIt != lDescendant->mChildrenMap.end()) {
-        lDescendant = lIt->second;
+      if (lIt != lDescendant->mAttributes->mChildIndices.end()) {
+        lDescendant = lDescendant->mChildren[lIt->second];
       }
       else if (lDescendant == this) {
         exception::NoBranchFoundWithGivenUID lExc;
@@ -485,15 +586,15 @@ namespace uhal
 
   ValHeader  Node::write ( const uint32_t& aValue ) const
   {
-    if ( mPermission & defs::WRITE )
+    if ( mAttributes->mPermission & defs::WRITE )
     {
-      if ( mMask == defs::NOMASK )
+      if ( mAttributes->mMask == defs::NOMASK )
       {
-        return mHw->getClient().write ( mAddr , aValue );
+        return mClient->write ( mAttributes->mAddr , aValue );
       }
-      else if ( mPermission & defs::READ )
+      else if ( mAttributes->mPermission & defs::READ )
       {
-        return mHw->getClient().write ( mAddr , aValue , mMask );
+        return mClient->write ( mAttributes->mAddr , aValue , mAttributes->mMask );
       }
       else // Masked write-only register
       {
@@ -511,7 +612,21 @@ namespace uhal
 
   ValHeader  Node::writeBlock ( const std::vector< uint32_t >& aValues ) const // , const defs::BlockReadWriteMode& aMode )
   {
-    if ( ( mMode == defs::SINGLE ) && ( aValues.size() != 1 ) ) //We allow the user to call a bulk access of size=1 to a single register
+    checkWriteBlock ( aValues.size() );
+    return mClient->writeBlock ( mAttributes->mAddr , aValues , mAttributes->mMode ); //aMode );
+  }
+
+
+  ValHeader  Node::writeBlock ( std::vector< uint32_t >&& aValues ) const
+  {
+    checkWriteBlock ( aValues.size() );
+    return mClient->writeBlock ( mAttributes->mAddr , std::move ( aValues ) , mAttributes->mMode );
+  }
+
+
+  void Node::checkWriteBlock ( const size_t aSize ) const
+  {
+    if ( ( mAttributes->mMode == defs::SINGLE ) && ( aSize != 1 ) ) //We allow the user to call a bulk access of size=1 to a single register
     {
       exception::BulkTransferOnSingleRegister lExc;
       log ( lExc , "Bulk Transfer requested on single register node " , Quote ( this->getPath() ) );
@@ -519,37 +634,32 @@ namespace uhal
       throw lExc;
     }
 
-    if ( ( mSize != 1 ) && ( aValues.size() >mSize ) )
+    if ( ( mAttributes->mSize != 1 ) && ( aSize > mAttributes->mSize ) )
     {
       exception::BulkTransferRequestedTooLarge lExc;
       log ( lExc , "Requested bulk write of greater size than the specified endpoint size of node ", Quote ( this->getPath() ) );
       throw lExc;
     }
 
-    if ( mPermission & defs::WRITE )
-    {
-      return mHw->getClient().writeBlock ( mAddr , aValues , mMode ); //aMode );
-    }
-    else
+    if ( ! ( mAttributes->mPermission & defs::WRITE ) )
     {
       exception::WriteAccessDenied lExc;
       log ( lExc , "Node " , Quote ( this->getPath() ) , ": permissions denied write access" );
       throw lExc;
     }
-    
   }
 
 
   ValHeader  Node::writeBlockOffset ( const std::vector< uint32_t >& aValues , const uint32_t& aOffset ) const // , const defs::BlockReadWriteMode& aMode )
   {
-    if ( mMode == defs::NON_INCREMENTAL )
+    if ( mAttributes->mMode == defs::NON_INCREMENTAL )
     {
       exception::BulkTransferOffsetRequestedForFifo lExc;
       log ( lExc , "Bulk Transfer Offset requested for non-incremental node " , Quote ( this->getPath() ) );
       throw lExc;
     }
 
-    if ( mMode == defs::SINGLE ) //We allow the user to call a bulk access of size=1 to a single register
+    if ( mAttributes->mMode == defs::SINGLE ) //We allow the user to call a bulk access of size=1 to a single register
     {
       exception::BulkTransferOffsetRequestedForSingleRegister lExc;
       log ( lExc , "Bulk Transfer with offset requested on single register node " , Quote ( this->getPath() ) );
@@ -557,16 +667,16 @@ namespace uhal
       throw lExc;
     }
 
-    if ( (aValues.size()+aOffset) > mSize )
+    if ( (aValues.size()+aOffset) > mAttributes->mSize )
     {
       exception::BulkTransferRequestedTooLarge lExc;
       log ( lExc , "Requested bulk write size and offset would overflow the specified endpoint node ", Quote ( this->getPath() ) );
       throw lExc;
     }
 
-    if ( mPermission & defs::WRITE )
+    if ( mAttributes->mPermission & defs::WRITE )
     {
-      return mHw->getClient().writeBlock ( mAddr+aOffset , aValues , mMode ); //aMode );
+      return mClient->writeBlock ( mAttributes->mAddr+aOffset , aValues , mAttributes->mMode ); //aMode );
     }
     else
     {
@@ -580,15 +690,15 @@ namespace uhal
 
   ValWord< uint32_t > Node::read() const
   {
-    if ( mPermission & defs::READ )
+    if ( mAttributes->mPermission & defs::READ )
     {
-      if ( mMask == defs::NOMASK )
+      if ( mAttributes->mMask == defs::NOMASK )
       {
-        return mHw->getClient().read ( mAddr );
+        return mClient->read ( mAttributes->mAddr );
       }
       else
       {
-        return mHw->getClient().read ( mAddr , mMask );
+        return mClient->read ( mAttributes->mAddr , mAttributes->mMask );
       }
     }
 
@@ -601,7 +711,21 @@ namespace uhal
 
   ValVector< uint32_t > Node::readBlock ( const uint32_t& aSize ) const //, const defs::BlockReadWriteMode& aMode )
   {
-    if ( ( mMode == defs::SINGLE ) && ( aSize != 1 ) ) //We allow the user to call a bulk access of size=1 to a single register
+    checkReadBlock ( aSize );
+    return mClient->readBlock ( mAttributes->mAddr , aSize , mAttributes->mMode ); //aMode );
+  }
+
+
+  ValHeader Node::readBlock ( uint32_t* aBuffer , const uint32_t& aSize ) const
+  {
+    checkReadBlock ( aSize );
+    return mClient->readBlock ( mAttributes->mAddr , aBuffer , aSize , mAttributes->mMode );
+  }
+
+
+  void Node::checkReadBlock ( const uint32_t& aSize ) const
+  {
+    if ( ( mAttributes->mMode == defs::SINGLE ) && ( aSize != 1 ) ) //We allow the user to call a bulk access of size=1 to a single register
     {
       exception::BulkTransferOnSingleRegister lExc;
       log ( lExc , "Bulk Transfer requested on single register node ", Quote ( this->getPath() ) );
@@ -609,37 +733,32 @@ namespace uhal
       throw lExc;
     }
 
-    if ( ( mSize != 1 ) && ( aSize>mSize ) )
+    if ( ( mAttributes->mSize != 1 ) && ( aSize > mAttributes->mSize ) )
     {
       exception::BulkTransferRequestedTooLarge lExc;
       log ( lExc , "Requested bulk read of greater size than the specified endpoint size of node " , Quote ( this->getPath() ) );
       throw lExc;
     }
 
-    if ( mPermission & defs::READ )
-    {
-      return mHw->getClient().readBlock ( mAddr , aSize , mMode ); //aMode );
-    }
-    else
+    if ( ! ( mAttributes->mPermission & defs::READ ) )
     {
       exception::ReadAccessDenied lExc;
       log ( lExc , "Node " , Quote ( this->getPath() ) , ": permissions denied read access" );
       throw lExc;
     }
-    
   }
 
 
   ValVector< uint32_t > Node::readBlockOffset ( const uint32_t& aSize , const uint32_t& aOffset ) const //, const defs::BlockReadWriteMode& aMode )
   {
-    if ( mMode == defs::NON_INCREMENTAL )
+    if ( mAttributes->mMode == defs::NON_INCREMENTAL )
     {
       exception::BulkTransferOffsetRequestedForFifo lExc;
       log ( lExc , "Bulk Transfer offset requested for non-incremental node " , Quote ( this->getPath() ) );
       throw lExc;
     }
 
-    if ( mMode == defs::SINGLE ) //We do not allow the user to use an offset from a single register
+    if ( mAttributes->mMode == defs::SINGLE ) //We do not allow the user to use an offset from a single register
     {
       exception::BulkTransferOffsetRequestedForSingleRegister lExc;
       log ( lExc , "Bulk Transfer with offset requested on single register node ", Quote ( this->getPath() ) );
@@ -647,16 +766,16 @@ namespace uhal
       throw lExc;
     }
 
-    if ( (aSize+aOffset) > mSize )
+    if ( (aSize+aOffset) > mAttributes->mSize )
     {
       exception::BulkTransferRequestedTooLarge lExc;
       log ( lExc , "Requested bulk read size and offset would overflow the specified endpoint node " , Quote ( this->getPath() ) );
       throw lExc;
     }
 
-    if ( mPermission & defs::READ )
+    if ( mAttributes->mPermission & defs::READ )
     {
-      return mHw->getClient().readBlock ( mAddr+aOffset , aSize , mMode ); //aMode );
+      return mClient->readBlock ( mAttributes->mAddr+aOffset , aSize , mAttributes->mMode ); //aMode );
     }
     else
     {
@@ -670,7 +789,7 @@ namespace uhal
 
   ClientInterface& Node::getClient() const
   {
-    return mHw->getClient();
+    return *mClient;
   }
 
 
@@ -33,13 +33,32 @@
 #include "uhal/NodeTreeBuilder.hpp"
 
 
+#include <algorithm>
+#include <cerrno>
 #include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
 #include <functional>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <typeinfo>
+#include <unordered_set>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <boost/spirit/include/qi.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
 
 #include "uhal/detail/utilities.hpp"
 #include "uhal/DerivedNodeFactory.hpp"
@@ -72,7 +91,402 @@ namespace uhal
   std::shared_ptr<NodeTreeBuilder> NodeTreeBuilder::mInstance;
 
 
-  NodeTreeBuilder::NodeTreeBuilder ()
+  namespace
+  {
+    //! Identifies compiled address table files; the last two characters are the format version
+    const char kCacheMagic[8] = { 'u' , 'H' , 'A' , 'L' , 'A' , 'T' , '0' , '1' };
+
+    //! 64-bit FNV-1a hash of a block of bytes
+    uint64_t hashBytes ( const uint8_t* aPtr , const size_t aSize )
+    {
+      uint64_t lHash ( 0xcbf29ce484222325ULL );
+
+      for ( const uint8_t* lEnd = aPtr + aSize; aPtr != lEnd; ++aPtr )
+      {
+        lHash ^= *aPtr;
+        lHash *= 0x100000001b3ULL;
+      }
+
+      return lHash;
+    }
+
+    //! Hash the current content of a local file, returning false if it cannot be read
+    bool hashFile ( const std::string& aPath , uint64_t& aHash )
+    {
+      std::ifstream lStr ( aPath.c_str() , std::ios::binary );
+
+      if ( !lStr.is_open() )
+      {
+        return false;
+      }
+
+      const std::vector<uint8_t> lFile ( ( std::istreambuf_iterator<char> ( lStr ) ) , std::istreambuf_iterator<char>() );
+      aHash = hashBytes ( lFile.data() , lFile.size() );
+      return true;
+    }
+
+    template < typename T >
+    void putValue ( std::string& aBuffer , const T& aValue )
+    {
+      aBuffer.append ( reinterpret_cast<const char*> ( &aValue ) , sizeof ( T ) );
+    }
+
+    void putString ( std::string& aBuffer , const std::string& aValue )
+    {
+      putValue<uint32_t> ( aBuffer , aValue.size() );
+      aBuffer.append ( aValue );
+    }
+
+    void putMap ( std::string& aBuffer , const std::unordered_map<std::string, std::string>& aMap )
+    {
+      putValue<uint32_t> ( aBuffer , aMap.size() );
+
+      for ( const auto& lItem : aMap )
+      {
+        putString ( aBuffer , lItem.first );
+        putString ( aBuffer , lItem.second );
+      }
+    }
+
+    void checkRemaining ( const uint8_t* aPtr , const uint8_t* aEnd , const size_t aSize )
+    {
+      if ( size_t ( aEnd - aPtr ) < aSize )
+      {
+        throw exception::CorruptAddressTableCache ( "Compiled address table file is truncated" );
+      }
+    }
+
+    template < typename T >
+    T getValue ( const uint8_t*& aPtr , const uint8_t* aEnd )
+    {
+      checkRemaining ( aPtr , aEnd , sizeof ( T ) );
+      T lValue;
+      memcpy ( &lValue , aPtr , sizeof ( T ) );
+      aPtr += sizeof ( T );
+      return lValue;
+    }
+
+    std::string getString ( const uint8_t*& aPtr , const uint8_t* aEnd )
+    {
+      const uint32_t lSize ( getValue<uint32_t> ( aPtr , aEnd ) );
+      checkRemaining ( aPtr , aEnd , lSize );
+      std::string lValue ( reinterpret_cast<const char*> ( aPtr ) , lSize );
+      aPtr += lSize;
+      return lValue;
+    }
+
+    //! Unmaps a memory-mapped file when it goes out of scope
+    class ScopedMapping
+    {
+      public:
+        ScopedMapping ( void* aAddress , const size_t aSize ) :
+          mAddress ( aAddress ),
+          mSize ( aSize )
+        {
+        }
+
+        ~ScopedMapping()
+        {
+          munmap ( mAddress , mSize );
+        }
+
+        ScopedMapping ( const ScopedMapping& ) = delete;
+        ScopedMapping& operator= ( const ScopedMapping& ) = delete;
+
+      private:
+        void* mAddress;
+        const size_t mSize;
+    };
+
+    //! Collect the module attributes of all nodes below an XML node
+    void findModules ( const pugi::xml_node& aXmlNode , std::vector<std::string>& aModules )
+    {
+      for ( pugi::xml_node lChild = aXmlNode.child ( "node" ); lChild; lChild = lChild.next_sibling ( "node" ) )
+      {
+        if ( pugi::xml_attribute lAttribute = lChild.attribute ( "module" ) )
+        {
+          aModules.push_back ( lAttribute.value() );
+        }
+
+        findModules ( lChild , aModules );
+      }
+    }
+
+    void getMap ( const uint8_t*& aPtr , const uint8_t* aEnd , std::unordered_map<std::string, std::string>& aMap )
+    {
+      const uint32_t lSize ( getValue<uint32_t> ( aPtr , aEnd ) );
+      // Each entry holds the sizes of its key and value, so this bounds the reservation for corrupt files
+      checkRemaining ( aPtr , aEnd , size_t ( lSize ) * 2 * sizeof ( uint32_t ) );
+      aMap.reserve ( lSize );
+
+      for ( uint32_t i = 0; i != lSize; ++i )
+      {
+        std::string lKey ( getString ( aPtr , aEnd ) );
+        aMap [ lKey ] = getString ( aPtr , aEnd );
+      }
+    }
+  }
+
+
+  class NodeTreeBuilder::Prefetcher
+  {
+    public:
+      /**
+        Constructor; starts the threads
+        @param aBuilder the node tree builder, used to check which files need to be parsed
+        @param aNrThreads the number of threads
+      */
+      Prefetcher ( const NodeTreeBuilder& aBuilder , const size_t aNrThreads );
+
+      //! Destructor; waits for the files currently being read to be finished, and discards any remaining requests
+      ~Prefetcher();
+
+      /**
+        Request that the files matching an expression are read and parsed
+        @param aProtocol the protocol by which the files are to be loaded
+        @param aFilenameExpr the filename expression
+        @param aParentPath the path that will be prepended to relative filenames
+      */
+      void request ( const std::string& aProtocol , const std::string& aFilenameExpr , const boost::filesystem::path& aParentPath );
+
+      /**
+        Retrieve the files matching an expression, waiting for them to be read if necessary
+        @param aProtocol the protocol by which the files are to be loaded
+        @param aFilenameExpr the filename expression
+        @param aParentPath the path that will be prepended to relative filenames
+        @param aFiles filled with the files
+        @return false if the files were never requested
+      */
+      bool get ( const std::string& aProtocol , const std::string& aFilenameExpr , const boost::filesystem::path& aParentPath , std::vector< std::shared_ptr<AddressFile> >& aFiles );
+
+    private:
+      //! The files matching a filename expression
+      struct Request
+      {
+        std::string mProtocol;
+        std::string mFilenameExpr;
+        boost::filesystem::path mParentPath;
+        //! Whether a thread has started reading the files
+        bool mStarted;
+        //! Whether the files have been read
+        bool mDone;
+        std::vector< std::shared_ptr<AddressFile> > mFiles;
+        //! Exception thrown while reading the files, rethrown in the thread that retrieves them
+        std::exception_ptr mException;
+      };
+
+      static std::string getKey ( const std::string& aProtocol , const std::string& aFilenameExpr , const boost::filesystem::path& aParentPath );
+
+      //! Main function of the threads
+      void run();
+
+      //! Read and parse the files for a request, then request any modules that they contain
+      void load ( Request& aRequest );
+
+      const NodeTreeBuilder& mBuilder;
+
+      //! The address files that the builder had already constructed node trees for when the threads were started
+      std::unordered_set< std::string > mKnownFiles;
+
+      std::mutex mMutex;
+      //! Notified when requests are added or completed
+      std::condition_variable mCondition;
+      bool mStop;
+      std::deque< std::shared_ptr<Request> > mQueue;
+      std::unordered_map< std::string , std::shared_ptr<Request> > mRequests;
+      std::vector< std::thread > mThreads;
+  };
+
+
+  NodeTreeBuilder::Prefetcher::Prefetcher ( const NodeTreeBuilder& aBuilder , const size_t aNrThreads ) :
+    mBuilder ( aBuilder ),
+    mStop ( false )
+  {
+    for ( const auto& lNode : aBuilder.mNodes )
+    {
+      mKnownFiles.insert ( lNode.first );
+    }
+
+    for ( size_t i = 0; i != aNrThreads; ++i )
+    {
+      mThreads.push_back ( std::thread ( [this] () { run(); } ) );
+    }
+  }
+
+
+  NodeTreeBuilder::Prefetcher::~Prefetcher()
+  {
+    {
+      std::lock_guard<std::mutex> lLock ( mMutex );
+      mStop = true;
+    }
+    mCondition.notify_all();
+
+    for ( std::thread& lThread : mThreads )
+    {
+      lThread.join();
+    }
+  }
+
+
+  std::string NodeTreeBuilder::Prefetcher::getKey ( const std::string& aProtocol , const std::string& aFilenameExpr , const boost::filesystem::path& aParentPath )
+  {
+    return aProtocol + "|" + aParentPath.string() + "|" + aFilenameExpr;
+  }
+
+
+  void NodeTreeBuilder::Prefetcher::request ( const std::string& aProtocol , const std::string& aFilenameExpr , const boost::filesystem::path& aParentPath )
+  {
+    std::lock_guard<std::mutex> lLock ( mMutex );
+    std::shared_ptr<Request>& lRequest = mRequests [ getKey ( aProtocol , aFilenameExpr , aParentPath ) ];
+
+    if ( lRequest )
+    {
+      return;
+    }
+
+    lRequest.reset ( new Request() );
+    lRequest->mProtocol = aProtocol;
+    lRequest->mFilenameExpr = aFilenameExpr;
+    lRequest->mParentPath = aParentPath;
+    lRequest->mStarted = false;
+    lRequest->mDone = false;
+    mQueue.push_back ( lRequest );
+    mCondition.notify_one();
+  }
+
+
+  bool NodeTreeBuilder::Prefetcher::get ( const std::string& aProtocol , const std::string& aFilenameExpr , const boost::filesystem::path& aParentPath , std::vector< std::shared_ptr<AddressFile> >& aFiles )
+  {
+    std::unique_lock<std::mutex> lLock ( mMutex );
+    std::unordered_map< std::string , std::shared_ptr<Request> >::const_iterator lIt = mRequests.find ( getKey ( aProtocol , aFilenameExpr , aParentPath ) );
+
+    if ( lIt == mRequests.end() )
+    {
+      return false;
+    }
+
+    std::shared_ptr<Request> lRequest ( lIt->second );
+
+    if ( not lRequest->mStarted )
+    {
+      // No thread has got to these files yet, so read them here rather than waiting
+      lRequest->mStarted = true;
+      lLock.unlock();
+      load ( *lRequest );
+      lLock.lock();
+    }
+
+    mCondition.wait ( lLock , [&lRequest] () { return lRequest->mDone; } );
+
+    if ( lRequest->mException )
+    {
+      std::rethrow_exception ( lRequest->mException );
+    }
+
+    aFiles = lRequest->mFiles;
+    return true;
+  }
+
+
+  void NodeTreeBuilder::Prefetcher::run()
+  {
+    std::unique_lock<std::mutex> lLock ( mMutex );
+
+    while ( true )
+    {
+      mCondition.wait ( lLock , [this] () { return mStop or not mQueue.empty(); } );
+
+      if ( mStop )
+      {
+        return;
+      }
+
+      std::shared_ptr<Request> lRequest ( mQueue.front() );
+      mQueue.pop_front();
+
+      if ( lRequest->mStarted )
+      {
+        continue;
+      }
+
+      lRequest->mStarted = true;
+      lLock.unlock();
+      load ( *lRequest );
+      lLock.lock();
+    }
+  }
+
+
+  void NodeTreeBuilder::Prefetcher::load ( Request& aRequest )
+  {
+    std::vector< std::shared_ptr<AddressFile> > lFiles;
+    std::exception_ptr lException;
+
+    try
+    {
+      uhal::utilities::OpenFile ( aRequest.mProtocol , aRequest.mFilenameExpr , aRequest.mParentPath , [this, &lFiles] ( const std::string& aProtocol , const boost::filesystem::path& aPath , std::vector<uint8_t>& aContent ) {
+        std::shared_ptr<AddressFile> lFile ( new AddressFile() );
+        lFile->mProtocol = aProtocol;
+        lFile->mPath = aPath;
+        lFile->mContent.swap ( aContent );
+        lFile->mHash = hashBytes ( lFile->mContent.data() , lFile->mContent.size() );
+        lFiles.push_back ( lFile );
+
+        // Leave files that will not be parsed by the builder (already built, compiled version in cache, or not XML) for the builder to deal with
+        const std::string lName ( aProtocol + aPath.string() );
+        std::string lExtension ( aPath.extension().string().substr ( 0,4 ) );
+        boost::to_lower ( lExtension );
+
+        if ( ( lExtension != ".xml" ) or mKnownFiles.count ( lName ) )
+        {
+          return;
+        }
+
+        if ( ( not mBuilder.mCacheDirectory.empty() ) and ( aProtocol == "file" ) and boost::filesystem::exists ( mBuilder.getCachePath ( lName ) ) )
+        {
+          return;
+        }
+
+        lFile->mDocument.reset ( new pugi::xml_document() );
+        lFile->mParseResult = lFile->mDocument->load_buffer_inplace ( lFile->mContent.data() , lFile->mContent.size() );
+
+        if ( lFile->mParseResult )
+        {
+          std::vector<std::string> lModules;
+          findModules ( lFile->mDocument->child ( "node" ) , lModules );
+
+          for ( const std::string& lModule : lModules )
+          {
+            std::vector< std::pair<std::string, std::string> > lAddressFiles;
+            uhal::utilities::ParseSemicolonDelimitedUriList ( lModule , lAddressFiles );
+
+            if ( lAddressFiles.size() == 1 )
+            {
+              request ( lAddressFiles[0].first , lAddressFiles[0].second , aPath.parent_path() );
+            }
+          }
+        }
+      } );
+    }
+    catch ( ... )
+    {
+      lException = std::current_exception();
+    }
+
+    {
+      std::lock_guard<std::mutex> lLock ( mMutex );
+      aRequest.mFiles.swap ( lFiles );
+      aRequest.mException = lException;
+      aRequest.mDone = true;
+    }
+    mCondition.notify_all();
+  }
+
+
+
+  NodeTreeBuilder::NodeTreeBuilder () :
+    mNrThreads ( std::min<size_t> ( 4 , std::thread::hardware_concurrency() ) )
   {
     //------------------------------------------------------------------------------------------------------------------------
     Rule<Node*> lPlainNode;
@@ -128,6 +542,25 @@ namespace uhal
     mNodeParser.addRule ( lBitMask , std::bind ( &NodeTreeBuilder::bitmaskNodeCreator , this , true , arg::_1 ) );
     mNodeParser.addRule ( lModule , std::bind ( &NodeTreeBuilder::moduleNodeCreator , this , true , arg::_1 ) );
     //------------------------------------------------------------------------------------------------------------------------
+
+    if ( const char* lEnvVar = std::getenv ( "UHAL_ADDRESS_TABLE_CACHE" ) )
+    {
+      mCacheDirectory = lEnvVar;
+      log ( Info() , "Compiled address tables will be cached in directory " , Quote ( lEnvVar ) , " (from UHAL_ADDRESS_TABLE_CACHE environment variable)" );
+    }
+
+    if ( const char* lEnvVar = std::getenv ( "UHAL_ADDRESS_TABLE_THREADS" ) )
+    {
+      try
+      {
+        mNrThreads = boost::lexical_cast<size_t> ( lEnvVar );
+        log ( Info() , "Module files will be read and parsed in " , Integer ( mNrThreads ) , " threads (from UHAL_ADDRESS_TABLE_THREADS environment variable)" );
+      }
+      catch ( const boost::bad_lexical_cast& )
+      {
+        log ( Warning() , "Ignoring invalid value " , Quote ( lEnvVar ) , " of UHAL_ADDRESS_TABLE_THREADS environment variable" );
+      }
+    }
   }
 
 
@@ -161,7 +594,39 @@ namespace uhal
     }
 
     std::vector< const Node* > lNodes;
-    uhal::utilities::OpenFile ( lAddressFiles[0].first , lAddressFiles[0].second , aPath.parent_path() , std::bind ( &NodeTreeBuilder::CallBack, std::ref ( *this ) , arg::_1 , arg::_2 , arg::_3 , std::ref ( lNodes ) ) );
+    // The threads reading module files are stopped once the top-level node tree has been built
+    const bool lTopLevel ( mFileCallStack.empty() );
+
+    try
+    {
+      std::vector< std::shared_ptr<AddressFile> > lFiles;
+
+      if ( mPrefetcher and mPrefetcher->get ( lAddressFiles[0].first , lAddressFiles[0].second , aPath.parent_path() , lFiles ) )
+      {
+        for ( const std::shared_ptr<AddressFile>& lFile : lFiles )
+        {
+          addFile ( *lFile , lNodes );
+        }
+      }
+      else
+      {
+        uhal::utilities::OpenFile ( lAddressFiles[0].first , lAddressFiles[0].second , aPath.parent_path() , std::bind ( &NodeTreeBuilder::CallBack, std::ref ( *this ) , arg::_1 , arg::_2 , arg::_3 , std::ref ( lNodes ) ) );
+      }
+    }
+    catch ( ... )
+    {
+      if ( lTopLevel )
+      {
+        mPrefetcher.reset();
+      }
+
+      throw;
+    }
+
+    if ( lTopLevel )
+    {
+      mPrefetcher.reset();
+    }
 
     if ( lNodes.size() != 1 )
     {
@@ -180,6 +645,31 @@ namespace uhal
     for(const auto& x: mNodes)
       delete x.second;
     mNodes.clear();
+    mFileDependencies.clear();
+  }
+
+
+  void NodeTreeBuilder::setCacheDirectory ( const boost::filesystem::path& aDirectory )
+  {
+    mCacheDirectory = aDirectory;
+  }
+
+
+  const boost::filesystem::path& NodeTreeBuilder::getCacheDirectory() const
+  {
+    return mCacheDirectory;
+  }
+
+
+  void NodeTreeBuilder::setNumberOfThreads ( size_t aNrThreads )
+  {
+    mNrThreads = aNrThreads;
+  }
+
+
+  size_t NodeTreeBuilder::getNumberOfThreads() const
+  {
+    return mNrThreads;
   }
 
 
@@ -190,6 +680,7 @@ namespace uhal
     mFileCallStack.pop_back( );
     calculateHierarchicalAddresses ( lNode , 0x00000000 );
     checkForAddressCollisions ( lNode , aAddressFilePath );  // Needs further investigation - disabled for now as it causes exceptions with valid tables.
+    lNode->indexDescendants();
 
     return lNode;
   }
@@ -197,40 +688,102 @@ namespace uhal
 
   void NodeTreeBuilder::CallBack ( const std::string& aProtocol , const boost::filesystem::path& aPath , std::vector<uint8_t>& aFile , std::vector< const Node* >& aNodes )
   {
-    std::string lName ( aProtocol + ( aPath.string() ) );
+    AddressFile lFile;
+    lFile.mProtocol = aProtocol;
+    lFile.mPath = aPath;
+    lFile.mContent.swap ( aFile );
+    // The buffer is modified when parsed in place, so must be hashed first
+    lFile.mHash = hashBytes ( lFile.mContent.data() , lFile.mContent.size() );
+    addFile ( lFile , aNodes );
+  }
+
+
+  void NodeTreeBuilder::addFile ( AddressFile& aFile , std::vector< const Node* >& aNodes )
+  {
+    const boost::filesystem::path& lPath ( aFile.mPath );
+    std::string lName ( aFile.mProtocol + ( lPath.string() ) );
     std::unordered_map< std::string , const Node* >::iterator lNodeIt = mNodes.find ( lName );
 
     if ( lNodeIt != mNodes.end() )
     {
+      addDependencies ( mFileDependencies [ lName ] );
       aNodes.push_back ( lNodeIt->second );
       return;
     }
 
-    std::string lExtension ( aPath.extension().string().substr ( 0,4 ) );
+    std::string lExtension ( lPath.extension().string().substr ( 0,4 ) );
     boost::to_lower ( lExtension ); //just in case someone decides to use capitals in their file extensions.
 
     if ( lExtension == ".xml" )
     {
-      log ( Info() , "Reading XML address file " , Quote( aPath.c_str() ) );
-      pugi::xml_document lXmlDocument;
-      pugi::xml_parse_result lLoadResult = lXmlDocument.load_buffer_inplace ( & ( aFile[0] ) , aFile.size() );
+      const uint64_t lHash ( aFile.mHash );
 
-      if ( !lLoadResult )
+      if ( ( not mCacheDirectory.empty() ) and ( aFile.mProtocol == "file" ) )
       {
-        uhal::utilities::PugiXMLParseResultPrettifier ( lLoadResult , aPath , aFile );
+        FileDependencies lDependencies;
+
+        if ( Node* lNode = loadCachedNodeTree ( lName , lHash , lDependencies ) )
+        {
+          log ( Info() , "Loaded compiled address table for file " , Quote( lPath.c_str() ) , " from " , Quote ( getCachePath ( lName ).c_str() ) );
+          mNodes.insert ( std::make_pair ( lName , lNode ) );
+          mFileDependencies [ lName ] = lDependencies;
+          addDependencies ( lDependencies );
+          aNodes.push_back ( lNode );
+          return;
+        }
+      }
+
+      log ( Info() , "Reading XML address file " , Quote( lPath.c_str() ) );
+
+      if ( not aFile.mDocument )
+      {
+        aFile.mDocument.reset ( new pugi::xml_document() );
+        aFile.mParseResult = aFile.mDocument->load_buffer_inplace ( aFile.mContent.data() , aFile.mContent.size() );
+      }
+
+      if ( !aFile.mParseResult )
+      {
+        uhal::utilities::PugiXMLParseResultPrettifier ( aFile.mParseResult , lPath , aFile.mContent );
         return;
       }
 
-      pugi::xml_node lXmlNode = lXmlDocument.child ( "node" );
+      pugi::xml_node lXmlNode = aFile.mDocument->child ( "node" );
 
       if ( !lXmlNode )
       {
-        log ( Error() , "No XML node called ", Quote ( "node" ) , " in file " , aPath.c_str() );
+        log ( Error() , "No XML node called ", Quote ( "node" ) , " in file " , lPath.c_str() );
         return;
       }
 
-      Node* lNode ( build ( lXmlNode , aPath ) );
+      prefetchModules ( lXmlNode , lPath );
+
+      mDependencyStack.push_back ( FileDependencies ( 1 , std::make_pair ( lName , lHash ) ) );
+      Node* lNode ( NULL );
+
+      try
+      {
+        lNode = build ( lXmlNode , lPath );
+      }
+      catch ( ... )
+      {
+        mDependencyStack.pop_back();
+        throw;
+      }
+
+      FileDependencies lDependencies;
+      lDependencies.swap ( mDependencyStack.back() );
+      mDependencyStack.pop_back();
+      std::sort ( lDependencies.begin() , lDependencies.end() );
+      lDependencies.erase ( std::unique ( lDependencies.begin() , lDependencies.end() ) , lDependencies.end() );
+
+      if ( ( not mCacheDirectory.empty() ) and ( aFile.mProtocol == "file" ) )
+      {
+        writeCachedNodeTree ( lName , *lNode , lDependencies );
+      }
+
       mNodes.insert ( std::make_pair ( lName , lNode ) );
+      mFileDependencies [ lName ] = lDependencies;
+      addDependencies ( lDependencies );
       aNodes.push_back ( lNode );
       return;
     }
@@ -263,9 +816,9 @@ namespace uhal
     //setMask( aXmlNode , lNode );
     setModeAndSize ( aXmlNode , lNode );
     addChildren ( aXmlNode , lNode );
-    log ( Debug() , lNode->mUid , " built by " , __PRETTY_FUNCTION__ );
+    log ( Debug() , lNode->mAttributes->mUid , " built by " , __PRETTY_FUNCTION__ );
 
-    if ( lNode->mClassName.size() )
+    if ( lNode->mAttributes->mClassName.size() )
     {
       return DerivedNodeFactory::getInstance().convertToClassType ( lNode );
     }
@@ -280,6 +833,8 @@ namespace uhal
     std::string lModule;
     uhal::utilities::GetXMLattribute<false> ( aXmlNode , NodeTreeBuilder::mModuleAttribute , lModule );
     Node* lNode ( getNodeTree ( lModule , mFileCallStack.back( ) ) );
+    // Paths are indexed from the top of the tree that the module is included in, not from the module itself
+    lNode->clearDescendantIndex();
     setUid ( aRequireId , aXmlNode , lNode );
     setAddr ( aXmlNode , lNode );
     setClassName ( aXmlNode , lNode );
@@ -292,9 +847,9 @@ namespace uhal
     //setMask( aXmlNode , lNode );
     //setModeAndSize( aXmlNode , lNode );
     //addChildren( aXmlNode , lNode );
-    log ( Debug() , lNode->mUid , " built by " , __PRETTY_FUNCTION__ );
+    log ( Debug() , lNode->mAttributes->mUid , " built by " , __PRETTY_FUNCTION__ );
 
-    if ( lNode->mClassName.size() )
+    if ( lNode->mAttributes->mClassName.size() )
     {
       return DerivedNodeFactory::getInstance().convertToClassType ( lNode );
     }
@@ -327,7 +882,7 @@ namespace uhal
     setMask ( aXmlNode , lNode );
     //setModeAndSize( aXmlNode , lNode );
     //addChildren( aXmlNode , lNode );
-    log ( Debug() , lNode->mUid , " built by " , __PRETTY_FUNCTION__ );
+    log ( Debug() , lNode->mAttributes->mUid , " built by " , __PRETTY_FUNCTION__ );
     return lNode;
   }
 
@@ -336,7 +891,7 @@ namespace uhal
 
   void NodeTreeBuilder::setUid ( const bool& aRequireId , const pugi::xml_node& aXmlNode , Node* aNode )
   {
-    const bool lHasId = uhal::utilities::GetXMLattribute<false> ( aXmlNode , NodeTreeBuilder::mIdAttribute , aNode->mUid );
+    const bool lHasId = uhal::utilities::GetXMLattribute<false> ( aXmlNode , NodeTreeBuilder::mIdAttribute , aNode->modifyAttributes().mUid );
 
     if ( aRequireId and ( not lHasId ) )
     {
@@ -346,12 +901,12 @@ namespace uhal
 
     if ( lHasId )
     {
-      if ( aNode->mUid.empty() )
+      if ( aNode->mAttributes->mUid.empty() )
         throw exception::NodeAttributeIncorrectValue("Invalid node ID specified (empty)");
-      else if ( aNode->mUid.find('.') != std::string::npos )
-        throw exception::NodeAttributeIncorrectValue("Invalid node ID '" + aNode->mUid + "' specified (contains dots)");
-      else if ( ( aNode->mUid.at(0) == ' ' ) or ( aNode->mUid.at(aNode->mUid.size()-1) == ' ' ) )
-        throw exception::NodeAttributeIncorrectValue("Invalid node ID '" + aNode->mUid + "' specified (contains spaces)");
+      else if ( aNode->mAttributes->mUid.find('.') != std::string::npos )
+        throw exception::NodeAttributeIncorrectValue("Invalid node ID '" + aNode->mAttributes->mUid + "' specified (contains dots)");
+      else if ( ( aNode->mAttributes->mUid.at(0) == ' ' ) or ( aNode->mAttributes->mUid.at(aNode->mAttributes->mUid.size()-1) == ' ' ) )
+        throw exception::NodeAttributeIncorrectValue("Invalid node ID '" + aNode->mAttributes->mUid + "' specified (contains spaces)");
     }
   }
 
@@ -360,7 +915,7 @@ namespace uhal
     //Address is an optional attribute for hierarchical addressing
     uint32_t lAddr ( 0 );
     uhal::utilities::GetXMLattribute<false> ( aXmlNode , NodeTreeBuilder::mAddressAttribute , lAddr );
-    aNode->mPartialAddr |= lAddr;
+    aNode->modifyAttributes().mPartialAddr |= lAddr;
   }
 
 
@@ -370,7 +925,7 @@ namespace uhal
     std::string lClassStr;
     uhal::utilities::GetXMLattribute<false> ( aXmlNode , NodeTreeBuilder::mClassAttribute , lClassStr );
 
-    aNode->mClassName = lClassStr;
+    aNode->modifyAttributes().mClassName = lClassStr;
   }
 
   void NodeTreeBuilder::setPars ( const pugi::xml_node& aXmlNode , Node* aNode )
@@ -388,9 +943,9 @@ namespace uhal
       boost::spirit::qi::phrase_parse ( lBegin , lEnd , mNodeTreeParametersGrammar , boost::spirit::ascii::space , lPars );
       // Update the parameters map
       // Add to lPars those previously defined (module node)
-      lPars.insert ( aNode->mParameters.begin(), aNode->mParameters.end() );
+      lPars.insert ( aNode->mAttributes->mParameters.begin(), aNode->mAttributes->mParameters.end() );
       // Swap the containers
-      aNode->mParameters.swap ( lPars );
+      aNode->modifyAttributes().mParameters.swap ( lPars );
     }
   }
 
@@ -400,15 +955,15 @@ namespace uhal
     //Tags is an optional attribute to allow the user to add a description to a node
     uhal::utilities::GetXMLattribute<false> ( aXmlNode , NodeTreeBuilder::mTagsAttribute , lStr );
 
-    if ( lStr.size() && aNode->mTags.size() )
+    if ( lStr.size() && aNode->mAttributes->mTags.size() )
     {
-      aNode->mTags += "[";
-      aNode->mTags += lStr;
-      aNode->mTags += "]";
+      aNode->modifyAttributes().mTags += "[";
+      aNode->modifyAttributes().mTags += lStr;
+      aNode->modifyAttributes().mTags += "]";
     }
-    else if ( lStr.size() && !aNode->mTags.size() )
+    else if ( lStr.size() && !aNode->mAttributes->mTags.size() )
     {
-      aNode->mTags = lStr;
+      aNode->modifyAttributes().mTags = lStr;
     }
   }
 
@@ -419,15 +974,15 @@ namespace uhal
     //Tags is an optional attribute to allow the user to add a description to a node
     uhal::utilities::GetXMLattribute<false> ( aXmlNode , NodeTreeBuilder::mDescriptionAttribute , lStr );
 
-    if ( lStr.size() && aNode->mDescription.size() )
+    if ( lStr.size() && aNode->mAttributes->mDescription.size() )
     {
-      aNode->mDescription += "[";
-      aNode->mDescription += lStr;
-      aNode->mDescription += "]";
+      aNode->modifyAttributes().mDescription += "[";
+      aNode->modifyAttributes().mDescription += lStr;
+      aNode->modifyAttributes().mDescription += "]";
     }
-    else if ( lStr.size() && !aNode->mDescription.size() )
+    else if ( lStr.size() && !aNode->mAttributes->mDescription.size() )
     {
-      aNode->mDescription = lStr;
+      aNode->modifyAttributes().mDescription = lStr;
     }
   }
 
@@ -435,7 +990,7 @@ namespace uhal
   {
     if ( mFileCallStack.size() )
     {
-      aNode->mModule = mFileCallStack.back( ).string();
+      aNode->modifyAttributes().mModule = mFileCallStack.back( ).string();
     }
   }
 
@@ -449,10 +1004,10 @@ namespace uhal
       const defs::NodePermission* const lPermission = mPermissionsLut.find(lPermissionAttr.c_str());
       if (lPermission == NULL)
       {
-        throw exception::NodeAttributeIncorrectValue("Permission attribute for node with ID '" + aNode->mUid + "' has incorrect value '" + lPermissionAttr + "'");
+        throw exception::NodeAttributeIncorrectValue("Permission attribute for node with ID '" + aNode->mAttributes->mUid + "' has incorrect value '" + lPermissionAttr + "'");
       }
       else
-        aNode->mPermission = *lPermission;
+        aNode->modifyAttributes().mPermission = *lPermission;
     }
   }
 
@@ -460,7 +1015,7 @@ namespace uhal
   void NodeTreeBuilder::setMask ( const pugi::xml_node& aXmlNode , Node* aNode )
   {
     //Tags is an optional attribute to allow the user to add a description to a node
-    uhal::utilities::GetXMLattribute<false> ( aXmlNode , NodeTreeBuilder::mMaskAttribute , aNode->mMask );
+    uhal::utilities::GetXMLattribute<false> ( aXmlNode , NodeTreeBuilder::mMaskAttribute , aNode->modifyAttributes().mMask );
   }
 
 
@@ -474,33 +1029,33 @@ namespace uhal
       const defs::BlockReadWriteMode* const lMode = mModeLut.find(lModeAttr.c_str());
       if (lMode == NULL)
       {
-        throw exception::NodeAttributeIncorrectValue("Mode attribute for node with ID '" + aNode->mUid + "' has incorrect value '" + lModeAttr + "'");
+        throw exception::NodeAttributeIncorrectValue("Mode attribute for node with ID '" + aNode->mAttributes->mUid + "' has incorrect value '" + lModeAttr + "'");
       }
       else
-        aNode->mMode = *lMode;
+        aNode->modifyAttributes().mMode = *lMode;
 
-      if ( aNode->mMode == defs::INCREMENTAL )
+      if ( aNode->mAttributes->mMode == defs::INCREMENTAL )
       {
         //If a block is incremental it requires a size attribute
-        if ( ! uhal::utilities::GetXMLattribute<false> ( aXmlNode , NodeTreeBuilder::mSizeAttribute , aNode->mSize ) )
+        if ( ! uhal::utilities::GetXMLattribute<false> ( aXmlNode , NodeTreeBuilder::mSizeAttribute , aNode->modifyAttributes().mSize ) )
         {
           exception::IncrementalNodeRequiresSizeAttribute lExc;
-          log ( lExc , "Node " , Quote ( aNode->mUid ) , " has type " , Quote ( "INCREMENTAL" ) , ", which requires a " , Quote ( NodeTreeBuilder::mSizeAttribute ) , " attribute" );
+          log ( lExc , "Node " , Quote ( aNode->mAttributes->mUid ) , " has type " , Quote ( "INCREMENTAL" ) , ", which requires a " , Quote ( NodeTreeBuilder::mSizeAttribute ) , " attribute" );
           throw lExc;
         }
       }
-      else if ( aNode->mMode == defs::NON_INCREMENTAL )
+      else if ( aNode->mAttributes->mMode == defs::NON_INCREMENTAL )
       {
         //If a block is non-incremental, then a size attribute is recommended
-        if ( ! uhal::utilities::GetXMLattribute<false> ( aXmlNode , NodeTreeBuilder::mSizeAttribute , aNode->mSize ) )
+        if ( ! uhal::utilities::GetXMLattribute<false> ( aXmlNode , NodeTreeBuilder::mSizeAttribute , aNode->modifyAttributes().mSize ) )
         {
-          log ( Notice() , "Node " , Quote ( aNode->mUid ) , " has type " , Quote ( "NON_INCREMENTAL" ) , " but does not have a " , Quote ( NodeTreeBuilder::mSizeAttribute ) , " attribute. This is not necessarily a problem, but if there is a limit to the size of the read/write operation from this port, then please consider adding this attribute for the sake of safety." );
+          log ( Notice() , "Node " , Quote ( aNode->mAttributes->mUid ) , " has type " , Quote ( "NON_INCREMENTAL" ) , " but does not have a " , Quote ( NodeTreeBuilder::mSizeAttribute ) , " attribute. This is not necessarily a problem, but if there is a limit to the size of the read/write operation from this port, then please consider adding this attribute for the sake of safety." );
         }
       }
     }
     else if ( not aXmlNode.attribute ( NodeTreeBuilder::mSizeAttribute.c_str() ).empty() )
     {
-      log ( Warning() , "Invalid combination of attributes for node " , Quote ( aNode->mUid ) , ": Size attribute specified, but mode missing, hence size ignored. Please specify mode here or remove the size attribute. Address table parser will throw an exception for this in future releases.");
+      log ( Warning() , "Invalid combination of attributes for node " , Quote ( aNode->mAttributes->mUid ) , ": Size attribute specified, but mode missing, hence size ignored. Please specify mode here or remove the size attribute. Address table parser will throw an exception for this in future releases.");
     }
 
   }
@@ -518,11 +1073,11 @@ namespace uhal
       std::string::const_iterator lEnd ( lFwInfoStr.end() );
       NodeTreeFirmwareInfoAttribute lFwInfo;
       boost::spirit::qi::phrase_parse ( lBegin , lEnd , mNodeTreeFirmwareInfoAttributeGrammar , boost::spirit::ascii::space , lFwInfo );
-      aNode->mFirmwareInfo.insert ( make_pair ( "type",lFwInfo.mType ) );
+      aNode->modifyAttributes().mFirmwareInfo.insert ( make_pair ( "type",lFwInfo.mType ) );
 
       if ( lFwInfo.mArguments.size() )
       {
-        aNode->mFirmwareInfo.insert ( lFwInfo.mArguments.begin() , lFwInfo.mArguments.end() );
+        aNode->modifyAttributes().mFirmwareInfo.insert ( lFwInfo.mArguments.begin() , lFwInfo.mArguments.end() );
       }
     }
   }
@@ -532,12 +1087,12 @@ namespace uhal
   {
     pugi::xml_node lXmlNode = aXmlNode.child ( "node" );
 
-    if ( aNode->mMode == defs::NON_INCREMENTAL )
+    if ( aNode->mAttributes->mMode == defs::NON_INCREMENTAL )
     {
       if ( lXmlNode )
       {
         exception::BlockAccessNodeCannotHaveChild lExc;
-        log ( lExc , "Block access nodes are not allowed to have child nodes, but the node " , Quote ( aNode->mUid ) , " has a child node in the address table" );
+        log ( lExc , "Block access nodes are not allowed to have child nodes, but the node " , Quote ( aNode->mAttributes->mUid ) , " has a child node in the address table" );
         throw lExc;
       }
     }
@@ -545,21 +1100,18 @@ namespace uhal
     {
       for ( ; lXmlNode; lXmlNode = lXmlNode.next_sibling ( "node" ) )
       {
-        aNode->mChildren.push_back ( mNodeParser ( lXmlNode ) );
+        aNode->addChild ( mNodeParser ( lXmlNode ) );
       }
-
-      for (const auto& lChild: aNode->mChildren)
-        aNode->mChildrenMap.insert ( std::make_pair ( lChild->mUid , lChild ) );
     }
   }
 
   void NodeTreeBuilder::calculateHierarchicalAddresses ( Node* aNode , const uint32_t& aAddr )
   {
-    if ( aNode->mMode == defs::HIERARCHICAL )
+    if ( aNode->mAttributes->mMode == defs::HIERARCHICAL )
     {
       if ( aNode->mChildren.size() == 0 )
       {
-        aNode->mMode = defs::SINGLE;
+        aNode->modifyAttributes().mMode = defs::SINGLE;
       }
       else
       {
@@ -568,7 +1120,7 @@ namespace uhal
 
         for (Node* lChild: aNode->mChildren)
         {
-          if ( lChild->mMask == defs::NOMASK )
+          if ( lChild->mAttributes->mMask == defs::NOMASK )
             lAllMasked = false;
 
           // else
@@ -579,26 +1131,26 @@ namespace uhal
 
         // if( lAnyMasked && !lAllMasked )
         // {
-        // log ( Error() , "Both masked and unmasked children found in branch " , Quote ( aNode->mUid ) );
+        // log ( Error() , "Both masked and unmasked children found in branch " , Quote ( aNode->mAttributes->mUid ) );
         // throw exception::// BothMaskedAndUnmaskedChildren();
         // }
 
         if ( lAllMasked )
         {
-          aNode->mMode = defs::SINGLE;
+          aNode->modifyAttributes().mMode = defs::SINGLE;
         }
       }
     }
 
-    if ( aNode->mMode == defs::INCREMENTAL )
+    if ( aNode->mAttributes->mMode == defs::INCREMENTAL )
     {
-      uint64_t lTopAddr ( ( uint64_t ) ( aNode->mPartialAddr ) + ( uint64_t ) ( aNode->mSize-1 ) );
+      uint64_t lTopAddr ( ( uint64_t ) ( aNode->mAttributes->mPartialAddr ) + ( uint64_t ) ( aNode->mAttributes->mSize-1 ) );
 
       //Check that the requested block size does not extend outside register space
       if ( lTopAddr >> 32 )
       {
         exception::ArraySizeExceedsRegisterBound lExc;
-        log ( lExc , "A block size of " , Integer ( aNode->mSize ) , " and a base address of " , Integer ( aNode->mAddr , IntFmt<hex,fixed>() ) , " exceeds bounds of address space" );
+        log ( lExc , "A block size of " , Integer ( aNode->mAttributes->mSize ) , " and a base address of " , Integer ( aNode->mAttributes->mAddr , IntFmt<hex,fixed>() ) , " exceeds bounds of address space" );
         throw lExc;
       }
 
@@ -606,29 +1158,36 @@ namespace uhal
             //Test for overlap with parent
             if ( ( uint32_t ) ( lTopAddr ) & aAddr ) //should set the most significant bit of the child address and then AND this with the parent address
             {
-              log ( Warning() , "The partial address of the top register in the current branch, " , Quote ( aNode->mUid ) , " , (" , Integer ( ( uint32_t ) ( lTopAddr ) , IntFmt<hex,fixed>() ) , ") overlaps with the partial address of the parent branch (" , Integer ( aAddr , IntFmt<hex,fixed>() ) , "). This might contradict the hierarchical design principal. For now this is a warning, but in the future this may be upgraded to throw an exception." );
+              log ( Warning() , "The partial address of the top register in the current branch, " , Quote ( aNode->mAttributes->mUid ) , " , (" , Integer ( ( uint32_t ) ( lTopAddr ) , IntFmt<hex,fixed>() ) , ") overlaps with the partial address of the parent branch (" , Integer ( aAddr , IntFmt<hex,fixed>() ) , "). This might contradict the hierarchical design principal. For now this is a warning, but in the future this may be upgraded to throw an exception." );
             }
 
           }
           else
           {
             //Test for overlap with parent
-            if ( aNode->mPartialAddr & aAddr ) //should set the most significant bit of the child address and then AND this with the parent address
+            if ( aNode->mAttributes->mPartialAddr & aAddr ) //should set the most significant bit of the child address and then AND this with the parent address
             {
-              log ( Warning() , "The partial address of the top register in the current branch, " , Quote ( aNode->mUid ) , " , (" , Integer ( aNode->mPartialAddr , IntFmt<hex,fixed>() ) , ") overlaps with the partial address of the parent branch (" , Integer ( aAddr , IntFmt<hex,fixed>() ) , "). This might contradict the hierarchical design principal. For now this is a warning, but in the future this may be upgraded to throw an exception." );
+              log ( Warning() , "The partial address of the top register in the current branch, " , Quote ( aNode->mAttributes->mUid ) , " , (" , Integer ( aNode->mAttributes->mPartialAddr , IntFmt<hex,fixed>() ) , ") overlaps with the partial address of the parent branch (" , Integer ( aAddr , IntFmt<hex,fixed>() ) , "). This might contradict the hierarchical design principal. For now this is a warning, but in the future this may be upgraded to throw an exception." );
             }
       */
     }
 
-    aNode->mAddr = aNode->mPartialAddr + aAddr;
+    const uint32_t lAddr ( aNode->mAttributes->mPartialAddr + aAddr );
+
+    // Only copy the attributes (if shared) when the address actually changes, e.g. not when a cached module is placed at the same address again
+    if ( aNode->mAttributes->mAddr != lAddr )
+    {
+      aNode->modifyAttributes().mAddr = lAddr;
+    }
 
     for (Node* lChild: aNode->mChildren)
     {
       lChild->mParent = aNode;
-      calculateHierarchicalAddresses ( lChild , aNode->mAddr );
+      calculateHierarchicalAddresses ( lChild , aNode->mAttributes->mAddr );
     }
 
     std::sort ( aNode->mChildren.begin() , aNode->mChildren.end() , detail::compareNodeAddr );
+    aNode->indexChildren();
   }
 
 
@@ -686,6 +1245,287 @@ namespace uhal
   }
 
 
+  void NodeTreeBuilder::prefetchModules ( const pugi::xml_node& aXmlNode , const boost::filesystem::path& aPath )
+  {
+    if ( ( not mPrefetcher ) and mFileCallStack.empty() and ( mNrThreads > 0 ) )
+    {
+      mPrefetcher.reset ( new Prefetcher ( *this , mNrThreads ) );
+    }
+
+    if ( not mPrefetcher )
+    {
+      return;
+    }
+
+    std::vector<std::string> lModules;
+    findModules ( aXmlNode , lModules );
+
+    for ( const std::string& lModule : lModules )
+    {
+      std::vector< std::pair<std::string, std::string> > lAddressFiles;
+      uhal::utilities::ParseSemicolonDelimitedUriList ( lModule , lAddressFiles );
+
+      // Invalid expressions are reported when the module node is built
+      if ( lAddressFiles.size() == 1 )
+      {
+        mPrefetcher->request ( lAddressFiles[0].first , lAddressFiles[0].second , aPath.parent_path() );
+      }
+    }
+  }
+
+
+  void NodeTreeBuilder::addDependencies ( const FileDependencies& aDependencies )
+  {
+    if ( not mDependencyStack.empty() )
+    {
+      mDependencyStack.back().insert ( mDependencyStack.back().end() , aDependencies.begin() , aDependencies.end() );
+    }
+  }
+
+
+  boost::filesystem::path NodeTreeBuilder::getCachePath ( const std::string& aName ) const
+  {
+    // File name includes the stem of the address file for readability, and a hash of the full name for uniqueness
+    std::ostringstream lFilename;
+    lFilename << boost::filesystem::path ( aName ).stem().string() << "-" << std::hex << std::setw ( 16 ) << std::setfill ( '0' );
+    lFilename << hashBytes ( reinterpret_cast<const uint8_t*> ( aName.data() ) , aName.size() ) << ".uhalcache";
+    return mCacheDirectory / lFilename.str();
+  }
+
+
+  Node* NodeTreeBuilder::loadCachedNodeTree ( const std::string& aName , const uint64_t aHash , FileDependencies& aDependencies )
+  {
+    const boost::filesystem::path lCachePath ( getCachePath ( aName ) );
+    const int lFd = open ( lCachePath.c_str() , O_RDONLY );
+
+    if ( lFd < 0 )
+    {
+      return NULL;
+    }
+
+    struct stat lStat;
+
+    if ( ( fstat ( lFd , &lStat ) != 0 ) or ( lStat.st_size == 0 ) )
+    {
+      close ( lFd );
+      return NULL;
+    }
+
+    void* lMapping = mmap ( NULL , lStat.st_size , PROT_READ , MAP_PRIVATE , lFd , 0 );
+    close ( lFd );
+
+    if ( lMapping == MAP_FAILED )
+    {
+      log ( Warning() , "Failed to map compiled address table file " , Quote ( lCachePath.c_str() ) , " (errno=" , Integer ( errno ) , ")" );
+      return NULL;
+    }
+
+    const ScopedMapping lMappingGuard ( lMapping , lStat.st_size );
+    const uint8_t* lPtr = static_cast<const uint8_t*> ( lMapping );
+    const uint8_t* lEnd = lPtr + lStat.st_size;
+    Node* lNode ( NULL );
+
+    try
+    {
+      checkRemaining ( lPtr , lEnd , sizeof ( kCacheMagic ) );
+
+      if ( memcmp ( lPtr , kCacheMagic , sizeof ( kCacheMagic ) ) != 0 )
+      {
+        throw exception::CorruptAddressTableCache ( "Compiled address table file has an unknown format" );
+      }
+
+      lPtr += sizeof ( kCacheMagic );
+      const uint32_t lNrDependencies ( getValue<uint32_t> ( lPtr , lEnd ) );
+      bool lUpToDate ( true );
+
+      for ( uint32_t i = 0; i != lNrDependencies; ++i )
+      {
+        const std::string lName ( getString ( lPtr , lEnd ) );
+        const uint64_t lExpectedHash ( getValue<uint64_t> ( lPtr , lEnd ) );
+        uint64_t lHash ( aHash );
+
+        if ( lName != aName )
+        {
+          // Only local files are written to the cache, so the name is "file" followed by the path
+          if ( ( lName.compare ( 0 , 4 , "file" ) != 0 ) or ( not hashFile ( lName.substr ( 4 ) , lHash ) ) )
+          {
+            lUpToDate = false;
+            break;
+          }
+        }
+
+        if ( lHash != lExpectedHash )
+        {
+          log ( Info() , "Compiled address table " , Quote ( lCachePath.c_str() ) , " is out of date, since " , Quote ( lName.substr ( 4 ) ) , " has changed" );
+          lUpToDate = false;
+          break;
+        }
+
+        aDependencies.push_back ( std::make_pair ( lName , lExpectedHash ) );
+      }
+
+      if ( lUpToDate )
+      {
+        lNode = readCachedNode ( lPtr , lEnd );
+
+        if ( lPtr != lEnd )
+        {
+          throw exception::CorruptAddressTableCache ( "Compiled address table file has trailing data" );
+        }
+
+        lNode->indexDescendants();
+      }
+    }
+    catch ( const std::exception& aExc )
+    {
+      // The cache is only an optimisation, so whatever the problem with the file (e.g. corrupt contents, or a derived node class
+      // which no longer exists), fall back to parsing the XML files
+      log ( Warning() , "Ignoring compiled address table file " , Quote ( lCachePath.c_str() ) , ": " , aExc.what() );
+      delete lNode;
+      lNode = NULL;
+    }
+
+    if ( not lNode )
+    {
+      aDependencies.clear();
+    }
+
+    return lNode;
+  }
+
+
+  void NodeTreeBuilder::writeCachedNodeTree ( const std::string& aName , const Node& aNode , const FileDependencies& aDependencies )
+  {
+    for ( const auto& lDependency : aDependencies )
+    {
+      // Files loaded over HTTP cannot be checked for changes without downloading them, so are not cached
+      if ( lDependency.first.compare ( 0 , 4 , "file" ) != 0 )
+      {
+        return;
+      }
+    }
+
+    std::string lBuffer ( kCacheMagic , sizeof ( kCacheMagic ) );
+    putValue<uint32_t> ( lBuffer , aDependencies.size() );
+
+    for ( const auto& lDependency : aDependencies )
+    {
+      putString ( lBuffer , lDependency.first );
+      putValue<uint64_t> ( lBuffer , lDependency.second );
+    }
+
+    if ( ! writeCachedNode ( aNode , lBuffer ) )
+    {
+      return;
+    }
+
+    const boost::filesystem::path lCachePath ( getCachePath ( aName ) );
+    // Written to a temporary file and then renamed, so that concurrent processes never see a partial file
+    const boost::filesystem::path lTempPath ( lCachePath.string() + "." + std::to_string ( getpid() ) + ".tmp" );
+
+    try
+    {
+      boost::filesystem::create_directories ( mCacheDirectory );
+      std::ofstream lStr ( lTempPath.c_str() , std::ios::binary | std::ios::trunc );
+      lStr.write ( lBuffer.data() , lBuffer.size() );
+      lStr.close();
+
+      if ( !lStr )
+      {
+        log ( Warning() , "Failed to write compiled address table file " , Quote ( lTempPath.c_str() ) );
+        boost::filesystem::remove ( lTempPath );
+        return;
+      }
+
+      boost::filesystem::rename ( lTempPath , lCachePath );
+      log ( Info() , "Wrote compiled address table file " , Quote ( lCachePath.c_str() ) );
+    }
+    catch ( const boost::filesystem::filesystem_error& e )
+    {
+      log ( Warning() , "Failed to write compiled address table file " , Quote ( lCachePath.c_str() ) , "; caught filesystem_error exception with what returning:  ", e.what() );
+    }
+  }
+
+
+  bool NodeTreeBuilder::writeCachedNode ( const Node& aNode , std::string& aBuffer )
+  {
+    const std::string lClassName ( DerivedNodeFactory::getInstance().getClassName ( aNode ) );
+
+    if ( lClassName.empty() and ( typeid ( aNode ) != typeid ( Node ) ) )
+    {
+      log ( Info() , "Not caching address table containing node " , Quote ( aNode.getPath() ) , " since the type of this derived node cannot be identified" );
+      return false;
+    }
+
+    putString ( aBuffer , aNode.mAttributes->mUid );
+    putValue<uint32_t> ( aBuffer , aNode.mAttributes->mPartialAddr );
+    putValue<uint32_t> ( aBuffer , aNode.mAttributes->mAddr );
+    putValue<uint32_t> ( aBuffer , aNode.mAttributes->mMask );
+    putValue<uint32_t> ( aBuffer , aNode.mAttributes->mPermission );
+    putValue<uint32_t> ( aBuffer , aNode.mAttributes->mMode );
+    putValue<uint32_t> ( aBuffer , aNode.mAttributes->mSize );
+    putString ( aBuffer , aNode.mAttributes->mTags );
+    putString ( aBuffer , aNode.mAttributes->mDescription );
+    putString ( aBuffer , aNode.mAttributes->mModule );
+    putString ( aBuffer , aNode.mAttributes->mClassName );
+    // Module nodes overwrite the class name of their top-level node, so the type of each node is stored separately
+    putString ( aBuffer , lClassName );
+    putMap ( aBuffer , aNode.mAttributes->mParameters );
+    putMap ( aBuffer , aNode.mAttributes->mFirmwareInfo );
+    putValue<uint32_t> ( aBuffer , aNode.mChildren.size() );
+
+    for ( const Node* lChild : aNode.mChildren )
+    {
+      if ( ! writeCachedNode ( *lChild , aBuffer ) )
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+
+  Node* NodeTreeBuilder::readCachedNode ( const uint8_t*& aPtr , const uint8_t* aEnd )
+  {
+    std::unique_ptr<Node> lNode ( new Node() );
+    Node::Attributes& lAttributes ( lNode->modifyAttributes() );
+    lAttributes.mUid = getString ( aPtr , aEnd );
+    lAttributes.mPartialAddr = getValue<uint32_t> ( aPtr , aEnd );
+    lAttributes.mAddr = getValue<uint32_t> ( aPtr , aEnd );
+    lAttributes.mMask = getValue<uint32_t> ( aPtr , aEnd );
+    lAttributes.mPermission = defs::NodePermission ( getValue<uint32_t> ( aPtr , aEnd ) );
+    lAttributes.mMode = defs::BlockReadWriteMode ( getValue<uint32_t> ( aPtr , aEnd ) );
+    lAttributes.mSize = getValue<uint32_t> ( aPtr , aEnd );
+    lAttributes.mTags = getString ( aPtr , aEnd );
+    lAttributes.mDescription = getString ( aPtr , aEnd );
+    lAttributes.mModule = getString ( aPtr , aEnd );
+    lAttributes.mClassName = getString ( aPtr , aEnd );
+    const std::string lDerivedClassName ( getString ( aPtr , aEnd ) );
+    getMap ( aPtr , aEnd , lAttributes.mParameters );
+    getMap ( aPtr , aEnd , lAttributes.mFirmwareInfo );
+
+    const uint32_t lNrChildren ( getValue<uint32_t> ( aPtr , aEnd ) );
+    // Each child occupies well over one byte, so this bounds the reservation for corrupt files
+    checkRemaining ( aPtr , aEnd , lNrChildren );
+    lNode->mChildren.reserve ( lNrChildren );
+
+    for ( uint32_t i = 0; i != lNrChildren; ++i )
+    {
+      lNode->addChild ( readCachedNode ( aPtr , aEnd ) );
+    }
+
+    if ( lDerivedClassName.size() )
+    {
+      return DerivedNodeFactory::getInstance().convertToClassType ( lNode.release() , lDerivedClassName );
+    }
+    else
+    {
+      return lNode.release();
+    }
+  }
+
+
   NodeTreeBuilder::permissions_lut::permissions_lut()
   {
     add
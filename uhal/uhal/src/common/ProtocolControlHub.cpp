@@ -158,6 +158,7 @@ namespace uhal
   template < typename InnerProtocol >
   ControlHub< InnerProtocol >::~ControlHub()
   {
+    ClientInterface::detachAsyncDispatches();
   }
 
 
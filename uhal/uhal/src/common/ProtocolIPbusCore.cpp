@@ -317,6 +317,18 @@ namespace uhal
 
 
   ValHeader IPbusCore::implementWriteBlock ( const uint32_t& aAddr, const std::vector< uint32_t >& aSource, const defs::BlockReadWriteMode& aMode )
+  {
+    return implementWriteBlock ( aAddr , aSource , aMode , std::shared_ptr< const std::vector< uint32_t > > () );
+  }
+
+
+  ValHeader IPbusCore::implementWriteBlockByReference ( const uint32_t& aAddr, const std::shared_ptr< const std::vector< uint32_t > >& aSource, const defs::BlockReadWriteMode& aMode )
+  {
+    return implementWriteBlock ( aAddr , *aSource , aMode , aSource );
+  }
+
+
+  ValHeader IPbusCore::implementWriteBlock ( const uint32_t& aAddr, const std::vector< uint32_t >& aSource, const defs::BlockReadWriteMode& aMode, const std::shared_ptr< const std::vector< uint32_t > >& aSourceOwner )
   {
     log ( Debug() , "Write block of size " , Integer ( aSource.size() ) , " to address " , Integer ( aAddr , IntFmt<hex,fixed>() ) );
     // IPbus packet format is:
@@ -345,7 +357,14 @@ namespace uhal
 
       lBuffers->send ( implementCalculateHeader ( lType , lSendBytesAvailableForPayload>>2 , mTransactionCounter++ , requestTransactionInfoCode() ) );
       lBuffers->send ( lAddr );
-      if ( aSource.size() > 0 )
+      if ( aSource.size() > 0 && aSourceOwner )
+      {
+        lBuffers->sendByReference ( lSourcePtr , lSendBytesAvailableForPayload );
+        lBuffers->add ( aSourceOwner );
+        lSourcePtr += lSendBytesAvailableForPayload;
+        lPayloadByteCount -= lSendBytesAvailableForPayload;
+      }
+      else if ( aSource.size() > 0 )
       {
         lBuffers->send ( lSourcePtr , lSendBytesAvailableForPayload );
         lSourcePtr += lSendBytesAvailableForPayload;
@@ -396,6 +415,23 @@ namespace uhal
 
 
   ValVector< uint32_t > IPbusCore::implementReadBlock ( const uint32_t& aAddr, const uint32_t& aSize, const defs::BlockReadWriteMode& aMode )
+  {
+    std::pair < ValVector<uint32_t> , _ValVector_<uint32_t>* > lReply ( CreateValVector ( aSize ) );
+    implementReadBlock ( aAddr , ( uint8_t* ) ( aSize == 0 ? NULL : & ( lReply.second->value.at(0) ) ) , aSize , aMode , lReply.first , *lReply.second );
+    return lReply.first;
+  }
+
+
+  ValHeader IPbusCore::implementReadBlockIntoBuffer ( const uint32_t& aAddr, uint32_t* aBuffer, const uint32_t& aSize, const defs::BlockReadWriteMode& aMode )
+  {
+    std::pair < ValHeader , _ValHeader_* > lReply ( CreateValHeader() );
+    implementReadBlock ( aAddr , ( uint8_t* ) ( aBuffer ) , aSize , aMode , lReply.first , *lReply.second );
+    return lReply.first;
+  }
+
+
+  template < typename T >
+  void IPbusCore::implementReadBlock ( const uint32_t& aAddr, uint8_t* aDestination, const uint32_t& aSize, const defs::BlockReadWriteMode& aMode, const T& aReply, _ValHeader_& aReplyMembers )
   {
     log ( Debug() , "Read unsigned block of size " , Integer ( aSize ) , " from address " , Integer ( aAddr , IntFmt<hex,fixed>() ) );
     // IPbus packet format is:
@@ -410,8 +446,7 @@ namespace uhal
     uint32_t lReplyHeaderByteCount ( 1 << 2 );
     uint32_t lSendBytesAvailable;
     uint32_t  lReplyBytesAvailable;
-    std::pair < ValVector<uint32_t> , _ValVector_<uint32_t>* > lReply ( CreateValVector ( aSize ) );
-    uint8_t* lReplyPtr = ( uint8_t* ) ( aSize == 0 ? NULL : & ( lReply.second->value.at(0) ) );
+    uint8_t* lReplyPtr = aDestination;
     IPbusTransactionType lType ( ( aMode == defs::INCREMENTAL ) ? READ : NI_READ );
     int32_t lPayloadByteCount ( aSize << 2 );
     uint32_t lAddr ( aAddr );
@@ -424,8 +459,8 @@ namespace uhal
       lBuffers->send ( implementCalculateHeader ( lType , lReplyBytesAvailableForPayload>>2 , mTransactionCounter++ , requestTransactionInfoCode()
                                                 ) );
       lBuffers->send ( lAddr );
-      lReply.second->IPbusHeaders.push_back ( 0 );
-      lBuffers->receive ( lReply.second->IPbusHeaders.back() );
+      aReplyMembers.IPbusHeaders.push_back ( 0 );
+      lBuffers->receive ( aReplyMembers.IPbusHeaders.back() );
       lBuffers->receive ( lReplyPtr , lReplyBytesAvailableForPayload );
       lReplyPtr += lReplyBytesAvailableForPayload;
       lPayloadByteCount -= lReplyBytesAvailableForPayload;
@@ -437,8 +472,7 @@ namespace uhal
     }
     while ( lPayloadByteCount > 0 );
 
-    lBuffers->add ( lReply.first ); //we store the valmem in the last chunk so that, if the reply is split over many chunks, the valmem is guaranteed to still exist when the other chunks come back...
-    return lReply.first;
+    lBuffers->add ( aReply ); //we store the valmem in the last chunk so that, if the reply is split over many chunks, the valmem is guaranteed to still exist when the other chunks come back...
   }
   //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -55,6 +55,9 @@
 #include <string.h>                                         // for memcpy
 #include <thread>
 #include <unistd.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include <boost/lexical_cast.hpp>
 #include <boost/date_time/posix_time/posix_time_types.hpp>  // for time_dura...
@@ -192,61 +195,119 @@ void Mmap::File::close()
 
 
 void Mmap::File::read(const uint32_t aAddr, const uint32_t aNrWords, std::vector<uint32_t>& aValues)
+{
+  const size_t lInitialSize = aValues.size();
+  aValues.resize(lInitialSize + aNrWords);
+  read(aAddr, reinterpret_cast<uint8_t*>(aValues.data() + lInitialSize), 4 * aNrWords);
+}
+
+
+void Mmap::File::read(const uint32_t aAddr, uint8_t* const aPtr, const size_t aNrBytes)
 {
   if (mFd == -1)
     open();
 
-  uint8_t* lVirtAddr = static_cast<uint8_t*>(mMmapIOPtr) + off_t(4*aAddr);
+  // Device memory is always read with aligned 32-bit loads; the destination need not be aligned
+  const uint32_t* lVirtAddr = reinterpret_cast<const uint32_t*>(static_cast<uint8_t*>(mMmapIOPtr) + off_t(4*aAddr));
+  const size_t lNrWholeWords = aNrBytes / 4;
 
-  for (size_t i=0; i<aNrWords; i++) {
-    aValues.push_back(*((uint32_t*) (lVirtAddr + 4 * i)));
+  for (size_t i = 0; i < lNrWholeWords; i++) {
+    const uint32_t lWord = lVirtAddr[i];
+    memcpy(aPtr + 4 * i, &lWord, 4);
+  }
+
+  if (aNrBytes % 4) {
+    const uint32_t lWord = lVirtAddr[lNrWholeWords];
+    memcpy(aPtr + 4 * lNrWholeWords, &lWord, aNrBytes % 4);
   }
 }
 
 
+namespace {
+
+//! Number of bytes written to device memory at once by storeBlock
+const size_t kStoreBlockSize = 64;
+
+/**
+  Copy a block of kStoreBlockSize bytes to device memory, using the widest stores available.
+  On x86, non-temporal stores are used if the destination is suitably aligned; since the device file is mapped uncached, these
+  don't change what the device sees, but they avoid the read-for-ownership, and an sfence is needed once the packet is complete
+  @return true if non-temporal stores were used
+*/
+inline bool storeBlock(uint8_t* const aDest, const uint8_t* const aSrc)
+{
+#ifdef __SSE2__
+  if ((reinterpret_cast<uintptr_t>(aDest) & 0xF) == 0) {
+    for (size_t i = 0; i < kStoreBlockSize; i += 16)
+      _mm_stream_si128(reinterpret_cast<__m128i*>(aDest + i), _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSrc + i)));
+    return true;
+  }
+#endif
+
+  for (size_t i = 0; i < kStoreBlockSize; i += 8) {
+    uint64_t lWord;
+    memcpy(&lWord, aSrc + i, 8);
+    *reinterpret_cast<uint64_t*>(aDest + i) = lWord;
+  }
+  return false;
+}
+
+}
+
+
 void Mmap::File::write(const uint32_t aAddr, const std::vector<std::pair<const uint8_t*, size_t> >& aData)
 {
   if (mFd == -1)
     open();
 
-  size_t lNrBytes = 0;
-  for (size_t i = 0; i < aData.size(); i++)
-    lNrBytes += aData.at(i).second;
+  uint8_t* lVirtAddr = static_cast<uint8_t*>(mMmapIOPtr) + aAddr;
+  bool lNonTemporalStoresUsed = false;
+
+  // Fragments are written straight to the page in whole blocks where possible; a small staging area on the stack joins
+  // fragment boundaries (and the packet's tail) into whole blocks / 64-bit words.
+  alignas(16) uint8_t lStaging[kStoreBlockSize];
+  size_t lNrBytesStaged = 0;
+
+  for (const auto& lFragment: aData) {
+    const uint8_t* lSrcPtr = lFragment.first;
+    size_t lNrBytesLeft = lFragment.second;
+
+    while (lNrBytesLeft > 0) {
+      if ((lNrBytesStaged == 0) and (lNrBytesLeft >= kStoreBlockSize)) {
+        lNonTemporalStoresUsed |= storeBlock(lVirtAddr, lSrcPtr);
+        lVirtAddr += kStoreBlockSize;
+        lSrcPtr += kStoreBlockSize;
+        lNrBytesLeft -= kStoreBlockSize;
+        continue;
+      }
 
-  assert((lNrBytes % 4) == 0);
+      const size_t lNrBytesToStage = std::min(kStoreBlockSize - lNrBytesStaged, lNrBytesLeft);
+      memcpy(lStaging + lNrBytesStaged, lSrcPtr, lNrBytesToStage);
+      lNrBytesStaged += lNrBytesToStage;
+      lSrcPtr += lNrBytesToStage;
+      lNrBytesLeft -= lNrBytesToStage;
 
-  char *allocated = NULL;
-  posix_memalign((void **)&allocated, 4096/*alignment*/, lNrBytes + 4096);
-  if (allocated == NULL) {
-    exception::MmapCommunicationError lExc;
-    log(lExc, "Failed to allocate ", Integer(lNrBytes + 4096), " bytes in File::write/2 function");
-    throw lExc;
+      if (lNrBytesStaged == kStoreBlockSize) {
+        lNonTemporalStoresUsed |= storeBlock(lVirtAddr, lStaging);
+        lVirtAddr += kStoreBlockSize;
+        lNrBytesStaged = 0;
+      }
+    }
   }
 
-  // data to write to register address
-  char* buffer = allocated;
-  size_t lNrBytesCopied = 0;
-  for (size_t i = 0; i < aData.size(); i++) {
-    memcpy(buffer + lNrBytesCopied, aData.at(i).first, aData.at(i).second);
-    lNrBytesCopied += aData.at(i).second;
-  }
+  assert((lNrBytesStaged % 4) == 0);
 
-//  memcpy(aMmapBaseAddress + aAddr, buffer, lNrBytes);
-  lNrBytesCopied = 0;
-  while (lNrBytesCopied < lNrBytes) {
-    char* lSrcPtr = buffer + lNrBytesCopied;
-    char* lVirtAddr = static_cast<char*>(mMmapIOPtr) + aAddr + lNrBytesCopied;
-    if ((lNrBytes - lNrBytesCopied) >= 8) {
-      *((uint64_t*) lVirtAddr) = *(uint64_t*) lSrcPtr;
-      lNrBytesCopied += 8;
-    }
-    else if ((lNrBytes - lNrBytesCopied) >= 4) {
-      *((uint64_t*) lVirtAddr) = uint64_t(*(uint32_t*) lSrcPtr);
-      lNrBytesCopied += 4;
-    }
+  // Tail of packet: 64-bit stores, with the last 32-bit word zero-extended if the packet has an odd number of words
+  for (size_t i = 0; i < lNrBytesStaged; i += 8) {
+    uint64_t lWord = 0;
+    memcpy(&lWord, lStaging + i, std::min(size_t(8), lNrBytesStaged - i));
+    *reinterpret_cast<uint64_t*>(lVirtAddr + i) = lWord;
   }
 
-  free(allocated);
+#ifdef __SSE2__
+  if (lNonTemporalStoresUsed)
+    _mm_sfence();
+#endif
 }
 
 
@@ -387,15 +448,17 @@ void Mmap::disconnect()
 
 void Mmap::write(const std::shared_ptr<Buffers>& aBuffers)
 {
-  log (Info(), "mmap client ", Quote(id()), " (URI: ", Quote(uri()), ") : writing ", Integer(aBuffers->sendCounter() / 4), "-word packet to page ", Integer(mIndexNextPage), " in ", Quote(mDeviceFile.getPath()));
+  log (mWriteLogLimiter, Info(), "mmap client ", Quote(id()), " (URI: ", Quote(uri()), ") : writing ", Integer(aBuffers->sendCounter() / 4), "-word packet to page ", Integer(mIndexNextPage), " in ", Quote(mDeviceFile.getPath()));
 
   const uint32_t lHeaderWord = (0x10000 | (((aBuffers->sendCounter() / 4) - 1) & 0xFFFF));
-  std::vector<std::pair<const uint8_t*, size_t> > lDataToWrite;
-  lDataToWrite.push_back( std::make_pair(reinterpret_cast<const uint8_t*>(&lHeaderWord), sizeof lHeaderWord) );
-  lDataToWrite.push_back( std::make_pair(aBuffers->getSendBuffer(), aBuffers->sendCounter()) );
-  mDeviceFile.write(mIndexNextPage * 4 * mPageSize, lDataToWrite);
+  mDataToWrite.clear();
+  mDataToWrite.push_back( std::make_pair(reinterpret_cast<const uint8_t*>(&lHeaderWord), sizeof lHeaderWord) );
+  const std::vector<std::pair<const uint8_t*, size_t> >& lSendSegments = aBuffers->getSendSegments();
+  mDataToWrite.insert(mDataToWrite.end(), lSendSegments.begin(), lSendSegments.end());
+  mDeviceFile.write(mIndexNextPage * 4 * mPageSize, mDataToWrite);
 
-  log (Debug(), "Wrote " , Integer((aBuffers->sendCounter() / 4) + 1), " 32-bit words at address " , Integer(mIndexNextPage * 4 * mPageSize), " ... ", PacketFmt(lDataToWrite));
+  if (LoggingIncludes(Debug()))
+    log (Debug(), "Wrote " , Integer((aBuffers->sendCounter() / 4) + 1), " 32-bit words at address " , Integer(mIndexNextPage * 4 * mPageSize), " ... ", PacketFmt(mDataToWrite));
 
   mIndexNextPage = (mIndexNextPage + 1) % mNumberOfPages;
   mReplyQueue.push_back(aBuffers);
@@ -411,12 +474,13 @@ void Mmap::read()
   {
     uint32_t lHwPublishedPageCount = 0x0;
 
+    std::vector<uint32_t> lValues;
+    lValues.reserve(4);
     while ( true ) {
-      std::vector<uint32_t> lValues;
-      // FIXME : Improve by simply adding dmaWrite method that takes uint32_t ref as argument (or returns uint32_t)
+      lValues.clear();
       mDeviceFile.read(0, 4, lValues);
       lHwPublishedPageCount = lValues.at(3);
-      log (Info(), "Read status info from addr 0 (", Integer(lValues.at(0)), ", ", Integer(lValues.at(1)), ", ", Integer(lValues.at(2)), ", ", Integer(lValues.at(3)), "): ", PacketFmt((const uint8_t*)lValues.data(), 4 * lValues.size()));
+      log (mStatusLogLimiter, Info(), "Read status info from addr 0 (", Integer(lValues.at(0)), ", ", Integer(lValues.at(1)), ", ", Integer(lValues.at(2)), ", ", Integer(lValues.at(3)), "): ", PacketFmt((const uint8_t*)lValues.data(), 4 * lValues.size()));
 
       if (lHwPublishedPageCount != mPublishedReplyPageCount) {
         mPublishedReplyPageCount = lHwPublishedPageCount;
@@ -435,7 +499,7 @@ void Mmap::read()
         std::this_thread::sleep_for( mSleepDuration );
     }
 
-    log(Info(), "mmap client ", Quote(id()), " (URI: ", Quote(uri()), ") : Reading page ", Integer(lPageIndexToRead), " (published count ", Integer(lHwPublishedPageCount), ", surpasses required, ", Integer(mReadReplyPageCount + 1), ")");
+    log(mReadLogLimiter, Info(), "mmap client ", Quote(id()), " (URI: ", Quote(uri()), ") : Reading page ", Integer(lPageIndexToRead), " (published count ", Integer(lHwPublishedPageCount), ", surpasses required, ", Integer(mReadReplyPageCount + 1), ")");
   }
   mReadReplyPageCount++;
   
@@ -443,18 +507,15 @@ void Mmap::read()
   std::shared_ptr<Buffers> lBuffers = mReplyQueue.front();
   mReplyQueue.pop_front();
 
-  uint32_t lNrWordsToRead(lBuffers->replyCounter() >> 2);
-  lNrWordsToRead += 1;
- 
-  std::vector<uint32_t> lPageContents;
-  mDeviceFile.read(4 + lPageIndexToRead * mPageSize, lNrWordsToRead , lPageContents);
-  log (Debug(), "Read " , Integer(lNrWordsToRead), " 32-bit words from address " , Integer(4 + lPageIndexToRead * 4 * mPageSize), " ... ", PacketFmt((const uint8_t*)lPageContents.data(), 4 * lPageContents.size()));
+  const uint32_t lPageAddr = 4 + lPageIndexToRead * mPageSize;
+  uint32_t lPageHeader;
+  mDeviceFile.read(lPageAddr, reinterpret_cast<uint8_t*>(&lPageHeader), 4);
 
-  // PART 2 : Transfer to reply buffer
+  // PART 2 : Transfer to reply buffer, straight from the page
   const std::deque< std::pair< uint8_t* , uint32_t > >& lReplyBuffers ( lBuffers->getReplyBuffer() );
-  size_t lNrWordsInPacket = (lPageContents.at(0) >> 16) + (lPageContents.at(0) & 0xFFFF);
+  size_t lNrWordsInPacket = (lPageHeader >> 16) + (lPageHeader & 0xFFFF);
   if (lNrWordsInPacket != (lBuffers->replyCounter() >> 2))
-    log (Warning(), "Expected reply packet to contain ", Integer(lBuffers->replyCounter() >> 2), " words, but it actually contains ", Integer(lNrWordsInPacket), " words");
+    log (mReplyLengthLogLimiter, Warning(), "Expected reply packet to contain ", Integer(lBuffers->replyCounter() >> 2), " words, but it actually contains ", Integer(lNrWordsInPacket), " words");
 
   size_t lNrBytesCopied = 0;
   for (const auto& lBuffers: lReplyBuffers)
@@ -464,10 +525,17 @@ void Mmap::read()
       break;
 
     size_t lNrBytesToCopy = std::min( lBuffers.second , uint32_t(4*lNrWordsInPacket - lNrBytesCopied) );
-    memcpy ( lBuffers.first, &lPageContents.at(1 + (lNrBytesCopied / 4)), lNrBytesToCopy );
+    mDeviceFile.read(lPageAddr + 1 + (lNrBytesCopied / 4), lBuffers.first, lNrBytesToCopy);
     lNrBytesCopied += lNrBytesToCopy;
   }
 
+  if (LoggingIncludes(Debug())) {
+    std::vector<std::pair<const uint8_t*, size_t> > lReplyData;
+    for (const auto& lBuffers: lReplyBuffers)
+      lReplyData.push_back(std::make_pair(lBuffers.first, size_t(lBuffers.second)));
+    log (Debug(), "Read " , Integer(lNrBytesCopied / 4), " 32-bit words (after header ", Integer(lPageHeader, IntFmt<hex,fixed>()), ") from address " , Integer(4 * lPageAddr), " ... ", PacketFmt(lReplyData));
+  }
+
 
   // PART 3 : Validate the packet contents
   try
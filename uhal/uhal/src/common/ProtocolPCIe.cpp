@@ -50,6 +50,8 @@
 #include <fcntl.h>
 #include <iomanip>                                          // for operator<<
 #include <iostream>                                         // for operator<<
+#include <limits.h>                                         // for IOV_MAX
+#include <poll.h>
 #include <sys/file.h>
 #include <sys/stat.h>
 #include <stdlib.h>                                         // for size_t, free
@@ -111,6 +113,7 @@ PCIe::File::File(const std::string& aPath, int aFlags) :
   mPath(aPath),
   mFd(-1),
   mFlags(aFlags),
+  mSeekable(true),
   mLocked(false),
   mBufferSize(0),
   mBuffer(NULL)
@@ -148,6 +151,9 @@ void PCIe::File::open()
     log(lExc, "Failed to open device file ", Quote(mPath), "; errno=", Integer(errno), ", meaning ", Quote (strerror(errno)));
     throw lExc;
   }
+
+  struct stat st;
+  mSeekable = not ((fstat(mFd, &st) == 0) and S_ISFIFO(st.st_mode));
 }
 
 
@@ -189,34 +195,68 @@ void PCIe::File::createBuffer(const size_t aNrBytes)
 
 
 void PCIe::File::read(const uint32_t aAddr, const uint32_t aNrWords, std::vector<uint32_t>& aValues)
+{
+  const size_t lInitialSize = aValues.size();
+  aValues.resize(lInitialSize + aNrWords);
+  const std::vector<struct iovec> lData(1, iovec{aValues.data() + lInitialSize, 4 * size_t(aNrWords)});
+  read(4 * aAddr, lData);
+}
+
+
+void PCIe::File::read(const uint32_t aAddr, const std::vector<struct iovec>& aData)
 {
   if (mFd == -1)
     open();
 
-  createBuffer(4 * aNrWords);
+  size_t lNrBytes = 0;
+  for (const auto& lRegion: aData)
+    lNrBytes += lRegion.iov_len;
+
+  /* read data from AXI MM into the regions using SGDMA */
+  ssize_t rc;
+  if (aData.size() <= IOV_MAX)
+    rc = ::preadv(mFd, aData.data(), aData.size(), aAddr);
+  else {
+    // Too many regions for a single syscall, so read into the persistent buffer, and scatter from there
+    createBuffer(lNrBytes);
+    rc = ::pread(mFd, mBuffer, lNrBytes, aAddr);
+    size_t lNrBytesCopied = 0;
+    for (size_t i = 0; (i < aData.size()) and (rc > 0) and (lNrBytesCopied < size_t(rc)); i++) {
+      const size_t lNrBytesToCopy = std::min(aData.at(i).iov_len, size_t(rc) - lNrBytesCopied);
+      memcpy(aData.at(i).iov_base, mBuffer + lNrBytesCopied, lNrBytesToCopy);
+      lNrBytesCopied += lNrBytesToCopy;
+    }
+  }
 
-  /* select AXI MM address */
-  off_t off = lseek(mFd, 4*aAddr, SEEK_SET);
-  if ( off != off_t(4 * aAddr)) {
+  if (rc == -1) {
     exception::PCIeCommunicationError lExc;
-    log(lExc, "Offset returned by lseek, ", Integer(off), ", does not match that requested, ", Integer(4*aAddr), " (in preparation for read of ", Integer(aNrWords), " words)");
+    log(lExc, "Read of ", Integer(lNrBytes), " bytes at address ", Integer(aAddr), " failed! errno=", Integer(errno), ", meaning ", Quote (strerror(errno)));
     throw lExc;
   }
-
-  /* read data from AXI MM into buffer using SGDMA */
-  int rc = ::read(mFd, mBuffer, 4*aNrWords);
-  if (rc == -1) {
+  else if (size_t(rc) < lNrBytes) {
     exception::PCIeCommunicationError lExc;
-    log(lExc, "Read of ", Integer(4*aNrWords), " bytes at address ", Integer(4 * aAddr), " failed! errno=", Integer(errno), ", meaning ", Quote (strerror(errno)));
+    log(lExc, "Only ", Integer(rc), " bytes transferred in read of ", Integer(lNrBytes), " bytes at address ", Integer(aAddr));
     throw lExc;
   }
-  else if (size_t(rc) < 4*aNrWords) {
+}
+
+
+bool PCIe::File::waitUntilReadable(const std::chrono::microseconds& aTimeout)
+{
+  if (mFd == -1)
+    open();
+
+  struct pollfd lPollFd = { mFd, POLLIN, 0 };
+  // Round up, so that a timeout of less than 1ms doesn't turn into a non-blocking check
+  const int lTimeout = (aTimeout.count() + 999) / 1000;
+  int rc = ::poll(&lPollFd, 1, lTimeout);
+  if (rc == -1 and errno != EINTR) {
     exception::PCIeCommunicationError lExc;
-    log(lExc, "Only ", Integer(rc), " bytes transferred in read of ", Integer(4*aNrWords), " bytes at address ", Integer(4 * aAddr));
+    log(lExc, "Failed to poll file ", Quote(mPath), "; errno=", Integer(errno), ", meaning ", Quote (strerror(errno)));
     throw lExc;
   }
 
-  aValues.insert(aValues.end(), reinterpret_cast<uint32_t*>(mBuffer), reinterpret_cast<uint32_t*>(mBuffer)+ aNrWords);
+  return (rc > 0) and (lPollFd.revents & POLLIN);
 }
 
 
@@ -228,75 +268,46 @@ void PCIe::File::write(const uint32_t aAddr, const std::vector<uint32_t>& aValue
 
 void PCIe::File::write(const uint32_t aAddr, const uint8_t* const aPtr, const size_t aNrBytes)
 {
-  if (mFd == -1)
-    open();
-
-  assert((aNrBytes % 4) == 0);
-
-  createBuffer(aNrBytes);
-
-  // data to write to register address
-  memcpy(mBuffer, aPtr, aNrBytes);
+  const std::vector<std::pair<const uint8_t*, size_t> > lData(1, std::make_pair(aPtr, aNrBytes));
+  write(aAddr, lData);
+}
 
-  /* select AXI MM address */
-  off_t off = lseek(mFd, aAddr, SEEK_SET);
-  if ( off != off_t(aAddr)) {
-    struct stat st;
-    if (fstat(mFd, &st) or (not S_ISFIFO(st.st_mode))) {
-      exception::PCIeCommunicationError lExc;
-      log(lExc, "Offset returned by lseek, ", Integer(off), ", does not match that requested, ", Integer(aAddr), " (in preparation for write of ", Integer(aNrBytes), " bytes)");
-      throw lExc;
-    }
-  }
 
-  /* write buffer to AXI MM address using SGDMA */
-  int rc = ::write(mFd, mBuffer, aNrBytes);
-  if (rc == -1) {
-    exception::PCIeCommunicationError lExc;
-    log(lExc, "Write of ", Integer(aNrBytes), " bytes at address ", Integer(aAddr), " failed! errno=", Integer(errno), ", meaning ", Quote (strerror(errno)));
-    throw lExc;
-  }
-  else if (size_t(rc) < aNrBytes) {
-    exception::PCIeCommunicationError lExc;
-    log(lExc, "Only ", Integer(rc), " bytes transferred in write of ", Integer(aNrBytes), " bytes at address ", Integer(aAddr));
-    throw lExc;
-  }
+void PCIe::File::write(const uint32_t aAddr, const std::vector<std::pair<const uint8_t*, size_t> >& aData)
+{
+  mIOVecs.clear();
+  for (const auto& lRegion: aData)
+    mIOVecs.push_back(iovec{const_cast<uint8_t*>(lRegion.first), lRegion.second});
+  write(aAddr, mIOVecs);
 }
 
 
-void PCIe::File::write(const uint32_t aAddr, const std::vector<std::pair<const uint8_t*, size_t> >& aData)
+void PCIe::File::write(const uint32_t aAddr, const std::vector<struct iovec>& aData)
 {
   if (mFd == -1)
     open();
 
   size_t lNrBytes = 0;
-  for (size_t i = 0; i < aData.size(); i++)
-    lNrBytes += aData.at(i).second;
+  for (const auto& lRegion: aData)
+    lNrBytes += lRegion.iov_len;
 
   assert((lNrBytes % 4) == 0);
 
-  createBuffer(lNrBytes);
-
-  // data to write to register address
-  size_t lNrBytesCopied = 0;
-  for (size_t i = 0; i < aData.size(); i++) {
-    memcpy(mBuffer + lNrBytesCopied, aData.at(i).first, aData.at(i).second);
-    lNrBytesCopied += aData.at(i).second;
-  }
-
-  /* select AXI MM address */
-  off_t off = lseek(mFd, aAddr, SEEK_SET);
-  if ( off != off_t(aAddr)) {
-    struct stat st;
-    if (fstat(mFd, &st) or (not S_ISFIFO(st.st_mode))) {
-      exception::PCIeCommunicationError lExc;
-      log(lExc, "Offset returned by lseek, ", Integer(off), ", does not match that requested, ", Integer(aAddr), " (in preparation for write of ", Integer(lNrBytes), " bytes)");
-      throw lExc;
+  /* write the regions to AXI MM address using SGDMA */
+  ssize_t rc;
+  if (aData.size() <= IOV_MAX)
+    rc = mSeekable ? ::pwritev(mFd, aData.data(), aData.size(), aAddr) : ::writev(mFd, aData.data(), aData.size());
+  else {
+    // Too many regions for a single syscall, so gather them into the persistent buffer first
+    createBuffer(lNrBytes);
+    size_t lNrBytesCopied = 0;
+    for (const auto& lRegion: aData) {
+      memcpy(mBuffer + lNrBytesCopied, lRegion.iov_base, lRegion.iov_len);
+      lNrBytesCopied += lRegion.iov_len;
     }
+    rc = mSeekable ? ::pwrite(mFd, mBuffer, lNrBytes, aAddr) : ::write(mFd, mBuffer, lNrBytes);
   }
 
-  /* write buffer to AXI MM address using SGDMA */
-  int rc = ::write(mFd, mBuffer, lNrBytes);
   if (rc == -1) {
     exception::PCIeCommunicationError lExc;
     log(lExc, "Write of ", Integer(lNrBytes), " bytes at address ", Integer(aAddr), " failed! errno=", Integer(errno), ", meaning ", Quote (strerror(errno)));
@@ -476,13 +487,19 @@ PCIe::PCIe ( const std::string& aId, const URI& aUri ) :
   mIPCMutex(getSharedMemName(mDeviceFileHostToFPGA.getPath())),
   mXdma7seriesWorkaround(false),
   mUseInterrupt(false),
+  mReplyWaitCount(0),
   mNumberOfPages(0),
   mMaxInFlight(0),
   mPageSize(0),
   mMaxPacketSize(0),
   mIndexNextPage(0),
   mPublishedReplyPageCount(0),
-  mReadReplyPageCount(0)
+  mReadReplyPageCount(0),
+  mUseCompletionThread(false),
+  mStopCompletionThread(false),
+  mCompletionThreadPaused(false),
+  mCompletionThreadBusy(false),
+  mCompletionThreadReplyCount(0)
 {
   if ( aUri.mHostname.find(",") == std::string::npos ) {
     exception::PCIeInitialisationError lExc;
@@ -496,6 +513,7 @@ PCIe::PCIe ( const std::string& aId, const URI& aUri ) :
   }
 
   mSleepDuration = std::chrono::microseconds(mUseInterrupt ? 0 : 50);
+  mSpinDuration = std::chrono::microseconds(20);
 
   for (const auto& lArg: aUri.mArguments) {
     if (lArg.first == "events") {
@@ -513,6 +531,10 @@ PCIe::PCIe ( const std::string& aId, const URI& aUri ) :
       mSleepDuration = std::chrono::microseconds(boost::lexical_cast<size_t>(lArg.second));
       log (Notice() , "PCIe client with URI ", Quote (uri()), " : Inter-poll-/-interrupt sleep duration set to ", boost::lexical_cast<size_t>(lArg.second), " us by URI 'sleep' attribute");
     }
+    else if (lArg.first == "spin") {
+      mSpinDuration = std::chrono::microseconds(boost::lexical_cast<size_t>(lArg.second));
+      log (Notice() , "PCIe client with URI ", Quote (uri()), " : Spin duration before blocking on interrupt / sleeping set to ", boost::lexical_cast<size_t>(lArg.second), " us by URI 'spin' attribute");
+    }
     else if (lArg.first == "max_in_flight") {
       mMaxInFlight = boost::lexical_cast<size_t>(lArg.second);
       log (Notice() , "PCIe client with URI ", Quote (uri()), " : 'Maximum number of packets in flight' set to ", boost::lexical_cast<size_t>(lArg.second), " by URI 'max_in_flight' attribute");
@@ -525,18 +547,48 @@ PCIe::PCIe ( const std::string& aId, const URI& aUri ) :
       mXdma7seriesWorkaround = true;
       log (Notice() , "PCIe client with URI ", Quote (uri()), " : Adjusting size of PCIe reads to a few fixed sizes as workaround for 7-series xdma firmware bug");
     }
+    else if (lArg.first == "completion_thread") {
+      mUseCompletionThread = boost::lexical_cast<bool>(lArg.second);
+      log (Notice() , "PCIe client with URI ", Quote (uri()), " : Replies will be read ", (mUseCompletionThread ? "by a dedicated completion thread" : "by the thread calling dispatch"), " (URI 'completion_thread' attribute)");
+    }
     else
       log (Warning() , "Unknown attribute ", Quote (lArg.first), " used in URI ", Quote(uri()));
   }
+
+  if (mUseCompletionThread)
+    mCompletionThread = std::thread([this] () { runCompletionThread(); });
 }
 
 
 PCIe::~PCIe()
 {
+  detachAsyncDispatches();
+
+  if (mUseCompletionThread) {
+    {
+      std::lock_guard<std::mutex> lLock(mReplyQueueMutex);
+      mStopCompletionThread = true;
+    }
+    mReplyQueueCondition.notify_all();
+    mCompletionThread.join();
+  }
+
   disconnect();
 }
 
 
+uint64_t PCIe::getCompletionThreadReplyCount() const
+{
+  return mCompletionThreadReplyCount.load(std::memory_order_relaxed);
+}
+
+
+uint64_t PCIe::getReplyWaitCount() const
+{
+  return mReplyWaitCount.load(std::memory_order_relaxed);
+}
+
+
 void PCIe::implementDispatch ( std::shared_ptr< Buffers > aBuffers )
 {
   log(Debug(), "PCIe client (URI: ", Quote(uri()), ") : implementDispatch method called");
@@ -544,7 +596,16 @@ void PCIe::implementDispatch ( std::shared_ptr< Buffers > aBuffers )
   if ( ! mConnected )
     connect();
 
-  if ( mReplyQueue.size() == mMaxInFlight )
+  if ( mUseCompletionThread ) {
+    // Fill the next page as soon as the completion thread has freed one up
+    std::unique_lock<std::mutex> lLock(mReplyQueueMutex);
+    mReplyQueueCondition.wait(lLock, [this] () { return mAsynchronousException or (mReplyQueue.size() < mMaxInFlight); });
+    if (mAsynchronousException) {
+      log(Notice(), "Rethrowing exception from completion thread of PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ")");
+      std::rethrow_exception(mAsynchronousException);
+    }
+  }
+  else if ( mReplyQueue.size() == mMaxInFlight )
     read();
   write(aBuffers);
 }
@@ -553,8 +614,19 @@ void PCIe::implementDispatch ( std::shared_ptr< Buffers > aBuffers )
 void PCIe::Flush( )
 {
   log(Debug(), "PCIe client (URI: ", Quote(uri()), ") : Flush method called");
-  while ( !mReplyQueue.empty() )
-    read();
+  if ( mUseCompletionThread ) {
+    std::unique_lock<std::mutex> lLock(mReplyQueueMutex);
+    // Buffers leave the queue once their page has been read, so also wait for the completion thread to finish validating the last reply
+    mReplyQueueCondition.wait(lLock, [this] () { return mAsynchronousException or (mReplyQueue.empty() and not mCompletionThreadBusy); });
+    if (mAsynchronousException) {
+      log(Notice(), "Rethrowing exception from completion thread of PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ")");
+      std::rethrow_exception(mAsynchronousException);
+    }
+  }
+  else {
+    while ( !mReplyQueue.empty() )
+      read();
+  }
 
   mDeviceFileHostToFPGA.unlock();
 
@@ -563,11 +635,32 @@ void PCIe::Flush( )
 }
 
 
+bool PCIe::beginFlush( )
+{
+  return mUseCompletionThread;
+}
+
+
+bool PCIe::asynchronousExceptionPending( )
+{
+  std::lock_guard<std::mutex> lLock(mReplyQueueMutex);
+  return bool(mAsynchronousException);
+}
+
+
 void PCIe::dispatchExceptionHandler()
 {
   log(Notice(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : closing device files since exception detected");
 
-  ClientInterface::returnBufferToPool ( mReplyQueue );
+  if ( mUseCompletionThread ) {
+    pauseCompletionThread();
+    std::lock_guard<std::mutex> lLock(mReplyQueueMutex);
+    ClientInterface::returnBufferToPool ( mReplyQueue );
+    mAsynchronousException = nullptr;
+    mCompletionThreadPaused = false;
+  }
+  else
+    ClientInterface::returnBufferToPool ( mReplyQueue );
 
   mDeviceFileHostToFPGA.unlock();
 
@@ -678,25 +771,83 @@ void PCIe::write(const std::shared_ptr<Buffers>& aBuffers)
     }
   }
 
-  log (Info(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : writing ", Integer(aBuffers->sendCounter() / 4), "-word packet to page ", Integer(mIndexNextPage), " in ", Quote(mDeviceFileHostToFPGA.getPath()));
+  log (mWriteLogLimiter, Info(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : writing ", Integer(aBuffers->sendCounter() / 4), "-word packet to page ", Integer(mIndexNextPage), " in ", Quote(mDeviceFileHostToFPGA.getPath()));
 
+  // The header word and send segments are written straight from the Buffers (and any block-write source arrays) in a single pwritev call
   const uint32_t lHeaderWord = (0x10000 | (((aBuffers->sendCounter() / 4) - 1) & 0xFFFF));
-  std::vector<std::pair<const uint8_t*, size_t> > lDataToWrite;
-  lDataToWrite.push_back( std::make_pair(reinterpret_cast<const uint8_t*>(&lHeaderWord), sizeof lHeaderWord) );
-  lDataToWrite.push_back( std::make_pair(aBuffers->getSendBuffer(), aBuffers->sendCounter()) );
+  mDataToWrite.clear();
+  mDataToWrite.push_back( std::make_pair(reinterpret_cast<const uint8_t*>(&lHeaderWord), sizeof lHeaderWord) );
+  const std::vector<std::pair<const uint8_t*, size_t> >& lSendSegments = aBuffers->getSendSegments();
+  mDataToWrite.insert(mDataToWrite.end(), lSendSegments.begin(), lSendSegments.end());
 
   IPCScopedLock_t lGuard(*mIPCMutex);
-  mDeviceFileHostToFPGA.write(mIndexNextPage * 4 * mPageSize, lDataToWrite);
-  log (Debug(), "Wrote " , Integer((aBuffers->sendCounter() / 4) + 1), " 32-bit words at address " , Integer(mIndexNextPage * 4 * mPageSize), " ... ", PacketFmt(lDataToWrite));
+  mDeviceFileHostToFPGA.write(mIndexNextPage * 4 * mPageSize, mDataToWrite);
+  if (LoggingIncludes(Debug()))
+    log (Debug(), "Wrote " , Integer((aBuffers->sendCounter() / 4) + 1), " 32-bit words at address " , Integer(mIndexNextPage * 4 * mPageSize), " ... ", PacketFmt(mDataToWrite));
+
+  {
+    std::lock_guard<std::mutex> lLock(mReplyQueueMutex);
+    mIndexNextPage = (mIndexNextPage + 1) % mNumberOfPages;
+    mReplyQueue.push_back(aBuffers);
+  }
+  mReplyQueueCondition.notify_all();
+}
+
+
+void PCIe::runCompletionThread()
+{
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lLock(mReplyQueueMutex);
+      mReplyQueueCondition.wait(lLock, [this] () { return mStopCompletionThread or ((not mReplyQueue.empty()) and (not mAsynchronousException) and (not mCompletionThreadPaused)); });
+      if (mStopCompletionThread)
+        return;
+      mCompletionThreadBusy = true;
+    }
+
+    std::exception_ptr lException;
+    try {
+      read();
+      mCompletionThreadReplyCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    catch (...) {
+      lException = std::current_exception();
+    }
+
+    bool lRepliesReceived;
+    {
+      std::lock_guard<std::mutex> lLock(mReplyQueueMutex);
+      mCompletionThreadBusy = false;
+      if (lException)
+        mAsynchronousException = lException;
+      lRepliesReceived = (mAsynchronousException or mReplyQueue.empty());
+    }
+    mReplyQueueCondition.notify_all();
+
+    if (lRepliesReceived)
+      repliesReceived();
+  }
+}
 
-  mIndexNextPage = (mIndexNextPage + 1) % mNumberOfPages;
-  mReplyQueue.push_back(aBuffers);
+
+void PCIe::pauseCompletionThread()
+{
+  std::unique_lock<std::mutex> lLock(mReplyQueueMutex);
+  mCompletionThreadPaused = true;
+  mReplyQueueCondition.wait(lLock, [this] () { return not mCompletionThreadBusy; });
 }
 
 
 void PCIe::read()
 {
-  const size_t lPageIndexToRead = (mIndexNextPage - mReplyQueue.size() + mNumberOfPages) % mNumberOfPages;
+  size_t lPageIndexToRead;
+  std::shared_ptr<Buffers> lBuffers;
+  {
+    // The request page isn't released (i.e. the buffers aren't removed from the queue) until the reply has been read
+    std::lock_guard<std::mutex> lLock(mReplyQueueMutex);
+    lPageIndexToRead = (mIndexNextPage - mReplyQueue.size() + mNumberOfPages) % mNumberOfPages;
+    lBuffers = mReplyQueue.front();
+  }
   SteadyClock_t::time_point lStartTime = SteadyClock_t::now();
 
   if (mReadReplyPageCount == mPublishedReplyPageCount)
@@ -704,6 +855,9 @@ void PCIe::read()
     if (mUseInterrupt)
     {
       std::vector<uint32_t> lRxEvent;
+      const std::chrono::microseconds lTimeout(getBoostTimeoutPeriod().total_microseconds());
+      bool lBlockingWaitSupported = true;
+      bool lEventPending = false;
       // wait for interrupt; read events file node to see if user interrupt has come
       while (true) {
         mDeviceFileFPGAEvent.read(0, 1, lRxEvent);
@@ -712,19 +866,37 @@ void PCIe::read()
         }
         lRxEvent.clear();
 
-        if (SteadyClock_t::now() - lStartTime > std::chrono::microseconds(getBoostTimeoutPeriod().total_microseconds())) {
+        // If poll reported the events file as readable but no interrupt has come, the driver does not support blocking waits
+        if (lEventPending) {
+          log(Debug(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : Events file does not support blocking waits; falling back to sleeping");
+          lBlockingWaitSupported = false;
+          lEventPending = false;
+        }
+
+        const SteadyClock_t::duration lElapsed = SteadyClock_t::now() - lStartTime;
+        if (lElapsed > lTimeout) {
           exception::PCIeTimeout lExc;
           log(lExc, "Next page (index ", Integer(lPageIndexToRead), " count ", Integer(mPublishedReplyPageCount+1), ") of PCIe device '" + mDeviceFileHostToFPGA.getPath() + "' is not ready after timeout period");
           throw lExc;
         }
 
-        log(Debug(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : Waiting for interrupt; sleeping for ", mSleepDuration.count(), "us");
-        if (mSleepDuration > std::chrono::microseconds(0))
-          std::this_thread::sleep_for( mSleepDuration );
+        if (lElapsed < mSpinDuration)
+          continue;
+
+        mReplyWaitCount.fetch_add(1, std::memory_order_relaxed);
+        if (lBlockingWaitSupported) {
+          log(Debug(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : Waiting for interrupt; blocking on events file");
+          lEventPending = mDeviceFileFPGAEvent.waitUntilReadable(std::chrono::duration_cast<std::chrono::microseconds>(lTimeout - lElapsed));
+        }
+        else {
+          log(Debug(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : Waiting for interrupt; sleeping for ", mSleepDuration.count(), "us");
+          if (mSleepDuration > std::chrono::microseconds(0))
+            std::this_thread::sleep_for( mSleepDuration );
+        }
 
       } // end of while (true)
 
-      log(Info(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : Reading page ", Integer(lPageIndexToRead), " (interrupt received)");
+      log(mReadLogLimiter, Info(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : Reading page ", Integer(lPageIndexToRead), " (interrupt received)");
     }
     else
     {
@@ -744,54 +916,81 @@ void PCIe::read()
         }
         // FIXME: Throw if published page count is invalid number
 
-        if (SteadyClock_t::now() - lStartTime > std::chrono::microseconds(getBoostTimeoutPeriod().total_microseconds())) {
+        const SteadyClock_t::duration lElapsed = SteadyClock_t::now() - lStartTime;
+        if (lElapsed > std::chrono::microseconds(getBoostTimeoutPeriod().total_microseconds())) {
           exception::PCIeTimeout lExc;
           log(lExc, "Next page (index ", Integer(lPageIndexToRead), " count ", Integer(mPublishedReplyPageCount+1), ") of PCIe device '" + mDeviceFileHostToFPGA.getPath() + "' is not ready after timeout period");
           throw lExc;
         }
+        lValues.clear();
+
+        // The page count can't be waited on, so re-read it straight away during the spin period, and sleep between reads afterwards
+        if (lElapsed < mSpinDuration)
+          continue;
 
+        mReplyWaitCount.fetch_add(1, std::memory_order_relaxed);
         log(Debug(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : Trying to read page index ", Integer(lPageIndexToRead), " = count ", Integer(mReadReplyPageCount+1), "; published page count is ", Integer(lHwPublishedPageCount), "; sleeping for ", mSleepDuration.count(), "us");
         if (mSleepDuration > std::chrono::microseconds(0))
           std::this_thread::sleep_for( mSleepDuration );
-        lValues.clear();
+        else
+          std::this_thread::yield();
       }
 
-      log(Info(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : Reading page ", Integer(lPageIndexToRead), " (published count ", Integer(lHwPublishedPageCount), ", surpasses required, ", Integer(mReadReplyPageCount + 1), ")");
+      log(mReadLogLimiter, Info(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : Reading page ", Integer(lPageIndexToRead), " (published count ", Integer(lHwPublishedPageCount), ", surpasses required, ", Integer(mReadReplyPageCount + 1), ")");
     }
   }
   mReadReplyPageCount++;
   
   // PART 1 : Read the page
-  std::shared_ptr<Buffers> lBuffers = mReplyQueue.front();
-  mReplyQueue.pop_front();
 
   uint32_t lNrWordsToRead(lBuffers->replyCounter() >> 2);
+  uint32_t lNrPaddingWords(0);
   if(mXdma7seriesWorkaround and (lNrWordsToRead % 32 == 0 || lNrWordsToRead % 32 == 28 || lNrWordsToRead < 4))
-    lNrWordsToRead += 4;
-  lNrWordsToRead += 1;
- 
-  std::vector<uint32_t> lPageContents;
+    lNrPaddingWords = 4;
+  lNrWordsToRead += lNrPaddingWords + 1;
+
+  // The page is read straight into the reply buffers with a single preadv call: header word first, then the reply buffers, then any padding
+  const std::deque< std::pair< uint8_t* , uint32_t > >& lReplyBuffers ( lBuffers->getReplyBuffer() );
+  uint32_t lPageHeader = 0;
+  mReplyIOVecs.clear();
+  mReplyIOVecs.push_back(iovec{&lPageHeader, sizeof lPageHeader});
+  for (const auto& lBuffer: lReplyBuffers)
+    mReplyIOVecs.push_back(iovec{lBuffer.first, lBuffer.second});
+  if (lNrPaddingWords > 0)
+    mReplyIOVecs.push_back(iovec{mReplyPadding, 4 * lNrPaddingWords});
+
   IPCScopedLock_t lGuard(*mIPCMutex);
-  mDeviceFileFPGAToHost.read(4 + lPageIndexToRead * mPageSize, lNrWordsToRead , lPageContents);
+  mDeviceFileFPGAToHost.read(4 * (4 + lPageIndexToRead * mPageSize), mReplyIOVecs);
   lGuard.unlock();
-  log (Debug(), "Read " , Integer(lNrWordsToRead), " 32-bit words from address " , Integer(4 + lPageIndexToRead * 4 * mPageSize), " ... ", PacketFmt((const uint8_t*)lPageContents.data(), 4 * lPageContents.size()));
 
-  // PART 2 : Transfer to reply buffer
-  const std::deque< std::pair< uint8_t* , uint32_t > >& lReplyBuffers ( lBuffers->getReplyBuffer() );
-  size_t lNrWordsInPacket = (lPageContents.at(0) >> 16) + (lPageContents.at(0) & 0xFFFF);
+  {
+    std::lock_guard<std::mutex> lLock(mReplyQueueMutex);
+    mReplyQueue.pop_front();
+  }
+  mReplyQueueCondition.notify_all();
+
+  if (LoggingIncludes(Debug())) {
+    std::vector<std::pair<const uint8_t*, size_t> > lPageContents;
+    for (const auto& lRegion: mReplyIOVecs)
+      lPageContents.push_back(std::make_pair(static_cast<const uint8_t*>(lRegion.iov_base), lRegion.iov_len));
+    log (Debug(), "Read " , Integer(lNrWordsToRead), " 32-bit words from address " , Integer(4 + lPageIndexToRead * 4 * mPageSize), " ... ", PacketFmt(lPageContents));
+  }
+
+  // PART 2 : Check the reply length
+  size_t lNrWordsInPacket = (lPageHeader >> 16) + (lPageHeader & 0xFFFF);
   if (lNrWordsInPacket != (lBuffers->replyCounter() >> 2))
-    log (Warning(), "Expected reply packet to contain ", Integer(lBuffers->replyCounter() >> 2), " words, but it actually contains ", Integer(lNrWordsInPacket), " words");
+    log (mReplyLengthLogLimiter, Warning(), "Expected reply packet to contain ", Integer(lBuffers->replyCounter() >> 2), " words, but it actually contains ", Integer(lNrWordsInPacket), " words");
 
-  size_t lNrBytesCopied = 0;
+  // Don't leave data from beyond the end of the packet in the reply buffers, for cases when less data received than expected
+  size_t lNrBytesSeen = 0;
   for (const auto& lBuffer: lReplyBuffers)
   {
-    // Don't copy more of page than was written to, for cases when less data received than expected
-    if ( lNrBytesCopied >= 4*lNrWordsInPacket)
-      break;
-
-    size_t lNrBytesToCopy = std::min( lBuffer.second , uint32_t(4*lNrWordsInPacket - lNrBytesCopied) );
-    memcpy ( lBuffer.first, &lPageContents.at(1 + (lNrBytesCopied / 4)), lNrBytesToCopy );
-    lNrBytesCopied += lNrBytesToCopy;
+    if ( lNrBytesSeen + lBuffer.second > 4*lNrWordsInPacket )
+    {
+      const size_t lNrValidBytes = (lNrBytesSeen < 4*lNrWordsInPacket) ? (4*lNrWordsInPacket - lNrBytesSeen) : 0;
+      memset ( lBuffer.first + lNrValidBytes, 0, lBuffer.second - lNrValidBytes );
+    }
+    lNrBytesSeen += lBuffer.second;
   }
 
 
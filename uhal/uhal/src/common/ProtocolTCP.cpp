@@ -45,6 +45,7 @@
 
 #include "uhal/Buffers.hpp"
 #include "uhal/grammars/URI.hpp"
+#include "uhal/IOServicePool.hpp"
 #include "uhal/IPbusInspector.hpp"
 #include "uhal/log/LogLevels.hpp"
 #include "uhal/log/log.hpp"
@@ -62,12 +63,12 @@ namespace uhal
   TCP< InnerProtocol, nr_buffers_per_send >::TCP ( const std::string& aId, const URI& aUri ) :
     InnerProtocol ( aId , aUri ),
     mMaxPayloadSize (350 * 4),
-    mIOservice ( ),
-    mSocket ( mIOservice ),
-    mEndpoint ( boost::asio::ip::tcp::resolver ( mIOservice ).resolve ( boost::asio::ip::tcp::resolver::query ( aUri.mHostname , aUri.mPort ) ) ),
-    mDeadlineTimer ( mIOservice ),
-    mIOserviceWork ( mIOservice ),
-    mDispatchThread ( [this] () { mIOservice.run(); } ),
+    mIOservice ( IOServicePool::getInstance().getIOService() ),
+    mSocket ( *mIOservice ),
+    mEndpoint ( boost::asio::ip::tcp::resolver ( *mIOservice ).resolve ( boost::asio::ip::tcp::resolver::query ( aUri.mHostname , aUri.mPort ) ) ),
+    mDeadlineTimer ( *mIOservice ),
+    mClosing ( false ),
+    mAliveToken ( std::make_shared< bool >() ),
     mDispatchQueue(),
     mReplyQueue(),
     mPacketsInFlight ( 0 ),
@@ -75,7 +76,7 @@ namespace uhal
     mFlushDone ( true ),
     mAsynchronousException ( NULL )
   {
-    mDeadlineTimer.async_wait ([this] (const boost::system::error_code&) { this->CheckDeadline(); });
+    mDeadlineTimer.async_wait ( IOServicePool::guard ( mAliveToken , [this] (const boost::system::error_code&) { this->CheckDeadline(); } ) );
 
     // Extract value of 'max_payload_size' attribute, if present
     for (const auto& lArg : aUri.mArguments) {
@@ -95,15 +96,18 @@ namespace uhal
   template < typename InnerProtocol , std::size_t nr_buffers_per_send >
   TCP< InnerProtocol , nr_buffers_per_send >::~TCP()
   {
+    ClientInterface::detachAsyncDispatches();
+
     try
     {
-      mSocket.close();
-
-      while ( mSocket.is_open() )
-        {}
+      IOServicePool::close ( *mIOservice , [this] () {
+        std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
+        mClosing = true;
+        mSocket.close();
+        mDeadlineTimer.cancel();
+        mAliveToken.reset();
+      });
 
-      mIOservice.stop();
-      mDispatchThread.join();
       ClientInterface::returnBufferToPool ( mDispatchQueue );
       for (size_t i = 0; i < mReplyQueue.size(); i++)
         ClientInterface::returnBufferToPool ( mReplyQueue.at(i).first );
@@ -218,7 +222,8 @@ namespace uhal
       mDispatchQueue.pop_front();
       const std::shared_ptr<Buffers>& lBuffer = mDispatchBuffers.back();
       mSendByteCounter += lBuffer->sendCounter();
-      lAsioSendBuffer.push_back ( boost::asio::const_buffer ( lBuffer->getSendBuffer() , lBuffer->sendCounter() ) );
+      for ( const auto& lSegment : lBuffer->getSendSegments() )
+        lAsioSendBuffer.push_back ( boost::asio::const_buffer ( lSegment.first , lSegment.second ) );
     }
 
     log ( Debug() , "Sending " , Integer ( mSendByteCounter ) , " bytes from ", Integer ( mDispatchBuffers.size() ), " buffers" );
@@ -233,7 +238,7 @@ namespace uhal
       mDeadlineTimer.expires_from_now ( this->getBoostTimeoutPeriod() );
     }
 
-    boost::asio::async_write ( mSocket , lAsioSendBuffer , [&] (const boost::system::error_code& e, std::size_t n) { this->write_callback(e, n); });
+    boost::asio::async_write ( mSocket , lAsioSendBuffer , IOServicePool::guard ( mAliveToken , [&] (const boost::system::error_code& e, std::size_t n) { this->write_callback(e, n); } ) );
     mPacketsInFlight += mDispatchBuffers.size();
 
     SteadyClock_t::time_point lNow = SteadyClock_t::now();
@@ -336,7 +341,7 @@ namespace uhal
       mDeadlineTimer.expires_from_now ( this->getBoostTimeoutPeriod() );
     }
 
-    boost::asio::async_read ( mSocket , lAsioReplyBuffer ,  boost::asio::transfer_exactly ( 4 ), [&] (const boost::system::error_code& e, std::size_t n) { this->read_callback(e, n); });
+    boost::asio::async_read ( mSocket , lAsioReplyBuffer ,  boost::asio::transfer_exactly ( 4 ), IOServicePool::guard ( mAliveToken , [&] (const boost::system::error_code& e, std::size_t n) { this->read_callback(e, n); } ) );
     SteadyClock_t::time_point lNow = SteadyClock_t::now();
     if (mLastRecvQueued > SteadyClock_t::time_point())
       mInterRecvTimeStats.add(mLastRecvQueued, lNow);
@@ -560,24 +565,16 @@ namespace uhal
       mDeadlineTimer.expires_at ( boost::posix_time::pos_infin );
     }
 
-    // Put the actor back to sleep.
-    mDeadlineTimer.async_wait ([this] (const boost::system::error_code&) { this->CheckDeadline(); });
+    // Put the actor back to sleep, unless the client is being destroyed
+    if ( !mClosing )
+      mDeadlineTimer.async_wait ( IOServicePool::guard ( mAliveToken , [this] (const boost::system::error_code&) { this->CheckDeadline(); } ) );
   }
 
 
   template < typename InnerProtocol , std::size_t nr_buffers_per_send >
   void TCP< InnerProtocol , nr_buffers_per_send >::Flush( )
   {
-    {
-      std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
-      mFlushStarted = true;
-
-      if ( mDispatchQueue.size() && mDispatchBuffers.empty() )
-      {
-        write();
-      }
-    }
-
+    beginFlush();
     WaitOnConditionalVariable();
 
     std::lock_guard<std::mutex> lLock ( mTransportLayerMutex ); 
@@ -589,6 +586,29 @@ namespace uhal
   }
 
 
+  template < typename InnerProtocol , std::size_t nr_buffers_per_send >
+  bool TCP< InnerProtocol , nr_buffers_per_send >::beginFlush( )
+  {
+    std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
+    mFlushStarted = true;
+
+    if ( mDispatchQueue.size() && mDispatchBuffers.empty() )
+    {
+      write();
+    }
+
+    return true;
+  }
+
+
+  template < typename InnerProtocol , std::size_t nr_buffers_per_send >
+  bool TCP< InnerProtocol , nr_buffers_per_send >::asynchronousExceptionPending( )
+  {
+    std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
+    return ( mAsynchronousException != NULL );
+  }
+
+
   template < typename InnerProtocol , std::size_t nr_buffers_per_send >
   void TCP< InnerProtocol , nr_buffers_per_send >::dispatchExceptionHandler()
   {
@@ -637,6 +657,11 @@ namespace uhal
       mFlushDone = aValue;
     }
     mConditionalVariable.notify_one();
+
+    if ( aValue )
+    {
+      ClientInterface::repliesReceived();
+    }
   }
 
   template < typename InnerProtocol , std::size_t nr_buffers_per_send >
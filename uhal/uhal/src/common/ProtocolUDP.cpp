@@ -33,9 +33,18 @@
 #include "uhal/ProtocolUDP.hpp"
 
 
+#include <algorithm>
+#include <cmath>
+#include <errno.h>
 #include <exception>
 #include <mutex>
+#include <string.h>
+#include <type_traits>
 #include <utility>
+#include <arpa/inet.h>
+#ifdef __linux__
+#include <sys/socket.h>
+#endif
 
 #include <boost/asio/connect.hpp>
 #include <boost/asio/write.hpp>
@@ -49,30 +58,49 @@
 #include "uhal/log/log_inserters.type.hpp"
 #include "uhal/log/log.hpp"
 #include "uhal/grammars/URI.hpp"
+#include "uhal/IOServicePool.hpp"
 #include "uhal/Buffers.hpp"
 #include "uhal/ProtocolIPbus.hpp"
 
 
 namespace uhal
 {
+  template < typename InnerProtocol >
+  const uint32_t UDP< InnerProtocol >::kMaxRecoveryAttempts;
+
+
   template < typename InnerProtocol >
   UDP< InnerProtocol >::UDP ( const std::string& aId, const URI& aUri ) :
     InnerProtocol ( aId , aUri ),
     mMaxPayloadSize (350 * 4),
-    mIOservice ( ),
-    mSocket ( mIOservice , boost::asio::ip::udp::endpoint ( boost::asio::ip::udp::v4(), 0 ) ),
-    mEndpoint ( *boost::asio::ip::udp::resolver ( mIOservice ).resolve ( boost::asio::ip::udp::resolver::query ( boost::asio::ip::udp::v4() , aUri.mHostname , aUri.mPort ) ) ),
-    mDeadlineTimer ( mIOservice ),
+    mMaxBatchSize (1),
+    mLargestBatch (0),
+    mIOservice ( IOServicePool::getInstance().getIOService() ),
+    mSocket ( *mIOservice , boost::asio::ip::udp::endpoint ( boost::asio::ip::udp::v4(), 0 ) ),
+    mEndpoint ( *boost::asio::ip::udp::resolver ( *mIOservice ).resolve ( boost::asio::ip::udp::resolver::query ( boost::asio::ip::udp::v4() , aUri.mHostname , aUri.mPort ) ) ),
+    mDeadlineTimer ( *mIOservice ),
     mReplyMemory ( ),
-    mIOserviceWork ( mIOservice ),
-    mDispatchThread ( [this] () { mIOservice.run(); } ),
+    mClosing ( false ),
+    mAliveToken ( std::make_shared< bool >() ),
     mDispatchQueue(),
     mReplyQueue(),
     mPacketsInFlight ( 0 ),
+    mCongestionControl ( false ),
+    mCongestionWindow ( 1 ),
+    mSlowStartThreshold ( 0 ),
+    mSmoothedRoundTripTime ( 0 ),
+    mRoundTripTimeVariation ( 0 ),
+    mWindowReductionHoldoff ( ),
+    mSendTimes ( ),
+    mPacketLossRecovery ( false ),
+    mNextPacketId ( 0 ),
+    mSynchronisingPacketIds ( false ),
+    mRecoveryAttempts ( 0 ),
+    mOutOfOrderReplies ( ),
     mFlushDone ( true ),
     mAsynchronousException ( NULL )
   {
-    mDeadlineTimer.async_wait ([this] (const boost::system::error_code&) { this->CheckDeadline(); });
+    mDeadlineTimer.async_wait ( IOServicePool::guard ( mAliveToken , [this] (const boost::system::error_code&) { this->CheckDeadline(); } ) );
 
     // Extract value of 'max_payload_size' attribute, if present
     for (const auto& lArg : aUri.mArguments) {
@@ -85,28 +113,72 @@ namespace uhal
         }
         log (Info(), "Client with URI ", Quote(this->uri()), ": Maximum UDP payload size set to ", std::to_string(mMaxPayloadSize), " bytes");
       }
+      else if (lArg.first == "max_batch_size") {
+        try {
+          mMaxBatchSize = boost::lexical_cast<size_t>(lArg.second);
+        }
+        catch (const boost::bad_lexical_cast&) {
+          throw exception::InvalidURI("Client URI \"" + this->uri() + "\": Invalid value, \"" + lArg.second + "\", specified for attribute \"" + lArg.first + "\"");
+        }
+        if (mMaxBatchSize == 0)
+          throw exception::InvalidURI("Client URI \"" + this->uri() + "\": Value of attribute \"" + lArg.first + "\" must be greater than 0");
+#ifdef __linux__
+        log (Info(), "Client with URI ", Quote(this->uri()), ": Up to ", std::to_string(mMaxBatchSize), " UDP packets will be sent/received in each sendmmsg/recvmmsg call");
+#else
+        log (Warning(), "Client with URI ", Quote(this->uri()), ": Ignoring attribute \"", lArg.first, "\" since sendmmsg/recvmmsg are not available on this platform");
+        mMaxBatchSize = 1;
+#endif
+      }
+      else if (lArg.first == "congestion_control") {
+        try {
+          mCongestionControl = boost::lexical_cast<bool>(lArg.second);
+        }
+        catch (const boost::bad_lexical_cast&) {
+          throw exception::InvalidURI("Client URI \"" + this->uri() + "\": Invalid value, \"" + lArg.second + "\", specified for attribute \"" + lArg.first + "\" (must be 0 or 1)");
+        }
+        if (mCongestionControl)
+          log (Info(), "Client with URI ", Quote(this->uri()), ": Number of packets in flight will back off on packet loss and timeouts");
+      }
+      else if (lArg.first == "packet_loss_recovery") {
+        try {
+          mPacketLossRecovery = boost::lexical_cast<bool>(lArg.second);
+        }
+        catch (const boost::bad_lexical_cast&) {
+          throw exception::InvalidURI("Client URI \"" + this->uri() + "\": Invalid value, \"" + lArg.second + "\", specified for attribute \"" + lArg.first + "\" (must be 0 or 1)");
+        }
+        if (mPacketLossRecovery and not std::is_same< InnerProtocol , IPbus< 2 , 0 > >::value) {
+          log (Warning(), "Client with URI ", Quote(this->uri()), ": Ignoring attribute \"", lArg.first, "\" since packet-loss recovery requires IPbus 2.0");
+          mPacketLossRecovery = false;
+        }
+        if (mPacketLossRecovery)
+          log (Info(), "Client with URI ", Quote(this->uri()), ": Lost packets will be recovered using status and resend requests");
+      }
       else
         throw exception::InvalidURI("Client URI \"" + this->uri() + "\" has unexpected attribute \"" + lArg.first + "\"");
     }
 
-    mReplyMemory.resize(mMaxPayloadSize + 20, 0x00000000);
+    mReplyMemory.resize(mMaxBatchSize * (mMaxPayloadSize + 20), 0x00000000);
   }
 
 
   template < typename InnerProtocol >
   UDP< InnerProtocol >::~UDP()
   {
+    ClientInterface::detachAsyncDispatches();
+
     try
     {
-      mSocket.close();
-
-      while ( mSocket.is_open() )
-        {}
+      IOServicePool::close ( *mIOservice , [this] () {
+        std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
+        mClosing = true;
+        mSocket.close();
+        mDeadlineTimer.cancel();
+        mAliveToken.reset();
+      });
 
-      mIOservice.stop();
-      mDispatchThread.join();
       std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
       ClientInterface::returnBufferToPool ( mDispatchQueue );
+      ClientInterface::returnBufferToPool ( mDispatchBatch );
       ClientInterface::returnBufferToPool ( mReplyQueue );
     }
     catch ( const std::exception& aExc )
@@ -133,8 +205,25 @@ namespace uhal
       connect();
     }
 
+    if ( mPacketLossRecovery )
+    {
+      if ( mNextPacketId == 0 )
+      {
+        // The packet ID is only known once the target has replied to a status request; the IO thread then sends the queued packets
+        mDispatchQueue.push_back ( aBuffers );
 
-    if ( mDispatchBuffers || mPacketsInFlight == this->getMaxNumberOfBuffers() )
+        if ( ! mSynchronisingPacketIds )
+        {
+          synchronisePacketIds();
+        }
+
+        return;
+      }
+
+      assignPacketId ( *aBuffers );
+    }
+
+    if ( mDispatchBuffers || mPacketsInFlight >= getWindowSize() )
     {
       mDispatchQueue.push_back ( aBuffers );
     }
@@ -184,8 +273,25 @@ namespace uhal
     }
 
     std::vector< boost::asio::const_buffer > lAsioSendBuffer;
-    lAsioSendBuffer.push_back ( boost::asio::const_buffer ( mDispatchBuffers->getSendBuffer() , mDispatchBuffers->sendCounter() ) );
-    log ( Debug() , "Sending " , Integer ( mDispatchBuffers->sendCounter() ) , " bytes" );
+
+    if ( mMaxBatchSize > 1 )
+    {
+      // Send as many of the queued buffers as possible along with this one, without exceeding the limit on the number of packets in flight
+      while ( ( mDispatchBatch.size() + 1 < mMaxBatchSize ) && mDispatchQueue.size() && ( mPacketsInFlight + mDispatchBatch.size() + 1 < getWindowSize() ) )
+      {
+        mDispatchBatch.push_back ( mDispatchQueue.front() );
+        mDispatchQueue.pop_front();
+      }
+
+      log ( Debug() , "Sending " , Integer ( mDispatchBatch.size() + 1 ) , " packets in one batch" );
+    }
+    else
+    {
+      for ( const auto& lSegment : mDispatchBuffers->getSendSegments() )
+        lAsioSendBuffer.push_back ( boost::asio::const_buffer ( lSegment.first , lSegment.second ) );
+      log ( Debug() , "Sending " , Integer ( mDispatchBuffers->sendCounter() ) , " bytes" );
+    }
+
     mDeadlineTimer.expires_from_now ( this->getBoostTimeoutPeriod() );
 
     // Patch for suspected bug in using boost asio with boost python; see https://svnweb.cern.ch/trac/cactus/ticket/323#comment:7
@@ -195,8 +301,90 @@ namespace uhal
       mDeadlineTimer.expires_from_now ( this->getBoostTimeoutPeriod() );
     }
 
-    mSocket.async_send_to ( lAsioSendBuffer , mEndpoint , [&] (const boost::system::error_code& e, std::size_t n) { this->write_callback(e, n); });
-    mPacketsInFlight++;
+    if ( mMaxBatchSize > 1 )
+    {
+      // Wait until the socket is ready, then send the whole batch with a single system call
+      mSocket.async_send ( boost::asio::null_buffers() , IOServicePool::guard ( mAliveToken , [&] (const boost::system::error_code& e, std::size_t) {
+        boost::system::error_code lErrorCode ( e );
+        std::size_t lBytesTransferred ( e ? 0 : this->sendBatch ( lErrorCode ) );
+        this->write_callback ( lErrorCode , lBytesTransferred );
+      } ) );
+    }
+    else
+      mSocket.async_send_to ( lAsioSendBuffer , mEndpoint , IOServicePool::guard ( mAliveToken , [&] (const boost::system::error_code& e, std::size_t n) { this->write_callback(e, n); } ) );
+
+    mPacketsInFlight += 1 + mDispatchBatch.size();
+
+    if ( mCongestionControl )
+    {
+      mSendTimes.insert ( mSendTimes.end() , 1 + mDispatchBatch.size() , std::chrono::steady_clock::now() );
+    }
+  }
+
+
+  template < typename InnerProtocol >
+  std::size_t UDP< InnerProtocol >::sendBatch ( boost::system::error_code& aErrorCode )
+  {
+#ifdef __linux__
+    std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
+
+    if ( !mDispatchBuffers )
+    {
+      return 0;
+    }
+
+    const size_t lNrPackets ( 1 + mDispatchBatch.size() );
+    std::vector< struct iovec > lIOVecs;
+    std::vector< struct mmsghdr > lMessages ( lNrPackets );
+    memset ( lMessages.data() , 0 , lNrPackets * sizeof ( struct mmsghdr ) );
+
+    for ( size_t i = 0; i < lNrPackets; i++ )
+    {
+      Buffers& lBuffers ( i == 0 ? *mDispatchBuffers : *mDispatchBatch.at ( i - 1 ) );
+      lMessages.at ( i ).msg_hdr.msg_name = mEndpoint.data();
+      lMessages.at ( i ).msg_hdr.msg_namelen = mEndpoint.size();
+      lMessages.at ( i ).msg_hdr.msg_iovlen = lBuffers.getSendSegments().size();
+
+      for ( const auto& lSegment : lBuffers.getSendSegments() )
+      {
+        struct iovec lIOVec = { const_cast< uint8_t* > ( lSegment.first ) , lSegment.second };
+        lIOVecs.push_back ( lIOVec );
+      }
+    }
+
+    // Only point the messages at their iovecs once the vector will no longer be reallocated
+    for ( size_t i = 0 , lIndex = 0; i < lNrPackets; lIndex += lMessages.at ( i ).msg_hdr.msg_iovlen , i++ )
+      lMessages.at ( i ).msg_hdr.msg_iov = &lIOVecs.at ( lIndex );
+
+    std::size_t lBytesTransferred ( 0 );
+
+    for ( size_t lNrPacketsSent = 0; lNrPacketsSent < lNrPackets; )
+    {
+      int lRC = ::sendmmsg ( mSocket.native_handle() , &lMessages.at ( lNrPacketsSent ) , lNrPackets - lNrPacketsSent , 0 );
+
+      if ( lRC < 0 )
+      {
+        if ( errno == EINTR )
+          continue;
+
+        aErrorCode = boost::system::error_code ( errno , boost::asio::error::get_system_category() );
+        break;
+      }
+
+      for ( size_t i = lNrPacketsSent; i < lNrPacketsSent + lRC; i++ )
+        lBytesTransferred += lMessages.at ( i ).msg_len;
+
+      lNrPacketsSent += lRC;
+    }
+
+    mLargestBatch = std::max ( mLargestBatch , lNrPackets );
+
+    log ( Debug() , "Sent " , Integer ( lNrPackets ) , " packets (" , Integer ( lBytesTransferred ) , " bytes) via sendmmsg" );
+    return lBytesTransferred;
+#else
+    aErrorCode = boost::asio::error::operation_not_supported;
+    return 0;
+#endif
   }
 
 
@@ -226,7 +414,11 @@ namespace uhal
       return;
     }
 
-    if ( ( aErrorCode && ( aErrorCode != boost::asio::error::eof ) ) || ( aBytesTransferred != mDispatchBuffers->sendCounter() ) )
+    std::size_t lBytesToTransfer ( mDispatchBuffers->sendCounter() );
+    for ( const auto& lBuffers : mDispatchBatch )
+      lBytesToTransfer += lBuffers->sendCounter();
+
+    if ( ( aErrorCode && ( aErrorCode != boost::asio::error::eof ) ) || ( aBytesTransferred != lBytesToTransfer ) )
     {
       mSocket.close();
       exception::ASIOUdpError* lExc = new exception::ASIOUdpError();
@@ -234,26 +426,33 @@ namespace uhal
       {
         log ( *lExc , "Error ", Quote ( aErrorCode.message() ) , " encountered during send to UDP target with URI: " , this->uri() );
       }
-      if ( aBytesTransferred != mDispatchBuffers->sendCounter() )
+      if ( aBytesTransferred != lBytesToTransfer )
       {
-        log ( *lExc , "Only ", Integer ( aBytesTransferred ) , " of " , Integer ( mDispatchBuffers->sendCounter() ) , " bytes transferred in UDP send to URI: " , this->uri() );
+        log ( *lExc , "Only ", Integer ( aBytesTransferred ) , " of " , Integer ( lBytesToTransfer ) , " bytes transferred in UDP send to URI: " , this->uri() );
       }
       mAsynchronousException = lExc;
       NotifyConditionalVariable ( true );
       return;
     }
 
-    if ( mReplyBuffers )
-    {
-      mReplyQueue.push_back ( mDispatchBuffers );
-    }
-    else
+    mDispatchBatch.insert ( mDispatchBatch.begin() , mDispatchBuffers );
+
+    for ( const auto& lBuffers : mDispatchBatch )
     {
-      mReplyBuffers = mDispatchBuffers;
-      read ( );
+      if ( mReplyBuffers )
+      {
+        mReplyQueue.push_back ( lBuffers );
+      }
+      else
+      {
+        mReplyBuffers = lBuffers;
+        read ( );
+      }
     }
 
-    if ( mDispatchQueue.size() && mPacketsInFlight != this->getMaxNumberOfBuffers() )
+    mDispatchBatch.clear();
+
+    if ( mDispatchQueue.size() && mPacketsInFlight < getWindowSize() )
     {
       mDispatchBuffers = mDispatchQueue.front();
       mDispatchQueue.pop_front();
@@ -276,18 +475,74 @@ namespace uhal
       return;
     }
 
-    std::vector<boost::asio::mutable_buffer> lAsioReplyBuffer ( 1 , boost::asio::mutable_buffer ( & ( mReplyMemory.at ( 0 ) ) , mReplyBuffers->replyCounter() ) );
+    // With packet-loss recovery, the next packet may be a status reply, or a reply to a later packet, so allow for a full-size packet
+    const std::size_t lReceiveSize ( mPacketLossRecovery ? mMaxPayloadSize + 20 : mReplyBuffers->replyCounter() );
+    std::vector<boost::asio::mutable_buffer> lAsioReplyBuffer ( 1 , boost::asio::mutable_buffer ( & ( mReplyMemory.at ( 0 ) ) , lReceiveSize ) );
     log ( Debug() , "Expecting " , Integer ( mReplyBuffers->replyCounter() ) , " bytes in reply." );
-    mDeadlineTimer.expires_from_now ( this->getBoostTimeoutPeriod() );
+    mDeadlineTimer.expires_from_now ( getReplyTimeout() );
 
     // Patch for suspected bug in using boost asio with boost python; see https://svnweb.cern.ch/trac/cactus/ticket/323#comment:7
     while ( mDeadlineTimer.expires_from_now() < boost::posix_time::microseconds ( 600 ) )
     {
       log ( Debug() , "Resetting deadline timer since it just got set to strange value, likely due to a bug within boost (expires_from_now was: ", mDeadlineTimer.expires_from_now() , ")." );
-      mDeadlineTimer.expires_from_now ( this->getBoostTimeoutPeriod() );
+      mDeadlineTimer.expires_from_now ( getReplyTimeout() );
+    }
+
+    if ( mMaxBatchSize > 1 )
+    {
+      // Wait until the socket is ready; the replies are then read by receiveBatch, called from read_callback
+      mSocket.async_receive ( boost::asio::null_buffers() , 0 , IOServicePool::guard ( mAliveToken , [&] (const boost::system::error_code& e, std::size_t n) { this->read_callback(e, n); } ) );
     }
+    else
+      mSocket.async_receive ( lAsioReplyBuffer , 0 , IOServicePool::guard ( mAliveToken , [&] (const boost::system::error_code& e, std::size_t n) { this->read_callback(e, n); } ) );
+  }
+
+
+  template < typename InnerProtocol >
+  void UDP< InnerProtocol >::receiveBatch ( std::vector< uint32_t >& aByteCounts , boost::system::error_code& aErrorCode )
+  {
+#ifdef __linux__
+    const size_t lSlotSize ( mMaxPayloadSize + 20 );
+    std::vector< struct iovec > lIOVecs;
+    std::vector< struct mmsghdr > lMessages;
 
-    mSocket.async_receive ( lAsioReplyBuffer , 0 , [&] (const boost::system::error_code& e, std::size_t n) { this->read_callback(e, n); });
+    {
+      std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
+      const size_t lNrPackets ( std::min ( mMaxBatchSize , 1 + mReplyQueue.size() ) );
+      lIOVecs.resize ( lNrPackets );
+      lMessages.resize ( lNrPackets );
+      memset ( lMessages.data() , 0 , lNrPackets * sizeof ( struct mmsghdr ) );
+
+      for ( size_t i = 0; i < lNrPackets; i++ )
+      {
+        lIOVecs.at ( i ).iov_base = & ( mReplyMemory.at ( i * lSlotSize ) );
+        lIOVecs.at ( i ).iov_len = mPacketLossRecovery ? lSlotSize : ( i == 0 ? mReplyBuffers : mReplyQueue.at ( i - 1 ) )->replyCounter();
+        lMessages.at ( i ).msg_hdr.msg_iov = &lIOVecs.at ( i );
+        lMessages.at ( i ).msg_hdr.msg_iovlen = 1;
+      }
+    }
+
+    int lRC;
+
+    do
+    {
+      lRC = ::recvmmsg ( mSocket.native_handle() , lMessages.data() , lMessages.size() , MSG_DONTWAIT , NULL );
+    }
+    while ( ( lRC < 0 ) && ( errno == EINTR ) );
+
+    if ( lRC < 0 )
+    {
+      aErrorCode = boost::system::error_code ( errno , boost::asio::error::get_system_category() );
+      return;
+    }
+
+    for ( int i = 0; i < lRC; i++ )
+      aByteCounts.push_back ( lMessages.at ( i ).msg_len );
+
+    log ( Debug() , "Received " , Integer ( lRC ) , " packets via recvmmsg" );
+#else
+    aErrorCode = boost::asio::error::operation_not_supported;
+#endif
   }
 
 
@@ -323,34 +578,170 @@ namespace uhal
       return;
     }
 
-    if ( aBytesTransferred != mReplyBuffers->replyCounter() )
+    std::vector< uint32_t > lByteCounts;
+    boost::system::error_code lErrorCode ( aErrorCode );
+
+    if ( mMaxBatchSize > 1 )
     {
-      log ( Error() , "Expected " , Integer ( mReplyBuffers->replyCounter() ) , "-byte UDP payload from target " , Quote ( this->uri() ) , ", but only received " , Integer ( aBytesTransferred ) , " bytes. Validating returned data to work out where error occurred." );
+      if ( !lErrorCode )
+        receiveBatch ( lByteCounts , lErrorCode );
+
+      if ( ( lErrorCode == boost::asio::error::would_block ) || ( lErrorCode == boost::asio::error::try_again ) )
+      {
+        // Spurious wakeup - wait for readiness again, without resetting the deadline
+        mSocket.async_receive ( boost::asio::null_buffers() , 0 , IOServicePool::guard ( mAliveToken , [&] (const boost::system::error_code& e, std::size_t n) { this->read_callback(e, n); } ) );
+        return;
+      }
     }
+    else
+      lByteCounts.push_back ( aBytesTransferred );
 
-    if ( aErrorCode && ( aErrorCode != boost::asio::error::eof ) )
+    if ( lErrorCode && ( lErrorCode != boost::asio::error::eof ) )
     {
       mSocket.close();
 
       std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
       mAsynchronousException = new exception::ASIOUdpError();
-      log ( *mAsynchronousException , "Error ", Quote ( aErrorCode.message() ) , " encountered during receive from UDP target with URI: " , this->uri() );
+      log ( *mAsynchronousException , "Error ", Quote ( lErrorCode.message() ) , " encountered during receive from UDP target with URI: " , this->uri() );
 
       NotifyConditionalVariable ( true );
       return;
     }
 
+    for ( size_t i = 0; i < lByteCounts.size(); i++ )
+    {
+      if ( !handleReply ( & ( mReplyMemory.at ( i * ( mMaxPayloadSize + 20 ) ) ) , lByteCounts.at ( i ) ) )
+        return;
+    }
+
+    std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
+
+    if ( mReplyBuffers )
+    {
+      read();
+    }
+
+    if ( !mDispatchBuffers && mDispatchQueue.size() && mPacketsInFlight < getWindowSize() )
+    {
+      mDispatchBuffers = mDispatchQueue.front();
+      mDispatchQueue.pop_front();
+      write();
+    }
+
+    if ( !mDispatchBuffers && !mReplyBuffers )
+    {
+      mDeadlineTimer.expires_from_now( boost::posix_time::seconds(60) );
+      NotifyConditionalVariable ( true );
+    }
+  }
+
+
+  template < typename InnerProtocol >
+  bool UDP< InnerProtocol >::handleReply ( const uint8_t* aReplyData , std::size_t aBytesTransferred )
+  {
+    if ( !mPacketLossRecovery or aBytesTransferred < 4 )
+    {
+      return processReply ( aReplyData , aBytesTransferred );
+    }
+
+    uint32_t lPacketHeader;
+    memcpy ( &lPacketHeader , aReplyData , 4 );
+
+    if ( ( ntohl ( lPacketHeader ) & 0xF00000FF ) == 0x200000F1 )
+    {
+      handleStatusReply ( aReplyData , aBytesTransferred );
+      return true;
+    }
+
+    {
+      std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
+
+      if ( !mReplyBuffers )
+      {
+        log ( mUnexpectedPacketLogLimiter , Notice() , "Discarding unexpected packet (header " , Integer ( lPacketHeader , IntFmt<hex,fixed>() ) , ") from UDP target with URI " , Quote ( this->uri() ) );
+        return true;
+      }
+
+      uint32_t lExpectedHeader;
+      memcpy ( &lExpectedHeader , mReplyBuffers->getSendBufferHeaders() , 4 );
+
+      if ( lPacketHeader != lExpectedHeader )
+      {
+        // Either the reply to a later packet (i.e. the reply to the oldest packet was lost or reordered), or a duplicate
+        for ( const auto& lBuffers : mReplyQueue )
+        {
+          if ( memcmp ( lBuffers->getSendBufferHeaders() , &lPacketHeader , 4 ) == 0 )
+          {
+            mOutOfOrderReplies [ lPacketHeader ].assign ( aReplyData , aReplyData + aBytesTransferred );
+            return true;
+          }
+        }
+
+        log ( mUnexpectedPacketLogLimiter , Notice() , "Discarding unexpected packet (header " , Integer ( lPacketHeader , IntFmt<hex,fixed>() ) , ") from UDP target with URI " , Quote ( this->uri() ) );
+        return true;
+      }
+    }
+
+    if ( !processReply ( aReplyData , aBytesTransferred ) )
+    {
+      return false;
+    }
+
+    // Process any replies to subsequent packets that have already arrived
+    while ( true )
+    {
+      std::vector< uint8_t > lReply;
+
+      {
+        std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
+        mRecoveryAttempts = 0;
+
+        if ( !mReplyBuffers )
+        {
+          break;
+        }
+
+        uint32_t lExpectedHeader;
+        memcpy ( &lExpectedHeader , mReplyBuffers->getSendBufferHeaders() , 4 );
+        std::map< uint32_t , std::vector< uint8_t > >::iterator lIt ( mOutOfOrderReplies.find ( lExpectedHeader ) );
+
+        if ( lIt == mOutOfOrderReplies.end() )
+        {
+          break;
+        }
+
+        lReply.swap ( lIt->second );
+        mOutOfOrderReplies.erase ( lIt );
+      }
+
+      if ( !processReply ( lReply.data() , lReply.size() ) )
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+
+  template < typename InnerProtocol >
+  bool UDP< InnerProtocol >::processReply ( const uint8_t* aReplyData , std::size_t aBytesTransferred )
+  {
+    if ( aBytesTransferred != mReplyBuffers->replyCounter() )
+    {
+      log ( Error() , "Expected " , Integer ( mReplyBuffers->replyCounter() ) , "-byte UDP payload from target " , Quote ( this->uri() ) , ", but only received " , Integer ( aBytesTransferred ) , " bytes. Validating returned data to work out where error occurred." );
+    }
 
     std::deque< std::pair< uint8_t* , uint32_t > >& lReplyBuffers ( mReplyBuffers->getReplyBuffer() );
-    uint8_t* lReplyBuf ( & ( mReplyMemory.at ( 0 ) ) );
+    const uint8_t* lReplyBuf ( aReplyData );
 
     for (const auto& lBuffer: lReplyBuffers)
     {
       // Don't copy more of mReplyMemory than was written to, for cases when less data received than expected
-      if ( static_cast<uint32_t> ( lReplyBuf - ( & mReplyMemory.at ( 0 ) ) ) >= aBytesTransferred )
+      if ( static_cast<uint32_t> ( lReplyBuf - aReplyData ) >= aBytesTransferred )
         break;
 
-      uint32_t lNrBytesToCopy = std::min ( lBuffer.second , static_cast<uint32_t> ( aBytesTransferred - ( lReplyBuf - ( & mReplyMemory.at ( 0 ) ) ) ) );
+      uint32_t lNrBytesToCopy = std::min ( lBuffer.second , static_cast<uint32_t> ( aBytesTransferred - ( lReplyBuf - aReplyData ) ) );
       memcpy ( lBuffer.first, lReplyBuf, lNrBytesToCopy );
       lReplyBuf += lNrBytesToCopy;
     }
@@ -375,14 +766,13 @@ namespace uhal
     if ( mAsynchronousException )
     {
       NotifyConditionalVariable ( true );
-      return;
+      return false;
     }
 
     if ( mReplyQueue.size() )
     {
       mReplyBuffers = mReplyQueue.front();
       mReplyQueue.pop_front();
-      read();
     }
     else
     {
@@ -391,14 +781,217 @@ namespace uhal
 
     mPacketsInFlight--;
 
-    if ( !mDispatchBuffers && mDispatchQueue.size() && mPacketsInFlight != this->getMaxNumberOfBuffers() )
+    if ( mCongestionControl and !mSendTimes.empty() )
+    {
+      updateCongestionWindow ( std::chrono::steady_clock::now() - mSendTimes.front() );
+      mSendTimes.pop_front();
+    }
+
+    return true;
+  }
+
+
+  template < typename InnerProtocol >
+  uint32_t UDP< InnerProtocol >::getWindowSize()
+  {
+    if ( !mCongestionControl )
+    {
+      return this->getMaxNumberOfBuffers();
+    }
+
+    return std::max ( uint32_t ( 1 ) , std::min ( this->getMaxNumberOfBuffers() , uint32_t ( mCongestionWindow ) ) );
+  }
+
+
+  template < typename InnerProtocol >
+  uint32_t UDP< InnerProtocol >::getCongestionWindow()
+  {
+    std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
+    return getWindowSize();
+  }
+
+
+  template < typename InnerProtocol >
+  uint32_t UDP< InnerProtocol >::getLargestBatch()
+  {
+    std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
+    return mLargestBatch;
+  }
+
+
+  template < typename InnerProtocol >
+  void UDP< InnerProtocol >::updateCongestionWindow ( const std::chrono::steady_clock::duration& aRoundTripTime )
+  {
+    const double lRoundTripTime ( std::chrono::duration_cast< std::chrono::microseconds > ( aRoundTripTime ).count() );
+    const double lMaxWindow ( this->getMaxNumberOfBuffers() );
+
+    if ( mSlowStartThreshold == 0 )
+    {
+      mSlowStartThreshold = lMaxWindow;
+    }
+
+    // The round-trip time is not used as a congestion signal: targets process packets one at a time, so the round-trip time
+    // grows with the number of packets in flight, and the window would back off from its own load. It only sets how long
+    // the window is held after being reduced; the window is reduced on loss (see requestRecovery) and on timeout.
+    if ( mSmoothedRoundTripTime == 0 )
+    {
+      mSmoothedRoundTripTime = lRoundTripTime;
+      mRoundTripTimeVariation = lRoundTripTime / 2;
+    }
+    else
+    {
+      mRoundTripTimeVariation = 0.75 * mRoundTripTimeVariation + 0.25 * std::abs ( mSmoothedRoundTripTime - lRoundTripTime );
+      mSmoothedRoundTripTime = 0.875 * mSmoothedRoundTripTime + 0.125 * lRoundTripTime;
+    }
+
+    if ( mCongestionWindow < mSlowStartThreshold )
+    {
+      mCongestionWindow = std::min ( lMaxWindow , mCongestionWindow + 1 );
+    }
+    else
+    {
+      mCongestionWindow = std::min ( lMaxWindow , mCongestionWindow + 1 / mCongestionWindow );
+    }
+  }
+
+
+  template < typename InnerProtocol >
+  void UDP< InnerProtocol >::reduceCongestionWindow()
+  {
+    const std::chrono::steady_clock::time_point lNow ( std::chrono::steady_clock::now() );
+
+    if ( lNow < mWindowReductionHoldoff )
+    {
+      return;
+    }
+
+    mCongestionWindow = std::max ( 1.0 , mCongestionWindow / 2 );
+    mSlowStartThreshold = mCongestionWindow;
+    mWindowReductionHoldoff = lNow + std::chrono::microseconds ( uint64_t ( mSmoothedRoundTripTime ) );
+    log ( Debug() , "Congestion window for UDP client with URI " , Quote ( this->uri() ) , " reduced to " , Integer ( uint32_t ( mCongestionWindow ) ) ,
+          " packets (smoothed round-trip time " , Integer ( uint32_t ( mSmoothedRoundTripTime ) ) , "us)" );
+  }
+
+
+  template < typename InnerProtocol >
+  boost::posix_time::time_duration UDP< InnerProtocol >::getReplyTimeout()
+  {
+    if ( !mPacketLossRecovery )
+    {
+      return this->getBoostTimeoutPeriod();
+    }
+
+    // Split the timeout period between the initial wait and the recovery attempts
+    return std::max ( this->getBoostTimeoutPeriod() / int ( kMaxRecoveryAttempts + 1 ) , boost::posix_time::time_duration ( boost::posix_time::milliseconds ( 1 ) ) );
+  }
+
+
+  template < typename InnerProtocol >
+  void UDP< InnerProtocol >::sendStatusRequest()
+  {
+    // Status, resend and status reply packets are always big-endian
+    std::vector< uint32_t > lRequest ( 16 , 0 );
+    lRequest.at ( 0 ) = htonl ( 0x200000F1 );
+
+    boost::system::error_code lErrorCode;
+    mSocket.send_to ( boost::asio::buffer ( lRequest ) , mEndpoint , 0 , lErrorCode );
+
+    if ( lErrorCode )
+    {
+      log ( Warning() , "Error " , Quote ( lErrorCode.message() ) , " encountered when sending status request to UDP target with URI " , Quote ( this->uri() ) );
+    }
+  }
+
+
+  template < typename InnerProtocol >
+  void UDP< InnerProtocol >::assignPacketId ( Buffers& aBuffers )
+  {
+    // The IPbus layer always uses packet ID 0, which targets accept without keeping a copy of the reply for resending;
+    // so replace it with the next ID in the sequence expected by the target
+    const uint32_t lPacketHeader ( 0x200000F0 | ( uint32_t ( mNextPacketId ) << 8 ) );
+    memcpy ( aBuffers.getSendBufferHeaders() , &lPacketHeader , 4 );
+    mNextPacketId = ( mNextPacketId == 0xFFFF ) ? 1 : mNextPacketId + 1;
+  }
+
+
+  template < typename InnerProtocol >
+  void UDP< InnerProtocol >::synchronisePacketIds()
+  {
+    NotifyConditionalVariable ( false );
+    mSynchronisingPacketIds = true;
+    mRecoveryAttempts = 0;
+    sendStatusRequest();
+    mDeadlineTimer.expires_from_now ( getReplyTimeout() );
+    mSocket.async_receive ( boost::asio::buffer ( mReplyMemory.data() , mMaxPayloadSize + 20 ) , 0 , IOServicePool::guard ( mAliveToken , [&] (const boost::system::error_code& e, std::size_t n) { this->synchronise_callback(e, n); } ) );
+  }
+
+
+  template < typename InnerProtocol >
+  void UDP< InnerProtocol >::synchronise_callback ( const boost::system::error_code& aErrorCode , std::size_t aBytesTransferred )
+  {
+    std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
+
+    if ( !mSynchronisingPacketIds or mAsynchronousException )
+    {
+      return;
+    }
+
+    if ( mDeadlineTimer.expires_at () == boost::posix_time::pos_infin )
+    {
+      mSynchronisingPacketIds = false;
+      mAsynchronousException = new exception::UdpTimeout();
+      log ( *mAsynchronousException , "Timeout (" , Integer ( this->getBoostTimeoutPeriod().total_milliseconds() ) , " milliseconds) occurred for status request to UDP target with URI: ", this->uri() );
+      NotifyConditionalVariable ( true );
+      return;
+    }
+
+    if ( aErrorCode && ( aErrorCode != boost::asio::error::eof ) )
+    {
+      mSynchronisingPacketIds = false;
+      mSocket.close();
+      mAsynchronousException = new exception::ASIOUdpError();
+      log ( *mAsynchronousException , "Error ", Quote ( aErrorCode.message() ) , " encountered when receiving status reply from UDP target with URI: " , this->uri() );
+      NotifyConditionalVariable ( true );
+      return;
+    }
+
+    uint32_t lWords[4];
+
+    if ( aBytesTransferred >= 16 )
+    {
+      memcpy ( lWords , mReplyMemory.data() , 16 );
+    }
+
+    if ( aBytesTransferred < 16 or ( ( ntohl ( lWords[0] ) & 0xF00000FF ) != 0x200000F1 ) )
+    {
+      // Any other packets are stale replies from before the client was last reset, and can be discarded
+      mSocket.async_receive ( boost::asio::buffer ( mReplyMemory.data() , mMaxPayloadSize + 20 ) , 0 , IOServicePool::guard ( mAliveToken , [&] (const boost::system::error_code& e, std::size_t n) { this->synchronise_callback(e, n); } ) );
+      return;
+    }
+
+    mSynchronisingPacketIds = false;
+    mRecoveryAttempts = 0;
+    mNextPacketId = ( ntohl ( lWords[3] ) >> 8 ) & 0xFFFF;
+
+    if ( mNextPacketId == 0 )
+    {
+      mNextPacketId = 1;
+    }
+
+    log ( Info() , "UDP target with URI " , Quote ( this->uri() ) , " expects next packet ID " , Integer ( mNextPacketId ) );
+
+    for ( const auto& lBuffers : mDispatchQueue )
+    {
+      assignPacketId ( *lBuffers );
+    }
+
+    if ( !mDispatchBuffers && mDispatchQueue.size() && mPacketsInFlight < getWindowSize() )
     {
       mDispatchBuffers = mDispatchQueue.front();
       mDispatchQueue.pop_front();
       write();
     }
-
-    if ( !mDispatchBuffers && !mReplyBuffers )
+    else if ( !mDispatchBuffers && !mReplyBuffers )
     {
       mDeadlineTimer.expires_from_now( boost::posix_time::seconds(60) );
       NotifyConditionalVariable ( true );
@@ -406,6 +999,95 @@ namespace uhal
   }
 
 
+  template < typename InnerProtocol >
+  void UDP< InnerProtocol >::requestRecovery()
+  {
+    mRecoveryAttempts++;
+    this->metrics().retry();
+    uint32_t lPacketHeader;
+    memcpy ( &lPacketHeader , mReplyBuffers->getSendBufferHeaders() , 4 );
+    log ( mLostPacketLogLimiter , Notice() , "No reply received within " , Integer ( getReplyTimeout().total_milliseconds() ) , "ms for packet ID " , Integer ( ( lPacketHeader >> 8 ) & 0xFFFF ) ,
+          " sent to UDP target with URI " , Quote ( this->uri() ) , "; sending status request (attempt " , Integer ( mRecoveryAttempts ) , " of " , Integer ( kMaxRecoveryAttempts ) , ")" );
+
+    if ( mCongestionControl )
+    {
+      reduceCongestionWindow();
+    }
+
+    sendStatusRequest();
+    mDeadlineTimer.expires_from_now ( getReplyTimeout() );
+  }
+
+
+  template < typename InnerProtocol >
+  void UDP< InnerProtocol >::handleStatusReply ( const uint8_t* aReplyData , std::size_t aBytesTransferred )
+  {
+    std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
+
+    // Only act on replies to status requests sent by requestRecovery; others (e.g. duplicate replies to the repeated status requests
+    // sent while synchronising the packet IDs) describe an earlier state of the target
+    if ( aBytesTransferred < 16 or !mReplyBuffers or mRecoveryAttempts == 0 )
+    {
+      return;
+    }
+
+    uint32_t lWords[4];
+    memcpy ( lWords , aReplyData , 16 );
+    const uint16_t lNextExpectedId ( ( ntohl ( lWords[3] ) >> 8 ) & 0xFFFF );
+
+    // The target has received all packets before the one that it expects next: for those, only the reply was lost, so request a
+    // resend of the reply; the target has dropped that packet and all later ones, so resend the original requests for those
+    std::vector< std::shared_ptr< Buffers > > lInFlight ( 1 , mReplyBuffers );
+    lInFlight.insert ( lInFlight.end() , mReplyQueue.begin() , mReplyQueue.end() );
+    bool lReceivedByTarget ( true );
+    uint32_t lNrResendRequests ( 0 ) , lNrRequestsResent ( 0 );
+
+    for ( const auto& lBuffers : lInFlight )
+    {
+      uint32_t lPacketHeader;
+      memcpy ( &lPacketHeader , lBuffers->getSendBufferHeaders() , 4 );
+      const uint16_t lPacketId ( ( lPacketHeader >> 8 ) & 0xFFFF );
+
+      if ( lPacketId == lNextExpectedId )
+      {
+        lReceivedByTarget = false;
+      }
+
+      if ( mOutOfOrderReplies.count ( lPacketHeader ) )
+      {
+        continue;
+      }
+
+      boost::system::error_code lErrorCode;
+
+      if ( lReceivedByTarget )
+      {
+        const uint32_t lResendRequest ( htonl ( 0x200000F2 | ( uint32_t ( lPacketId ) << 8 ) ) );
+        mSocket.send_to ( boost::asio::buffer ( &lResendRequest , 4 ) , mEndpoint , 0 , lErrorCode );
+        lNrResendRequests++;
+      }
+      else
+      {
+        std::vector< boost::asio::const_buffer > lAsioSendBuffer;
+
+        for ( const auto& lSegment : lBuffers->getSendSegments() )
+          lAsioSendBuffer.push_back ( boost::asio::const_buffer ( lSegment.first , lSegment.second ) );
+
+        mSocket.send_to ( lAsioSendBuffer , mEndpoint , 0 , lErrorCode );
+        lNrRequestsResent++;
+      }
+
+      if ( lErrorCode )
+      {
+        log ( Warning() , "Error " , Quote ( lErrorCode.message() ) , " encountered when resending packet ID " , Integer ( lPacketId ) , " to UDP target with URI " , Quote ( this->uri() ) );
+      }
+    }
+
+    log ( mResendLogLimiter , Notice() , "UDP target with URI " , Quote ( this->uri() ) , " expects next packet ID " , Integer ( lNextExpectedId ) , "; requested resend of " ,
+          Integer ( lNrResendRequests ) , " replies, and resent " , Integer ( lNrRequestsResent ) , " packets" );
+  }
+
+
 
   template < typename InnerProtocol >
   void UDP< InnerProtocol >::CheckDeadline()
@@ -415,12 +1097,32 @@ namespace uhal
     // deadline before this actor had a chance to run.
     std::lock_guard<std::mutex> lLock ( this->mTransportLayerMutex );
 
-    if ( mDeadlineTimer.expires_at() <= boost::asio::deadline_timer::traits_type::now() )
+    if ( mSynchronisingPacketIds && mSocket.is_open() && ( mRecoveryAttempts < kMaxRecoveryAttempts ) &&
+         ( mDeadlineTimer.expires_at() <= boost::asio::deadline_timer::traits_type::now() ) )
+    {
+      // No status reply yet, so ask again; the receive started by synchronisePacketIds is still waiting
+      mRecoveryAttempts++;
+      sendStatusRequest();
+      mDeadlineTimer.expires_from_now ( getReplyTimeout() );
+    }
+    else if ( mPacketLossRecovery && mReplyBuffers && !mDispatchBuffers && mSocket.is_open() && ( mRecoveryAttempts < kMaxRecoveryAttempts ) &&
+         ( mDeadlineTimer.expires_at() <= boost::asio::deadline_timer::traits_type::now() ) )
+    {
+      requestRecovery();
+    }
+    else if ( mDeadlineTimer.expires_at() <= boost::asio::deadline_timer::traits_type::now() )
     {
       // SETTING THE EXCEPTION HERE CAN APPEAR AS A TIMEOUT WHEN NONE ACTUALLY EXISTS
-      if (  mDispatchBuffers || mReplyBuffers )
+      if (  mDispatchBuffers || mReplyBuffers || mSynchronisingPacketIds )
       {
         log ( Warning() , "Closing UDP socket for URI " , Quote ( this->uri() ) , " since deadline has passed" );
+
+        if ( mCongestionControl )
+        {
+          // As after a TCP retransmission timeout, restart from a single packet in flight
+          mSlowStartThreshold = std::max ( 1.0 , mCongestionWindow / 2 );
+          mCongestionWindow = 1;
+        }
       }
       else
       {
@@ -435,8 +1137,9 @@ namespace uhal
       mDeadlineTimer.expires_at ( boost::posix_time::pos_infin );
     }
 
-    // Put the actor back to sleep.
-    mDeadlineTimer.async_wait ([this] (const boost::system::error_code&) { this->CheckDeadline(); });
+    // Put the actor back to sleep, unless the client is being destroyed
+    if ( !mClosing )
+      mDeadlineTimer.async_wait ( IOServicePool::guard ( mAliveToken , [this] (const boost::system::error_code&) { this->CheckDeadline(); } ) );
   }
 
 
@@ -454,6 +1157,21 @@ namespace uhal
 
 
 
+  template < typename InnerProtocol >
+  bool UDP< InnerProtocol >::beginFlush( )
+  {
+    return true;
+  }
+
+
+  template < typename InnerProtocol >
+  bool UDP< InnerProtocol >::asynchronousExceptionPending( )
+  {
+    std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
+    return ( mAsynchronousException != NULL );
+  }
+
+
   template < typename InnerProtocol >
   void UDP< InnerProtocol >::dispatchExceptionHandler()
   {
@@ -481,8 +1199,14 @@ namespace uhal
     }
 
     ClientInterface::returnBufferToPool ( mDispatchQueue );
+    ClientInterface::returnBufferToPool ( mDispatchBatch );
     ClientInterface::returnBufferToPool ( mReplyQueue );
     mPacketsInFlight = 0;
+    mSendTimes.clear();
+    mNextPacketId = 0;
+    mSynchronisingPacketIds = false;
+    mRecoveryAttempts = 0;
+    mOutOfOrderReplies.clear();
 
     ClientInterface::returnBufferToPool ( mDispatchBuffers );
     mDispatchBuffers.reset();
@@ -501,6 +1225,11 @@ namespace uhal
       mFlushDone = aValue;
     }
     mConditionalVariable.notify_one();
+
+    if ( aValue )
+    {
+      ClientInterface::repliesReceived();
+    }
   }
 
 
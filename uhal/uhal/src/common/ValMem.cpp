@@ -40,6 +40,66 @@
 namespace uhal
 {
 
+  IPbusHeaderStore::IPbusHeaderStore() :
+    mSize ( 0 )
+  {
+  }
+
+
+  void IPbusHeaderStore::push_back ( const uint32_t& aHeader )
+  {
+    if ( mSize < kInlineSize )
+    {
+      mInline[mSize] = aHeader;
+    }
+    else
+    {
+      mOverflow.push_back ( aHeader );
+    }
+
+    mSize++;
+  }
+
+
+  uint32_t& IPbusHeaderStore::back()
+  {
+    return ( *this ) [mSize - 1];
+  }
+
+
+  uint32_t& IPbusHeaderStore::operator[] ( std::size_t aIndex )
+  {
+    return ( aIndex < kInlineSize ) ? mInline[aIndex] : mOverflow[aIndex - kInlineSize];
+  }
+
+
+  const uint32_t& IPbusHeaderStore::operator[] ( std::size_t aIndex ) const
+  {
+    return ( aIndex < kInlineSize ) ? mInline[aIndex] : mOverflow[aIndex - kInlineSize];
+  }
+
+
+  std::size_t IPbusHeaderStore::size() const
+  {
+    return mSize;
+  }
+
+
+  bool IPbusHeaderStore::empty() const
+  {
+    return mSize == 0;
+  }
+
+
+  void IPbusHeaderStore::clear()
+  {
+    mSize = 0;
+    mOverflow.clear();
+  }
+
+
+
+
   _ValHeader_::_ValHeader_ ( const bool& aValid ) :
     valid ( aValid )
   {
@@ -74,6 +134,12 @@ namespace uhal
   }
 
 
+  ValHeader::ValHeader ( const std::shared_ptr< _ValHeader_ >& aMembers ) :
+    mMembers ( aMembers )
+  {
+  }
+
+
   bool ValHeader::valid()
   {
     return mMembers->valid;
@@ -101,6 +167,13 @@ namespace uhal
   }
 
 
+  template< typename T >
+  ValWord< T >::ValWord ( const std::shared_ptr< _ValWord_<T> >& aMembers ) :
+    mMembers ( aMembers )
+  {
+  }
+
+
   template< typename T >
   ValWord< T >::ValWord() :
     mMembers ( new _ValWord_<T> ( T() , false , 0xFFFFFFFF ) )
@@ -206,6 +279,13 @@ namespace uhal
   }
 
 
+  template< typename T >
+  ValVector< T >::ValVector ( const std::shared_ptr< _ValVector_<T> >& aMembers ) :
+    mMembers ( aMembers )
+  {
+  }
+
+
   template< typename T >
   ValVector< T >::ValVector() :
     mMembers ( new _ValVector_<T> ( std::vector<T>() , false ) )
@@ -386,6 +466,12 @@ namespace uhal
   }
 
 
+  template struct _ValWord_< uint8_t >;
+  template struct _ValWord_< uint32_t >;
+
+  template struct _ValVector_< uint8_t >;
+  template struct _ValVector_< uint32_t >;
+
   template class ValWord< uint8_t >;
   template class ValWord< uint32_t >;
 
@@ -0,0 +1,100 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/ValMemPool.hpp"
+
+#include <algorithm>
+#include <stdint.h>
+
+
+namespace uhal
+{
+
+  ValMemPool::ValMemPool()
+  {
+    std::fill ( mFreeLists , mFreeLists + kNrSizeClasses , static_cast< FreeBlock* > ( NULL ) );
+  }
+
+
+  ValMemPool::~ValMemPool()
+  {
+    for ( void* lChunk : mChunks )
+    {
+      ::operator delete ( lChunk );
+    }
+  }
+
+
+  void* ValMemPool::allocate ( std::size_t aSize )
+  {
+    const std::size_t lClass = ( aSize + kGranularity - 1 ) / kGranularity;
+
+    if ( lClass == 0 or lClass > kNrSizeClasses )
+    {
+      return ::operator new ( aSize );
+    }
+
+    std::lock_guard<std::mutex> lLock ( mMutex );
+    FreeBlock*& lHead = mFreeLists[lClass - 1];
+
+    if ( ! lHead )
+    {
+      // Carve a new chunk into blocks and thread them onto the free list
+      const std::size_t lBlockSize = lClass * kGranularity;
+      mChunks.reserve ( mChunks.size() + 1 );
+      uint8_t* lChunk = static_cast< uint8_t* > ( ::operator new ( lBlockSize * kBlocksPerChunk ) );
+      mChunks.push_back ( lChunk );
+
+      for ( std::size_t i = kBlocksPerChunk; i > 0; i-- )
+      {
+        FreeBlock* lBlock = reinterpret_cast< FreeBlock* > ( lChunk + ( i - 1 ) * lBlockSize );
+        lBlock->next = lHead;
+        lHead = lBlock;
+      }
+    }
+
+    FreeBlock* lBlock = lHead;
+    lHead = lBlock->next;
+    return lBlock;
+  }
+
+
+  void ValMemPool::deallocate ( void* aPtr , std::size_t aSize )
+  {
+    const std::size_t lClass = ( aSize + kGranularity - 1 ) / kGranularity;
+
+    if ( lClass == 0 or lClass > kNrSizeClasses )
+    {
+      ::operator delete ( aPtr );
+      return;
+    }
+
+    std::lock_guard<std::mutex> lLock ( mMutex );
+    FreeBlock* lBlock = static_cast< FreeBlock* > ( aPtr );
+    lBlock->next = mFreeLists[lClass - 1];
+    mFreeLists[lClass - 1] = lBlock;
+  }
+
+}